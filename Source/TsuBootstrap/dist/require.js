@@ -614,11 +614,17 @@ function trimRoot(str) {
     return str.startsWith('/') ? str.slice(1) : str;
 }
 function resolve(id) {
-    return trimRoot(sync(id, {
+    const cachedPath = __file.findResolution(__dirname, id);
+    if (cachedPath !== undefined) {
+        return cachedPath;
+    }
+    const resolvedPath = trimRoot(sync(id, {
         basedir: __dirname,
         readFileSync: (path) => __file.read(trimRoot(path)),
         isFile: (path) => __file.exists(trimRoot(path))
     }));
+    __file.addResolution(__dirname, id, resolvedPath);
+    return resolvedPath;
 }
 function _require(id) {
     if (id.startsWith('UE/')) {
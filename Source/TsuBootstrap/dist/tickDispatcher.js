@@ -0,0 +1,26 @@
+'use strict';
+
+function dispatchTicks(objects, callbacks, count, deltaTime) {
+    let hasError = false;
+    let firstError;
+    for (let i = 0; i < count; ++i) {
+        const callback = callbacks[i];
+        if (callback === undefined) {
+            continue;
+        }
+        try {
+            callback(objects[i], deltaTime);
+        }
+        catch (error) {
+            if (!hasError) {
+                hasError = true;
+                firstError = error;
+            }
+        }
+    }
+    if (hasError) {
+        throw firstError;
+    }
+}
+
+module.exports = dispatchTicks;
@@ -77,5 +77,21 @@ export default [{
 		json()
 	],
 
+	onwarn: onWarning,
+}, {
+	input: 'output/tickDispatcher.js',
+
+	output: {
+		file: 'dist/tickDispatcher.js',
+		format: 'cjs',
+		interop: false
+	},
+
+	plugins: [
+		node(),
+		commonjs(),
+		json()
+	],
+
 	onwarn: onWarning,
 }];
@@ -7,14 +7,24 @@ function trimRoot(str: string) {
 	return str.startsWith('/') ? str.slice(1) : str;
 }
 
+// Resolutions are cached natively, and outlive the context, until something changes on disk
 function resolve(id: string) {
-	return trimRoot(
+	const cachedPath = __file.findResolution(__dirname, id);
+	if (cachedPath !== undefined) {
+		return cachedPath;
+	}
+
+	const resolvedPath = trimRoot(
 		__resolve(id, {
 			basedir: __dirname,
 			readFileSync: (path: string) => __file.read(trimRoot(path)),
 			isFile: (path: string) => __file.exists(trimRoot(path))
 		})
 	);
+
+	__file.addResolution(__dirname, id, resolvedPath);
+
+	return resolvedPath;
 }
 
 function _require(id: string) {
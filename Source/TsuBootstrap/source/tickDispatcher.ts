@@ -0,0 +1,37 @@
+type TickCallback = (object: object, deltaTime: number) => void;
+
+function dispatchTicks(
+	objects: object[],
+	callbacks: TickCallback[],
+	count: number,
+	deltaTime: number
+) {
+	let hasError = false;
+	let firstError: unknown;
+
+	// Keep ticking the remaining objects if one of them throws, and rethrow
+	// the first error once all of them have been ticked
+	for (let i = 0; i < count; ++i) {
+		const callback = callbacks[i];
+
+		// Callbacks can be removed while dispatching
+		if (callback === undefined) {
+			continue;
+		}
+
+		try {
+			callback(objects[i], deltaTime);
+		} catch (error) {
+			if (!hasError) {
+				hasError = true;
+				firstError = error;
+			}
+		}
+	}
+
+	if (hasError) {
+		throw firstError;
+	}
+}
+
+export default dispatchTicks;
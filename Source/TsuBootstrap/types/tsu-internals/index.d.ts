@@ -45,6 +45,8 @@ declare function __require(id: string): unknown;
 declare const __file: {
 	read(path: string): string;
 	exists(path: string): boolean;
+	findResolution(basedir: string, id: string): string | undefined;
+	addResolution(basedir: string, id: string, path: string): void;
 };
 
 declare const __path: {
@@ -11,17 +11,35 @@
 #include "EditorFramework/AssetImportData.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "Kismet2/KismetReinstanceUtilities.h"
+#include "HAL/FileManager.h"
 #include "KismetCompilerMisc.h"
 #include "Misc/FileHelper.h"
 #include "Misc/InteractiveProcess.h"
 #include "Misc/ScopeExit.h"
 
+namespace TsuBlueprintCompiler_Private
+{
+
+/**
+ * Cooked sources by the hash of the source they were built from, since a class can get serialized more than once
+ * while being cooked, like when cooking for multiple platforms
+ */
+TMap<FString, FString> CookedSources;
+
+} // namespace TsuBlueprintCompiler_Private
+
 FTsuBlueprintCompiler::FTsuBlueprintCompiler(
 	UBlueprint* SourceSketch,
 	FCompilerResultsLog& MessageLog,
 	const FKismetCompilerOptions& CompilerOptions)
 	: Super(SourceSketch, MessageLog, CompilerOptions)
 {
+	// Blueprints compiled as a batch all get their compiler created up front, so sending the parse request here lets
+	// the parser work through the batch while the other blueprints are being compiled. The response is only waited
+	// for once it's needed, in `CreateClassVariablesFromBlueprint`.
+	auto OldClass = Cast<UTsuBlueprintGeneratedClass>(Blueprint->GeneratedClass);
+	if (OldClass && FTsuTypings::DoTypingsExist(OldClass))
+		FTsuParser::Request(GetAbsoluteFilename());
 }
 
 void FTsuBlueprintCompiler::SpawnNewClass(const FString& NewClassName)
@@ -50,8 +68,13 @@ void FTsuBlueprintCompiler::CreateClassVariablesFromBlueprint()
 
 	// Make sure we have (albeit empty) typings to allow self-referencing
 	if (!FTsuTypings::DoTypingsExist(TsuClass))
+	{
 		FTsuTypings::WriteTypings(TsuClass);
 
+		// Any request sent before this point would've been parsed without the typings
+		FTsuParser::Request(GetAbsoluteFilename(), true);
+	}
+
 	for (const FTsuCompilationMessage& Msg : CompileScript(GetAbsoluteFilename(), TsuClass->Exports))
 	{
 		switch (Msg.Severity)
@@ -71,7 +94,10 @@ void FTsuBlueprintCompiler::CreateClassVariablesFromBlueprint()
 	Super::CreateClassVariablesFromBlueprint();
 }
 
-TArray<FTsuCompilationMessage> FTsuBlueprintCompiler::CompileScript(const FString& FilePath, FTsuParsedFile& Result)
+TArray<FTsuCompilationMessage> FTsuBlueprintCompiler::CompileScript(
+	const FString& FilePath,
+	FTsuParsedFile& Result,
+	ETsuParseMode Mode)
 {
 	const double StartTime = FPlatformTime::Seconds();
 
@@ -80,7 +106,7 @@ TArray<FTsuCompilationMessage> FTsuBlueprintCompiler::CompileScript(const FStrin
 	const FString FileName = FPaths::GetCleanFilename(FilePath);
 
 	FTsuParsedFile Exports;
-	if (!FTsuParser::Parse(FilePath, Exports))
+	if (!FTsuParser::Parse(FilePath, Exports, Mode))
 	{
 		Messages.Add({ETsuSeverity::Error, TEXT("[TSU] Unexpected parsing error, see output log.")});
 		return Messages;
@@ -94,11 +120,56 @@ TArray<FTsuCompilationMessage> FTsuBlueprintCompiler::CompileScript(const FStrin
 		return Messages;
 	}
 
+	if (!Exports.SourcePath.IsEmpty())
+	{
+		// The parser writes the emitted source to a file named after its hash, so it only needs loading if it changed
+		if (Exports.SourceHash == Result.SourceHash && Result.Source.Len() > 0)
+		{
+			Exports.Source = MoveTemp(Result.Source);
+		}
+		else if (!FFileHelper::LoadFileToString(Exports.Source, *Exports.SourcePath))
+		{
+			Messages.Add({
+				ETsuSeverity::Error,
+				FString::Printf(TEXT("[TSU] Failed to load emitted source from '%s'"), *Exports.SourcePath)});
+
+			return Messages;
+		}
+
+		Exports.SourcePath.Reset();
+	}
+
+	if (!Exports.SourceMapPath.IsEmpty())
+	{
+		// Named the same as the module is in call stacks, which is relative to the scripts directory
+		FString SourceMapName = FPaths::SetExtension(Exports.Path, TEXT(".js.map"));
+		FPaths::MakePathRelativeTo(SourceMapName, *FPaths::ConvertRelativePathToFull(FTsuPaths::ScriptsSourceDir()));
+
+		const FString SourceMapPath = FTsuPaths::SourceMapsDir() / SourceMapName;
+		if (IFileManager::Get().Copy(*SourceMapPath, *Exports.SourceMapPath) != COPY_OK)
+		{
+			Messages.Add({
+				ETsuSeverity::Warning,
+				FString::Printf(TEXT("[TSU] Failed to copy source map to '%s'"), *SourceMapPath)});
+		}
+
+		Exports.SourceMapPath.Reset();
+	}
+
 	FPaths::MakeStandardFilename(Exports.Path);
 
 	Exports.Path = FPaths::SetExtension(Exports.Path, TEXT(".js"));
 
-	Result = MoveTemp(Exports);
+	if (Mode == ETsuParseMode::TranspileOnly || Mode == ETsuParseMode::Production)
+	{
+		Result.Path = MoveTemp(Exports.Path);
+		Result.Source = MoveTemp(Exports.Source);
+		Result.SourceHash = MoveTemp(Exports.SourceHash);
+	}
+	else
+	{
+		Result = MoveTemp(Exports);
+	}
 
 	const double EndTime = FPlatformTime::Seconds();
 	const double ElapsedTime = (EndTime - StartTime) * 1000.0;
@@ -127,9 +198,53 @@ bool FTsuBlueprintCompiler::ValidateGeneratedClass(UBlueprintGeneratedClass* Cla
 	return SuperResult && Result;
 }
 
+bool FTsuBlueprintCompiler::BuildCookedSource(const UTsuBlueprintGeneratedClass* Class, FString& OutSource)
+{
+	using namespace TsuBlueprintCompiler_Private;
+
+	auto TsuBlueprint = Cast<UTsuBlueprint>(Class->ClassGeneratedBy);
+	if (!TsuBlueprint || !Class->Exports.IsValid())
+		return false;
+
+	const FString& SourceHash = Class->Exports.SourceHash;
+	if (const FString* CookedSource = SourceHash.IsEmpty() ? nullptr : CookedSources.Find(SourceHash))
+	{
+		OutSource = *CookedSource;
+		return true;
+	}
+
+	FTsuParsedFile Result;
+	const TArray<FTsuCompilationMessage> Messages = CompileScript(
+		GetAbsoluteFilename(TsuBlueprint),
+		Result,
+		ETsuParseMode::Production);
+
+	for (const FTsuCompilationMessage& Msg : Messages)
+	{
+		if (Msg.Severity == ETsuSeverity::Error)
+		{
+			UE_LOG(LogTsuEditor, Error, TEXT("Failed to build cooked source for '%s': %s"), *Class->GetName(), *Msg.Message);
+			return false;
+		}
+
+		UE_LOG(LogTsuEditor, Warning, TEXT("%s"), *Msg.Message);
+	}
+
+	if (!SourceHash.IsEmpty())
+		CookedSources.Add(SourceHash, Result.Source);
+
+	OutSource = MoveTemp(Result.Source);
+	return true;
+}
+
 FString FTsuBlueprintCompiler::GetAbsoluteFilename() const
 {
-	FString Filename = GetTsuBlueprint()->AssetImportData->GetFirstFilename();
+	return GetAbsoluteFilename(GetTsuBlueprint());
+}
+
+FString FTsuBlueprintCompiler::GetAbsoluteFilename(const UTsuBlueprint* TsuBlueprint)
+{
+	FString Filename = TsuBlueprint->AssetImportData->GetFirstFilename();
 	if (Filename.IsEmpty())
 		Filename = UTsuFactory::GetCurrentFilename();
 
@@ -2,6 +2,8 @@
 
 #include "CoreMinimal.h"
 
+#include "TsuParser.h"
+
 #include "KismetCompiler.h"
 
 class UTsuBlueprint;
@@ -31,7 +33,22 @@ public:
 		FCompilerResultsLog& MessageLog,
 		const FKismetCompilerOptions& CompilerOptions);
 
-	static TArray<FTsuCompilationMessage> CompileScript(const FString& Filename, struct FTsuParsedFile& Result);
+	/**
+	 * Compiles a script into `Result`. With `ETsuParseMode::TranspileOnly` only the source and path of `Result` are
+	 * updated, which is enough for hot reloading the module.
+	 */
+	static TArray<FTsuCompilationMessage> CompileScript(
+		const FString& Filename,
+		FTsuParsedFile& Result,
+		ETsuParseMode Mode = ETsuParseMode::Full);
+
+	/**
+	 * Builds the source that a class gets cooked with, using `ETsuParseMode::Production`. Its source map is copied
+	 * to `FTsuPaths::SourceMapsDir`, named after the module, for symbolicating the call stacks of cooked builds.
+	 *
+	 * @returns Whether the source was built, in which case `OutSource` holds it
+	 */
+	static bool BuildCookedSource(const UTsuBlueprintGeneratedClass* Class, FString& OutSource);
 
 private:
 	void SpawnNewClass(const FString& NewClassName) override;
@@ -40,6 +57,7 @@ private:
 	bool ValidateGeneratedClass(UBlueprintGeneratedClass* Class) override;
 
 	FString GetAbsoluteFilename() const;
+	static FString GetAbsoluteFilename(const UTsuBlueprint* TsuBlueprint);
 
 	UTsuBlueprint* GetTsuBlueprint() const;
 	UTsuBlueprintGeneratedClass* GetTsuClass() const;
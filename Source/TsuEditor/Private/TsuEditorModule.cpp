@@ -8,16 +8,24 @@
 #include "TsuEditorCommands.h"
 #include "TsuEditorStyle.h"
 #include "TsuEditorUserSettings.h"
+#include "TsuParser.h"
+#include "TsuPaths.h"
 #include "TsuTypings.h"
 
 #include "AssetToolsModule.h"
+#include "Containers/Ticker.h"
+#include "DirectoryWatcherModule.h"
 #include "Editor.h"
 #include "Editor/EditorEngine.h"
+#include "Framework/Notifications/NotificationManager.h"
 #include "IAssetTools.h"
+#include "IDirectoryWatcher.h"
 #include "ISettingsModule.h"
 #include "KismetCompiler.h"
 #include "KismetCompilerModule.h"
 #include "Misc/CoreDelegates.h"
+#include "Misc/Paths.h"
+#include "Widgets/Notifications/SNotificationList.h"
 
 namespace TsuEditorModule_Private
 {
@@ -51,6 +59,8 @@ public:
 
 		FCoreDelegates::OnPostEngineInit.AddRaw(
 			this, &FTsuEditorModule::OnPostEngineInit);
+
+		UTsuBlueprintGeneratedClass::BuildCookedSource.BindStatic(&FTsuBlueprintCompiler::BuildCookedSource);
 	}
 
 	void ShutdownModule() override
@@ -61,12 +71,20 @@ public:
 				GEditor->OnBlueprintPreCompile().RemoveAll(this);
 
 			UnregisterAssetTypeActions();
+			UnregisterScriptsWatcher();
+
+			if (WarmUpTickerHandle.IsValid())
+				FTicker::GetCoreTicker().RemoveTicker(WarmUpTickerHandle);
 			FTsuEditorCommands::Unregister();
 			FTsuEditorStyle::Shutdown();
 		}
 
 		TsuEditorModule_Private::GetKismetCompilers().Remove(this);
 		UnregisterSettings();
+
+		UTsuBlueprintGeneratedClass::BuildCookedSource.Unbind();
+
+		FTsuTypings::WaitForPendingWrites();
 	}
 
 	bool CanCompile(const UBlueprint* Blueprint) override
@@ -106,10 +124,16 @@ private:
 		RegisterSettings();
 
 		if (!IsRunningCommandlet())
+		{
 			RegisterAssetTypeActions();
+			RegisterScriptsWatcher();
+		}
 
 		FTsuTypings::WriteAllTypings();
 
+		if (!IsRunningCommandlet())
+			WarmUpParser();
+
 		if (GEditor)
 		{
 			GEditor->OnBlueprintPreCompile().AddRaw(
@@ -162,6 +186,124 @@ private:
 		AssetTypeActions.Empty();
 	}
 
+	void RegisterScriptsWatcher()
+	{
+		auto& DirectoryWatcherModule = FModuleManager::LoadModuleChecked<FDirectoryWatcherModule>("DirectoryWatcher");
+		if (IDirectoryWatcher* DirectoryWatcher = DirectoryWatcherModule.Get())
+		{
+			// The whole scripts directory is watched, rather than just the sources, since `node_modules` changing
+			// affects what `require` calls resolve to
+			WatchedScriptsDir = FPaths::ConvertRelativePathToFull(FTsuPaths::ScriptsDir());
+			WatchedSourceDir = FPaths::ConvertRelativePathToFull(FTsuPaths::ScriptsSourceDir());
+
+			DirectoryWatcher->RegisterDirectoryChangedCallback_Handle(
+				WatchedScriptsDir,
+				IDirectoryWatcher::FDirectoryChanged::CreateRaw(this, &FTsuEditorModule::OnScriptsChanged),
+				ScriptsWatcherHandle);
+		}
+	}
+
+	void UnregisterScriptsWatcher()
+	{
+		if (!ScriptsWatcherHandle.IsValid())
+			return;
+
+		if (auto DirectoryWatcherModule = FModuleManager::GetModulePtr<FDirectoryWatcherModule>("DirectoryWatcher"))
+		{
+			if (IDirectoryWatcher* DirectoryWatcher = DirectoryWatcherModule->Get())
+				DirectoryWatcher->UnregisterDirectoryChangedCallback_Handle(WatchedScriptsDir, ScriptsWatcherHandle);
+		}
+
+		ScriptsWatcherHandle.Reset();
+	}
+
+	void WarmUpParser()
+	{
+		FTsuParser::WarmUp();
+
+		int32 Loaded = 0;
+		int32 Total = 0;
+		FTsuParser::GetWarmUpProgress(Loaded, Total);
+		if (Total == 0)
+			return;
+
+		FNotificationInfo Info(GetWarmUpText(Loaded, Total));
+		Info.Image = FTsuEditorStyle::Get().GetBrush(TEXT("ClassIcon.TsuBlueprint.Large"));
+		Info.FadeOutDuration = 0.5f;
+		Info.ExpireDuration = 2.0f;
+		Info.bFireAndForget = false;
+		Info.bUseThrobber = true;
+		Info.bUseSuccessFailIcons = true;
+		Info.bUseLargeFont = false;
+
+		WarmUpNotification = FSlateNotificationManager::Get().AddNotification(Info);
+		if (!WarmUpNotification.IsValid())
+			return;
+
+		WarmUpNotification->SetCompletionState(SNotificationItem::CS_Pending);
+
+		WarmUpTickerHandle = FTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateRaw(this, &FTsuEditorModule::OnWarmUpTick),
+			0.1f);
+	}
+
+	bool OnWarmUpTick(float /*DeltaTime*/)
+	{
+		int32 Loaded = 0;
+		int32 Total = 0;
+		FTsuParser::GetWarmUpProgress(Loaded, Total);
+
+		WarmUpNotification->SetText(GetWarmUpText(Loaded, Total));
+
+		// The total drops to zero if a parser process had to be relaunched, in which case it's no longer warming up
+		if (Loaded < Total)
+			return true;
+
+		WarmUpNotification->SetCompletionState(SNotificationItem::CS_Success);
+		WarmUpNotification->ExpireAndFadeout();
+		WarmUpNotification.Reset();
+		WarmUpTickerHandle.Reset();
+
+		return false;
+	}
+
+	static FText GetWarmUpText(int32 Loaded, int32 Total)
+	{
+		return FText::FromString(
+			Loaded < Total
+				? FString::Printf(TEXT("Warming up TypeScript parser (%d/%d)"), Loaded, Total)
+				: FString(TEXT("TypeScript parser ready")));
+	}
+
+	void OnScriptsChanged(const TArray<FFileChangeData>& Changes)
+	{
+		if (Changes.Num() > 0)
+			FTsuContext::InvalidateResolutions();
+
+		// Send the parse requests as soon as the files change, rather than when they eventually get reimported, so
+		// that the parser can work through them while the editor waits for the changes to settle
+		for (const FFileChangeData& Change : Changes)
+		{
+			if (Change.Action != FFileChangeData::FCA_Added && Change.Action != FFileChangeData::FCA_Modified)
+				continue;
+
+			if (!Change.Filename.EndsWith(TEXT(".ts")) || Change.Filename.EndsWith(TEXT(".d.ts")))
+				continue;
+
+			FString Filename = Change.Filename;
+			FPaths::NormalizeFilename(Filename);
+			if (!FPaths::IsUnderDirectory(Filename, WatchedSourceDir))
+				continue;
+
+			// Scripts changed during PIE get hot reloaded, which only needs them transpiled
+			const ETsuParseMode Mode = (GEditor && GEditor->PlayWorld)
+				? ETsuParseMode::TranspileOnly
+				: ETsuParseMode::Full;
+
+			FTsuParser::Request(Change.Filename, true, Mode);
+		}
+	}
+
 	void OnBlueprintPreCompile(UBlueprint* Blueprint)
 	{
 		Blueprint->OnCompiled().AddRaw(this, &FTsuEditorModule::OnBlueprintCompiled);
@@ -175,6 +317,11 @@ private:
 	}
 
 	TArray<TSharedRef<IAssetTypeActions>> AssetTypeActions;
+	FString WatchedScriptsDir;
+	FString WatchedSourceDir;
+	FDelegateHandle ScriptsWatcherHandle;
+	TSharedPtr<SNotificationItem> WarmUpNotification;
+	FDelegateHandle WarmUpTickerHandle;
 };
 
 IMPLEMENT_MODULE(FTsuEditorModule, TsuEditor)
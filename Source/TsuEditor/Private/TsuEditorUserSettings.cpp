@@ -145,6 +145,8 @@ UTsuEditorUserSettings::UTsuEditorUserSettings(const FObjectInitializer& ObjectI
 	bUseTextEditorPreset = true;
 	TextEditorPreset = ETsuTextEditor::Notepad;
 	TsuEditorModule_Private::GetEditorDetails(TextEditorPreset, TextEditorPath, TextEditorArgs);
+	NumParserProcesses = 0;
+	ParserRequestTimeout = 5.f;
 }
 
 void UTsuEditorUserSettings::PostInitProperties()
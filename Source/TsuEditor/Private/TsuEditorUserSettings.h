@@ -47,4 +47,19 @@ public:
 	/** Arguments to provide the editor executable when opening associated TypeScript files */
 	UPROPERTY(EditAnywhere, Config, Category="Text Editor", meta=(DisplayName="Editor Arguments", EditCondition="!bUseTextEditorPreset"))
 	FString TextEditorArgs;
+
+	/**
+	 * Number of parser processes to spread TypeScript compilation across, where 0 uses one or two depending on the
+	 * number of cores. More processes speed up compiling many scripts at once, but each process keeps its own copy of
+	 * the program in memory. Takes effect after restarting the editor.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category="Parser", meta=(DisplayName="Parser Processes", ClampMin="0", UIMin="0"))
+	int32 NumParserProcesses;
+
+	/**
+	 * Seconds to wait for the parser to make any progress on a request before considering it unresponsive, at which
+	 * point the parser is terminated and relaunched by the next request.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category="Parser", meta=(DisplayName="Request Timeout", ClampMin="0.1", UIMin="0.1", Units="s"))
+	float ParserRequestTimeout;
 };
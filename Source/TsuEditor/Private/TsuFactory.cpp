@@ -6,6 +6,7 @@
 #include "TsuEditorLog.h"
 #include "TsuEditorStyle.h"
 #include "TsuHotReloadListenerInterface.h"
+#include "TsuParser.h"
 
 #include "Containers/Set.h"
 #include "Editor.h"
@@ -151,7 +152,12 @@ UTsuBlueprint* UTsuFactory::UpdateBlueprint(
 		bool bHasErrors = false;
 		bool bHasWarnings = false;
 
-		TArray<FTsuCompilationMessage> Messages = FTsuBlueprintCompiler::CompileScript(CurrentFilename, GeneratedClass->Exports);
+		// Skip type-checking while playing, to get the change running as soon as possible. The script is type-checked
+		// in the background instead, and is fully compiled once PIE ends.
+		TArray<FTsuCompilationMessage> Messages = FTsuBlueprintCompiler::CompileScript(
+			CurrentFilename,
+			GeneratedClass->Exports,
+			ETsuParseMode::TranspileOnly);
 		for (const FTsuCompilationMessage& Message : Messages)
 		{
 			switch (Message.Severity)
@@ -1,17 +1,215 @@
 #include "TsuParser.h"
 
 #include "TsuEditorLog.h"
+#include "TsuEditorUserSettings.h"
 #include "TsuPaths.h"
 #include "TsuReplProcess.h"
+#include "TsuTypings.h"
 
+#include "Async/Async.h"
+#include "Async/Future.h"
 #include "Containers/Queue.h"
+#include "Containers/Ticker.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformMisc.h"
 #include "HAL/PlatformProcess.h"
 #include "JsonObjectConverter.h"
+#include "Logging/MessageLog.h"
+#include "Misc/Paths.h"
 #include "Misc/ScopeExit.h"
 
-bool FTsuParser::Parse(const FString& FilePath, FTsuParsedFile& Response)
+namespace TsuParser_Private
 {
-	static TOptional<FTsuReplProcess> Process;
+
+/**
+ * One of the processes in the parser pool. Each process has its own language service, so files stick to the process
+ * they were first sent to, in order to keep hitting a warm language service.
+ */
+struct FParserProcess
+{
+	TOptional<FTsuReplProcess> Process;
+
+	/** Requests yet to be sent, which are sent together as one batch by `FlushRequests` */
+	TArray<FTsuParserRequestFile> QueuedRequests;
+
+	/** Number of files that have been assigned to this process */
+	int32 NumFiles = 0;
+
+	/** When the parser last responded, which lets queued requests wait for as long as it keeps making progress */
+	double LastResponseTime = 0.0;
+
+	/** Progress of the warm-up, updated from the reader thread */
+	int32 WarmUpLoaded = 0;
+	int32 WarmUpTotal = 0;
+};
+
+/** The pool of parser processes, which is sized on first use */
+TArray<TUniquePtr<FParserProcess>> Processes;
+uint32 NextRequestId = 1;
+
+struct FPendingResponse
+{
+	TPromise<TOptional<FString>> Promise;
+	FParserProcess* Parser = nullptr;
+};
+
+/** Responses yet to be received, by request ID. Accessed from both the game thread and the reader threads. */
+FCriticalSection PendingLock;
+TMap<uint32, FPendingResponse> PendingResponses;
+
+struct FInFlightRequest
+{
+	TFuture<TOptional<FString>> Future;
+	FParserProcess* Parser = nullptr;
+	ETsuParseMode Mode = ETsuParseMode::Full;
+	double SendTime = 0.0;
+
+	/** The generation of the typings at the time of the request, see `FTsuTypings::GetGeneration` */
+	uint32 TypingsGeneration = 0;
+
+	/**
+	 * Whether the response to this request can stand in for a request with the given mode. Requests sent before any
+	 * typings were written since can't, as they might have been parsed against outdated typings.
+	 */
+	bool Satisfies(ETsuParseMode OtherMode) const
+	{
+		if (TypingsGeneration != FTsuTypings::GetGeneration())
+			return false;
+
+		return Mode == OtherMode || (Mode == ETsuParseMode::Full && OtherMode == ETsuParseMode::TranspileOnly);
+	}
+};
+
+/** Requests made through `FTsuParser::Request`, by normalized file path. Only accessed from the game thread. */
+TMap<FString, FInFlightRequest> InFlightRequests;
+
+/** The process that each file has been assigned to, by normalized file path */
+TMap<FString, FParserProcess*> FileAffinity;
+
+FDelegateHandle FlushTickerHandle;
+
+/** Processes beyond this many are left to launch on their first request rather than being warmed up at startup */
+const int32 MaxWarmUpProcesses = 2;
+
+double GetRequestTimeout()
+{
+	return FMath::Max(GetDefault<UTsuEditorUserSettings>()->ParserRequestTimeout, 0.1f);
+}
+
+int32 GetNumProcesses()
+{
+	const int32 NumProcesses = GetDefault<UTsuEditorUserSettings>()->NumParserProcesses;
+	if (NumProcesses > 0)
+		return NumProcesses;
+
+	// Every process holds on to its own copy of the program, which can run into gigabytes for larger projects, so
+	// anything beyond a second process has to be opted into through the settings
+	return FPlatformMisc::NumberOfCores() >= 8 ? 2 : 1;
+}
+
+void ReportTypeCheck(const FTsuParserNotification& Result)
+{
+	const FString FileName = FPaths::GetCleanFilename(Result.File);
+
+	if (Result.Errors.Num() == 0)
+	{
+		UE_LOG(LogTsuEditor, Log, TEXT("Type-checked '%s' without errors"), *FileName);
+		return;
+	}
+
+	// Transpile-only requests are made when hot reloading during PIE, so report them alongside the other PIE errors
+	FMessageLog MessageLog{TEXT("PIE")};
+
+	for (const FString& Error : Result.Errors)
+	{
+		UE_LOG(LogTsuEditor, Error, TEXT("%s"), *Error);
+		MessageLog.Error(FText::FromString(Error));
+	}
+
+	MessageLog.Notify(FText::FromString(FString::Printf(TEXT("Error(s) type-checking '%s'"), *FileName)));
+}
+
+void OnMessage(FParserProcess* Parser, uint32 Id, FString&& Message)
+{
+	{
+		// Notifications count as progress as well, since the parser might be busy warming up, type-checking or bundling
+		FScopeLock ScopeLock{&PendingLock};
+		Parser->LastResponseTime = FPlatformTime::Seconds();
+	}
+
+	if (Id == 0)
+	{
+		FTsuParserNotification Notification;
+		if (!FJsonObjectConverter::JsonObjectStringToUStruct(Message, &Notification, 0, 0))
+		{
+			UE_LOG(LogTsuEditor, Error, TEXT("Failed to deserialize parser notification: '%s'"), *Message);
+			return;
+		}
+
+		if (Notification.Kind == TEXT("warmUp"))
+		{
+			FScopeLock ScopeLock{&PendingLock};
+			Parser->WarmUpLoaded = Notification.Loaded;
+			Parser->WarmUpTotal = Notification.Total;
+		}
+		else if (Notification.Kind == TEXT("typeCheck"))
+		{
+			AsyncTask(ENamedThreads::GameThread, [Notification = MoveTemp(Notification)]
+			{
+				ReportTypeCheck(Notification);
+			});
+		}
+
+		return;
+	}
+
+	FScopeLock ScopeLock{&PendingLock};
+
+	FPendingResponse* PendingResponse = PendingResponses.Find(Id);
+	if (!PendingResponse)
+	{
+		UE_LOG(LogTsuEditor, Warning, TEXT("Received parser response for unknown request %u"), Id);
+		return;
+	}
+
+	PendingResponse->Promise.SetValue(MoveTemp(Message));
+	PendingResponses.Remove(Id);
+}
+
+void OnClosed(FParserProcess* Parser)
+{
+	FScopeLock ScopeLock{&PendingLock};
+
+	for (auto It = PendingResponses.CreateIterator(); It; ++It)
+	{
+		if (It.Value().Parser == Parser)
+		{
+			It.Value().Promise.SetValue(TOptional<FString>{});
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void ResetRequests(FParserProcess* Parser)
+{
+	// Any requests still in flight were failed when the process closed
+	for (auto It = InFlightRequests.CreateIterator(); It; ++It)
+	{
+		if (It.Value().Parser == Parser)
+			It.RemoveCurrent();
+	}
+
+	Parser->QueuedRequests.Reset();
+
+	// A relaunched process starts out cold, but isn't warmed up again
+	FScopeLock ScopeLock{&PendingLock};
+	Parser->WarmUpLoaded = 0;
+	Parser->WarmUpTotal = 0;
+}
+
+bool EnsureProcess(FParserProcess* Parser)
+{
+	TOptional<FTsuReplProcess>& Process = Parser->Process;
 
 	if (Process && !Process->IsRunning())
 	{
@@ -23,15 +221,23 @@ bool FTsuParser::Parse(const FString& FilePath, FTsuParsedFile& Response)
 		}
 
 		Process.Reset();
+		ResetRequests(Parser);
 	}
 
 	if (!Process)
 	{
 		UE_LOG(LogTsuEditor, Log, TEXT("Starting parser..."));
 
-		const FString ParserPath = FTsuPaths::ParserPath();
-		const FString ParserArgs = FString::Printf(TEXT("\"%s\""), *FTsuPaths::ScriptsDir());
-		Process = FTsuReplProcess::Launch(FTsuPaths::ParserPath(), ParserArgs);
+		const FString ParserArgs = FString::Printf(
+			TEXT("\"%s\" \"%s\""),
+			*FPaths::ConvertRelativePathToFull(FTsuPaths::ScriptsDir()),
+			*FPaths::ConvertRelativePathToFull(FTsuPaths::ParserCacheDir()));
+
+		Process = FTsuReplProcess::Launch(
+			FTsuPaths::ParserPath(),
+			ParserArgs,
+			[Parser](uint32 Id, FString&& Message) { OnMessage(Parser, Id, MoveTemp(Message)); },
+			[Parser] { OnClosed(Parser); });
 
 		if (!Process)
 		{
@@ -40,38 +246,299 @@ bool FTsuParser::Parse(const FString& FilePath, FTsuParsedFile& Response)
 		}
 	}
 
+	return true;
+}
+
+void TerminateProcess(FParserProcess* Parser)
+{
+	if (Parser->Process)
+	{
+		UE_LOG(LogTsuEditor, Log, TEXT("Terminating parser..."));
+		Parser->Process.Reset();
+	}
+
+	ResetRequests(Parser);
+}
+
+void LogProcessError(FParserProcess* Parser)
+{
+	if (!Parser->Process)
+		return;
+
+	if (TOptional<FString> Error = Parser->Process->ReadError())
+	{
+		UE_LOG(LogTsuEditor, Error, TEXT("\n%s"), *Error.GetValue());
+	}
+}
+
+FString GetRequestKey(const FString& FilePath)
+{
+	FString Key = FPaths::ConvertRelativePathToFull(FilePath);
+	FPaths::NormalizeFilename(Key);
+	return Key;
+}
+
+FParserProcess* GetProcessForFile(const FString& Key)
+{
+	if (FParserProcess** Parser = FileAffinity.Find(Key))
+		return *Parser;
+
+	if (Processes.Num() == 0)
+	{
+		const int32 NumProcesses = GetNumProcesses();
+		for (int32 Index = 0; Index < NumProcesses; ++Index)
+			Processes.Emplace(MakeUnique<FParserProcess>());
+	}
+
+	// Spread new files evenly across the pool, so that a full reimport keeps every process busy
+	FParserProcess* Parser = Processes[0].Get();
+	for (const TUniquePtr<FParserProcess>& Other : Processes)
+	{
+		if (Other->NumFiles < Parser->NumFiles)
+			Parser = Other.Get();
+	}
+
+	Parser->NumFiles += 1;
+	FileAffinity.Add(Key, Parser);
+
+	return Parser;
+}
+
+void FlushRequests(FParserProcess* Parser)
+{
+	if (Parser->QueuedRequests.Num() == 0 || !Parser->Process)
+		return;
+
 	FTsuParserRequest Request;
-	Request.File = FilePath;
+	Request.Files = MoveTemp(Parser->QueuedRequests);
 
 	FString RequestJson;
 	if (!FJsonObjectConverter::UStructToJsonObjectString(Request, RequestJson, 0, 0, 0, nullptr, false))
 	{
 		UE_LOG(LogTsuEditor, Error, TEXT("Failed to serialize request"));
-		return false;
+		TerminateProcess(Parser);
+		return;
 	}
 
-	if (!Process->Write(RequestJson))
+	// The parser responds to each file using the ID that came with it, so the batch itself doesn't need an ID
+	if (!Parser->Process->Write(0, RequestJson))
 	{
 		UE_LOG(LogTsuEditor, Error, TEXT("Failed to write parser request"));
-		UE_LOG(LogTsuEditor, Log, TEXT("Terminating parser..."));
+		TerminateProcess(Parser);
+		return;
+	}
 
-		Process.Reset();
+	const double SendTime = FPlatformTime::Seconds();
+	for (auto& InFlightRequest : InFlightRequests)
+	{
+		if (InFlightRequest.Value.Parser == Parser && InFlightRequest.Value.SendTime == 0.0)
+			InFlightRequest.Value.SendTime = SendTime;
+	}
+}
+
+void FlushAllRequests()
+{
+	for (const TUniquePtr<FParserProcess>& Parser : Processes)
+		FlushRequests(Parser.Get());
+}
+
+bool QueueRequest(const FString& Key, const FString& FilePath, ETsuParseMode Mode)
+{
+	FParserProcess* Parser = GetProcessForFile(Key);
+	if (!EnsureProcess(Parser))
 		return false;
+
+	FTsuParserRequestFile& QueuedRequest = Parser->QueuedRequests.AddDefaulted_GetRef();
+	QueuedRequest.Id = NextRequestId++;
+	QueuedRequest.File = FilePath;
+	QueuedRequest.TranspileOnly = (Mode == ETsuParseMode::TranspileOnly);
+	QueuedRequest.Production = (Mode == ETsuParseMode::Production);
+
+	FInFlightRequest InFlight;
+	InFlight.Parser = Parser;
+	InFlight.Mode = Mode;
+	InFlight.TypingsGeneration = FTsuTypings::GetGeneration();
+
+	{
+		FScopeLock ScopeLock{&PendingLock};
+
+		FPendingResponse& PendingResponse = PendingResponses.Add(QueuedRequest.Id);
+		PendingResponse.Parser = Parser;
+		InFlight.Future = PendingResponse.Promise.GetFuture();
 	}
 
-	const TOptional<FString> ResponseJson = Process->ReadOutput();
-	if (!ResponseJson)
+	// A replaced request is still answered by the parser, but nothing will be waiting for its response
+	InFlightRequests.Add(Key, MoveTemp(InFlight));
+
+	// Anything not flushed by a call to `Parse` goes out on the next tick
+	if (!FlushTickerHandle.IsValid())
 	{
-		UE_LOG(LogTsuEditor, Error, TEXT("Parser request timed out"));
+		FlushTickerHandle = FTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateLambda([](float /*DeltaTime*/)
+			{
+				FlushTickerHandle.Reset();
+				FlushAllRequests();
+				return false;
+			}));
+	}
+
+	return true;
+}
+
+} // namespace TsuParser_Private
+
+void FTsuParser::WarmUp()
+{
+	using namespace TsuParser_Private;
+
+	// The typings might still be getting written in the background, and the generation has already been bumped by
+	// then, so the parser would otherwise load half-written typings and cache responses out of them as current
+	FTsuTypings::WaitForPendingWrites();
 
-		if (TOptional<FString> Error = Process->ReadError())
+	TArray<FString> ScriptPaths;
+	IFileManager::Get().FindFilesRecursive(
+		ScriptPaths,
+		*FPaths::ConvertRelativePathToFull(FTsuPaths::ScriptsSourceDir()),
+		TEXT("*.ts"),
+		true, // Files
+		false); // Directories
+
+	// Assigning the scripts up front means that each process only loads the scripts that it'll later be asked for
+	TMap<FParserProcess*, TArray<FString>> ScriptsByProcess;
+	int32 NumScripts = 0;
+
+	for (const FString& ScriptPath : ScriptPaths)
+	{
+		if (ScriptPath.EndsWith(TEXT(".d.ts")))
+			continue;
+
+		const FString Key = GetRequestKey(ScriptPath);
+		ScriptsByProcess.FindOrAdd(GetProcessForFile(Key)).Add(Key);
+		NumScripts += 1;
+	}
+
+	UE_LOG(LogTsuEditor, Log, TEXT("Warming up parser with %d script(s)..."), NumScripts);
+
+	const int32 NumWarmUpProcesses = FMath::Min(Processes.Num(), MaxWarmUpProcesses);
+	for (int32 Index = 0; Index < NumWarmUpProcesses; ++Index)
+	{
+		FParserProcess* Parser = Processes[Index].Get();
+
+		TArray<FString>* Scripts = ScriptsByProcess.Find(Parser);
+		if (!Scripts || !EnsureProcess(Parser))
+			continue;
+
+		FTsuParserRequest Request;
+		Request.WarmUp = MoveTemp(*Scripts);
+
+		FString RequestJson;
+		if (!FJsonObjectConverter::UStructToJsonObjectString(Request, RequestJson, 0, 0, 0, nullptr, false))
 		{
-			UE_LOG(LogTsuEditor, Error, TEXT("\n%s"), *Error.GetValue());
+			UE_LOG(LogTsuEditor, Error, TEXT("Failed to serialize request"));
+			continue;
 		}
 
-		UE_LOG(LogTsuEditor, Log, TEXT("Terminating parser..."));
+		{
+			FScopeLock ScopeLock{&PendingLock};
+			Parser->WarmUpLoaded = 0;
+			Parser->WarmUpTotal = Request.WarmUp.Num();
+		}
 
-		Process.Reset();
+		if (!Parser->Process->Write(0, RequestJson))
+		{
+			UE_LOG(LogTsuEditor, Error, TEXT("Failed to write parser request"));
+			TerminateProcess(Parser);
+		}
+	}
+}
+
+void FTsuParser::GetWarmUpProgress(int32& OutLoaded, int32& OutTotal)
+{
+	using namespace TsuParser_Private;
+
+	OutLoaded = 0;
+	OutTotal = 0;
+
+	FScopeLock ScopeLock{&PendingLock};
+
+	for (const TUniquePtr<FParserProcess>& Parser : Processes)
+	{
+		OutLoaded += Parser->WarmUpLoaded;
+		OutTotal += Parser->WarmUpTotal;
+	}
+}
+
+void FTsuParser::Request(const FString& FilePath, bool bReplaceExisting, ETsuParseMode Mode)
+{
+	using namespace TsuParser_Private;
+
+	const FString Key = GetRequestKey(FilePath);
+	if (!bReplaceExisting)
+	{
+		const FInFlightRequest* Existing = InFlightRequests.Find(Key);
+		if (Existing && Existing->Satisfies(Mode))
+			return;
+	}
+
+	QueueRequest(Key, FilePath, Mode);
+}
+
+bool FTsuParser::Parse(const FString& FilePath, FTsuParsedFile& Response, ETsuParseMode Mode)
+{
+	using namespace TsuParser_Private;
+
+	const FString Key = GetRequestKey(FilePath);
+	const FInFlightRequest* Existing = InFlightRequests.Find(Key);
+	if ((!Existing || !Existing->Satisfies(Mode)) && !QueueRequest(Key, FilePath, Mode))
+		return false;
+
+	// Send this request along with any others that have been queued up, e.g. by the other blueprints in a batch
+	FlushAllRequests();
+
+	TOptional<FInFlightRequest> InFlight;
+	if (FInFlightRequest* Existing = InFlightRequests.Find(Key))
+	{
+		InFlight = MoveTemp(*Existing);
+		InFlightRequests.Remove(Key);
+	}
+
+	if (!InFlight)
+		return false;
+
+	FParserProcess* Parser = InFlight->Parser;
+	TFuture<TOptional<FString>>& Future = InFlight->Future;
+
+	const double RequestTimeout = GetRequestTimeout();
+
+	// Only time out once the parser has stopped responding, since this request might be queued behind others
+	for (;;)
+	{
+		double LastProgressTime = 0.0;
+
+		{
+			FScopeLock ScopeLock{&PendingLock};
+			LastProgressTime = FMath::Max(InFlight->SendTime, Parser->LastResponseTime);
+		}
+
+		const double TimeLeft = LastProgressTime + RequestTimeout - FPlatformTime::Seconds();
+		if (TimeLeft <= 0.0)
+		{
+			UE_LOG(LogTsuEditor, Error, TEXT("Parser request timed out"));
+			LogProcessError(Parser);
+			TerminateProcess(Parser);
+			return false;
+		}
+
+		if (Future.WaitFor(FTimespan::FromSeconds(TimeLeft)))
+			break;
+	}
+
+	const TOptional<FString> ResponseJson = Future.Get();
+	if (!ResponseJson)
+	{
+		UE_LOG(LogTsuEditor, Error, TEXT("Parser terminated before responding"));
+		LogProcessError(Parser);
+		TerminateProcess(Parser);
 		return false;
 	}
 
@@ -6,16 +6,115 @@
 
 #include "TsuParser.generated.h"
 
+enum class ETsuParseMode : uint8
+{
+	/** Type-checks the file, and extracts its exports and dependencies along with the emitted source */
+	Full,
+
+	/**
+	 * Only emits the source, which is enough for hot reloading a module. The file is then type-checked in the
+	 * background, with any errors being reported to the message log.
+	 */
+	TranspileOnly,
+
+	/**
+	 * Parses the file like `Full`, but emits the source the way it's cooked, which is with `__DEV__` defined as false,
+	 * unreachable code and logging calls removed, and minified. The source map is written next to the source rather
+	 * than inlined.
+	 */
+	Production
+};
+
+USTRUCT()
+struct TSUEDITOR_API FTsuParserRequestFile
+{
+	GENERATED_BODY()
+
+	/** The ID of the message that the parser responds with */
+	UPROPERTY()
+	uint32 Id = 0;
+
+	UPROPERTY()
+	FString File;
+
+	UPROPERTY()
+	bool TranspileOnly = false;
+
+	UPROPERTY()
+	bool Production = false;
+};
+
+/** A batch of files to be parsed out of the same program, with one response being sent for each file */
 USTRUCT()
 struct TSUEDITOR_API FTsuParserRequest
 {
 	GENERATED_BODY()
 
+	UPROPERTY()
+	TArray<FTsuParserRequestFile> Files;
+
+	/** Files to load into the language service ahead of time, which aren't responded to */
+	UPROPERTY()
+	TArray<FString> WarmUp;
+};
+
+/** Sent by the parser outside of any response, using an ID of 0 */
+USTRUCT()
+struct TSUEDITOR_API FTsuParserNotification
+{
+	GENERATED_BODY()
+
+	/**
+	 * Either `typeCheck`, sent once the parser is done type-checking a file that was requested with
+	 * `ETsuParseMode::TranspileOnly`, `warmUp`, sent as the parser makes progress on warming up, or `progress`, sent
+	 * when the response to a file is held back until its source has been bundled
+	 */
+	UPROPERTY()
+	FString Kind;
+
 	UPROPERTY()
 	FString File;
+
+	UPROPERTY()
+	TArray<FString> Errors;
+
+	UPROPERTY()
+	int32 Loaded = 0;
+
+	UPROPERTY()
+	int32 Total = 0;
 };
 
 struct TSUEDITOR_API FTsuParser
 {
-	static bool Parse(const FString& FilePath, FTsuParsedFile& Response);
+	/**
+	 * Launches the parser processes ahead of the first compile, and has them load the project's scripts, along with
+	 * the typings they depend on, so that the first compile doesn't have to pay for any of it.
+	 */
+	static void WarmUp();
+
+	/** How many of the scripts sent by `WarmUp` have been loaded so far, out of how many in total */
+	static void GetWarmUpProgress(int32& OutLoaded, int32& OutTotal);
+
+	/**
+	 * Sends a request to parse a file without waiting for the response, which is instead picked up by the next call
+	 * to `Parse` for the same file. Requests are handled in the order they're sent, so sending them early lets the
+	 * parser work through them while the editor is busy with other things.
+	 *
+	 * Requests are queued up and sent as one batch, either on the next tick or on the next call to `Parse`, which
+	 * lets the parser check the files they have in common only once.
+	 *
+	 * @param bReplaceExisting Whether to send a new request even if one is already in flight, e.g. because the file
+	 * has changed since it was sent
+	 */
+	static void Request(
+		const FString& FilePath,
+		bool bReplaceExisting = false,
+		ETsuParseMode Mode = ETsuParseMode::Full);
+
+	/** Parses a file, waiting for the response to an earlier `Request` if there is one */
+	static bool Parse(
+		const FString& FilePath,
+		FTsuParsedFile& Response,
+		ETsuParseMode Mode = ETsuParseMode::Full);
 };
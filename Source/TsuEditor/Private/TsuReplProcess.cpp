@@ -6,7 +6,9 @@
 #include "TsuEditorLog.h"
 
 #include "HAL/PlatformTime.h"
+#include "HAL/Runnable.h"
 #include "HAL/RunnableThread.h"
+#include "Misc/Parse.h"
 
 #if PLATFORM_WINDOWS
 
@@ -89,58 +91,161 @@ static FProcHandle CreateProc(
 	return FProcHandle(Process.hProcess);
 }
 
-#include "Windows/HideWindowsPlatformTypes.h"
-
-#else // PLATFORM_WINDOWS
-
-static bool CreateOutputPipes(void*& ReadPipe, void*& WritePipe)
+static bool ReadFromPipeBlocking(void* Pipe, uint8* Buffer, int32 BufferSize, int32& OutBytesRead)
 {
-	return FPlatformProcess::CreatePipe(ReadPipe, WritePipe);
+	DWORD BytesRead = 0;
+	if (!::ReadFile((::HANDLE)Pipe, Buffer, (DWORD)BufferSize, &BytesRead, nullptr))
+		return false;
+
+	OutBytesRead = (int32)BytesRead;
+	return BytesRead > 0;
 }
 
-static bool CreateInputPipes(void*& ReadPipe, void*& WritePipe)
+static bool WriteToPipe(void* Pipe, const uint8* Data, int32 Size)
 {
-	return FPlatformProcess::CreatePipe(ReadPipe, WritePipe);
+	while (Size > 0)
+	{
+		DWORD BytesWritten = 0;
+		if (!::WriteFile((::HANDLE)Pipe, Data, (DWORD)Size, &BytesWritten, nullptr))
+			return false;
+
+		Data += BytesWritten;
+		Size -= (int32)BytesWritten;
+	}
+
+	return true;
 }
 
-static FProcHandle CreateProc(
-	const TCHAR* URL,
-	const TCHAR* Parms,
-	void* StdOutWrite,
-	void* StdErrWrite,
-	void* StdInRead)
+static bool TieToEditorLifetime(FProcHandle& ProcessHandle)
 {
-#error Not implemented
+	static HANDLE JobHandle = []
+	{
+		HANDLE Result = CreateJobObject(NULL, NULL);
+		check(Result != NULL);
+		JOBOBJECT_EXTENDED_LIMIT_INFORMATION LimitInformation = {};
+		LimitInformation.BasicLimitInformation.LimitFlags = JOB_OBJECT_LIMIT_KILL_ON_JOB_CLOSE;
+		verify(SetInformationJobObject(Result, JobObjectExtendedLimitInformation, &LimitInformation, sizeof(LimitInformation)));
+		return Result;
+	}();
+
+	return AssignProcessToJobObject(JobHandle, ProcessHandle.Get()) != FALSE;
 }
 
+#include "Windows/HideWindowsPlatformTypes.h"
+
+#else // PLATFORM_WINDOWS
+#error Not implemented
 #endif // PLATFORM_WINDOWS
 
+namespace TsuReplProcess_Private
+{
+
+class FReader final
+	: public FRunnable
+{
+public:
+	FReader(void* InPipe, FTsuReplProcess::FOnMessage InOnMessage, FTsuReplProcess::FOnClosed InOnClosed)
+		: Pipe(InPipe)
+		, OnMessage(MoveTemp(InOnMessage))
+		, OnClosed(MoveTemp(InOnClosed))
+	{
+	}
+
+	uint32 Run() override
+	{
+		TArray<uint8> Buffer;
+		uint8 Chunk[64 * 1024];
+
+		int32 BytesRead = 0;
+		while (ReadFromPipeBlocking(Pipe, Chunk, sizeof(Chunk), BytesRead))
+		{
+			Buffer.Append(Chunk, BytesRead);
+			ReadMessages(Buffer);
+		}
+
+		if (OnClosed)
+			OnClosed();
+
+		return 0;
+	}
+
+private:
+	void ReadMessages(TArray<uint8>& Buffer)
+	{
+		int32 Offset = 0;
+
+		for (;;)
+		{
+			int32 HeaderEnd = INDEX_NONE;
+			for (int32 Index = Offset; Index < Buffer.Num(); ++Index)
+			{
+				if (Buffer[Index] == '\n')
+				{
+					HeaderEnd = Index;
+					break;
+				}
+			}
+
+			if (HeaderEnd == INDEX_NONE)
+				break;
+
+			const FString Header{HeaderEnd - Offset, (const ANSICHAR*)Buffer.GetData() + Offset};
+
+			FString IdString;
+			FString LengthString;
+			if (!Header.TrimStartAndEnd().Split(TEXT(" "), &IdString, &LengthString) || !LengthString.IsNumeric())
+			{
+				// Most likely something written directly to stdout, like a stray console.log
+				UE_LOG(LogTsuEditor, Warning, TEXT("Ignoring unexpected output: '%s'"), *Header);
+				Offset = HeaderEnd + 1;
+				continue;
+			}
+
+			const int32 Length = FCString::Atoi(*LengthString);
+			const int32 MessageStart = HeaderEnd + 1;
+			if (Buffer.Num() - MessageStart < Length)
+				break;
+
+			const FUTF8ToTCHAR Converted{(const ANSICHAR*)Buffer.GetData() + MessageStart, Length};
+			OnMessage((uint32)FCString::Strtoui64(*IdString, nullptr, 10), FString{Converted.Length(), Converted.Get()});
+
+			Offset = MessageStart + Length;
+		}
+
+		if (Offset > 0)
+			Buffer.RemoveAt(0, Offset, false);
+	}
+
+	void* Pipe = nullptr;
+	FTsuReplProcess::FOnMessage OnMessage;
+	FTsuReplProcess::FOnClosed OnClosed;
+};
+
+} // namespace TsuReplProcess_Private
+
 FTsuReplProcess::FTsuReplProcess(
 	FProcHandle InProcessHandle,
 	void* InStdOutRead,
-	void* InStdOutWrite,
 	void* InStdErrRead,
-	void* InStdErrWrite,
-	void* InStdInRead,
-	void* InStdInWrite)
+	void* InStdInWrite,
+	FOnMessage OnMessage,
+	FOnClosed OnClosed)
 	: ProcessHandle(InProcessHandle)
 	, StdOutRead(InStdOutRead)
-	, StdOutWrite(InStdOutWrite)
 	, StdErrRead(InStdErrRead)
-	, StdErrWrite(InStdErrWrite)
-	, StdInRead(InStdInRead)
 	, StdInWrite(InStdInWrite)
 {
+	Reader = MakeUnique<TsuReplProcess_Private::FReader>(StdOutRead, MoveTemp(OnMessage), MoveTemp(OnClosed));
+	ReaderThread.Reset(FRunnableThread::Create(Reader.Get(), TEXT("TsuReplProcessReader")));
 }
 
 FTsuReplProcess::FTsuReplProcess(FTsuReplProcess&& Other)
 	: ProcessHandle(Other.ProcessHandle)
 	, StdOutRead(Other.StdOutRead)
-	, StdOutWrite(Other.StdOutWrite)
 	, StdErrRead(Other.StdErrRead)
-	, StdErrWrite(Other.StdErrWrite)
-	, StdInRead(Other.StdInRead)
 	, StdInWrite(Other.StdInWrite)
+	, Reader(MoveTemp(Other.Reader))
+	, ReaderThread(MoveTemp(Other.ReaderThread))
 {
 	Other.ProcessHandle.Reset();
 }
@@ -149,18 +254,28 @@ FTsuReplProcess::~FTsuReplProcess()
 {
 	if (ProcessHandle.IsValid())
 	{
-		FPlatformProcess::ClosePipe(StdOutRead, StdOutWrite);
-		FPlatformProcess::ClosePipe(StdErrRead, StdErrWrite);
-		FPlatformProcess::ClosePipe(StdInRead, StdInWrite);
-
+		// Terminating the process closes its end of the output pipe, which ends the read the reader thread blocks on
 		FPlatformProcess::TerminateProc(ProcessHandle);
+
+		if (ReaderThread)
+			ReaderThread->WaitForCompletion();
+
+		ReaderThread.Reset();
+		Reader.Reset();
+
+		FPlatformProcess::ClosePipe(StdOutRead, nullptr);
+		FPlatformProcess::ClosePipe(StdErrRead, nullptr);
+		FPlatformProcess::ClosePipe(nullptr, StdInWrite);
+
 		FPlatformProcess::CloseProc(ProcessHandle);
 	}
 }
 
 TOptional<FTsuReplProcess> FTsuReplProcess::Launch(
 	const FString& ProcessPath,
-	const FString& ProcessArgs)
+	const FString& ProcessArgs,
+	FOnMessage OnMessage,
+	FOnClosed OnClosed)
 {
 	// #todo(#mihe): This function lacks proper cleanup on failure
 
@@ -195,58 +310,44 @@ TOptional<FTsuReplProcess> FTsuReplProcess::Launch(
 		StdErrWrite,
 		StdInRead);
 
+	// The child has its own copies of these now, and ours would keep the pipes from closing when it terminates
+	FPlatformProcess::ClosePipe(nullptr, StdOutWrite);
+	FPlatformProcess::ClosePipe(nullptr, StdErrWrite);
+	FPlatformProcess::ClosePipe(StdInRead, nullptr);
+
 	if (!ProcessHandle.IsValid())
 	{
 		UE_LOG(LogTsuEditor, Error, TEXT("Failed to create process"));
 		return {};
 	}
 
-#if PLATFORM_WINDOWS
-	static HANDLE JobHandle = []
-	{
-		HANDLE Result = CreateJobObject(NULL, NULL);
-		check(Result != NULL);
-		JOBOBJECT_EXTENDED_LIMIT_INFORMATION LimitInformation = {};
-		LimitInformation.BasicLimitInformation.LimitFlags = JOB_OBJECT_LIMIT_KILL_ON_JOB_CLOSE;
-		verify(SetInformationJobObject(Result, JobObjectExtendedLimitInformation, &LimitInformation, sizeof(LimitInformation)));
-		return Result;
-	}();
-
-	if (!AssignProcessToJobObject(JobHandle, ProcessHandle.Get()))
+	if (!TieToEditorLifetime(ProcessHandle))
 	{
 		UE_LOG(LogTsuEditor, Error, TEXT("Failed to tie process to editor lifetime"));
 		return {};
 	}
-#else // PLATFORM_WINDOWS
-#error Not implemented
-#endif // PLATFORM_WINDOWS
 
 	return FTsuReplProcess(
 		ProcessHandle,
 		StdOutRead,
-		StdOutWrite,
 		StdErrRead,
-		StdErrWrite,
-		StdInRead,
-		StdInWrite);
+		StdInWrite,
+		MoveTemp(OnMessage),
+		MoveTemp(OnClosed));
 }
 
-bool FTsuReplProcess::Write(const FString& Input)
+bool FTsuReplProcess::Write(uint32 Id, const FString& Message)
 {
-	return FPlatformProcess::WritePipe(StdInWrite, Input);
-}
+	const FTCHARToUTF8 Converted{*Message};
+	const FTCHARToUTF8 Header{*FString::Printf(TEXT("%u %d\n"), Id, Converted.Length())};
 
-TOptional<FString> FTsuReplProcess::ReadOutput(double Timeout)
-{
-	return ReadFromPipe(StdOutRead, Timeout);
+	return (
+		WriteToPipe(StdInWrite, (const uint8*)Header.Get(), Header.Length()) &&
+		WriteToPipe(StdInWrite, (const uint8*)Converted.Get(), Converted.Length())
+	);
 }
 
 TOptional<FString> FTsuReplProcess::ReadError(double Timeout)
-{
-	return ReadFromPipe(StdErrRead, Timeout);
-}
-
-TOptional<FString> FTsuReplProcess::ReadFromPipe(void* Pipe, double Timeout)
 {
 	const double StartTime = FPlatformTime::Seconds();
 
@@ -258,14 +359,17 @@ TOptional<FString> FTsuReplProcess::ReadFromPipe(void* Pipe, double Timeout)
 		if (ElapsedTime >= Timeout)
 			return {};
 
-		Output = FPlatformProcess::ReadPipe(Pipe);
+		Output = FPlatformProcess::ReadPipe(StdErrRead);
+
+		if (Output.IsEmpty())
+			FPlatformProcess::Sleep(0.01f);
 	} while (Output.IsEmpty());
 
 	FString Remainder;
 
 	do
 	{
-		Remainder = FPlatformProcess::ReadPipe(Pipe);
+		Remainder = FPlatformProcess::ReadPipe(StdErrRead);
 		Output += Remainder;
 	} while (!Remainder.IsEmpty());
 
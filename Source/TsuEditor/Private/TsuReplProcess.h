@@ -7,9 +7,25 @@
 
 #include "HAL/PlatformProcess.h"
 
+class FRunnable;
+class FRunnableThread;
+
+/**
+ * A child process that is communicated with through framed messages over its standard input/output.
+ *
+ * Each message is a header line of `<id> <length>\n`, followed by `<length>` bytes of UTF-8. Messages written by the
+ * process are read on a dedicated thread, which blocks on the pipe rather than polling it, and are handed to the
+ * message callback on that same thread.
+ */
 class FTsuReplProcess final
 {
 public:
+	/** Called on the reader thread for each message read from the process */
+	using FOnMessage = TFunction<void(uint32 /*Id*/, FString&& /*Message*/)>;
+
+	/** Called on the reader thread once the output of the process has closed, e.g. due to it terminating */
+	using FOnClosed = TFunction<void()>;
+
 	FTsuReplProcess(const FTsuReplProcess& Other) = delete;
 	FTsuReplProcess(FTsuReplProcess&& Other);
 
@@ -20,12 +36,13 @@ public:
 
 	static TOptional<FTsuReplProcess> Launch(
 		const FString& ProcessPath,
-		const FString& ProcessArgs);
+		const FString& ProcessArgs,
+		FOnMessage OnMessage,
+		FOnClosed OnClosed);
 
-	bool Write(const FString& Input);
+	bool Write(uint32 Id, const FString& Message);
 
 	// #todo(#mihe): Move the default values to settings
-	TOptional<FString> ReadOutput(double Timeout = 5.f);
 	TOptional<FString> ReadError(double Timeout = 5.f);
 
 	bool IsRunning() const;
@@ -34,19 +51,15 @@ private:
 	FTsuReplProcess(
 		FProcHandle ProcessHandle,
 		void* StdOutRead,
-		void* StdOutWrite,
 		void* StdErrRead,
-		void* StdErrWrite,
-		void* StdInRead,
-		void* StdInWrite);
-
-	TOptional<FString> ReadFromPipe(void* Pipe, double Timeout);
+		void* StdInWrite,
+		FOnMessage OnMessage,
+		FOnClosed OnClosed);
 
 	mutable FProcHandle ProcessHandle;
 	void* StdOutRead = nullptr;
-	void* StdOutWrite = nullptr;
 	void* StdErrRead = nullptr;
-	void* StdErrWrite = nullptr;
-	void* StdInRead = nullptr;
 	void* StdInWrite = nullptr;
+	TUniquePtr<FRunnable> Reader;
+	TUniquePtr<FRunnableThread> ReaderThread;
 };
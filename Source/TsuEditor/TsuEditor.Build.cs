@@ -23,6 +23,7 @@ public class TsuEditor : ModuleRules
 				"JsonUtilities",
 				"Projects",
 				"SourceControl",
+				"DirectoryWatcher",
 				"TsuUtilities",
 				"TsuRuntime"
 			});
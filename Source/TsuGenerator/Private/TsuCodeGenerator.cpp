@@ -1,37 +1,135 @@
-/**
- * #note(#mihe): This module is not currently used and is only meant to serve as a starting point for future development
- */
-
 #include "TsuCodeGenerator.h"
 
 #include "TsuGeneratorLog.h"
+#include "TsuPaths.h"
 #include "TsuUtilities.h"
+#include "UObject/MetaData.h"
 #include "UObject/UnrealType.h"
+#include "UObject/UObjectIterator.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
-
-// Can't use FRegexMatcher in UHT plugins
-#include <regex>
+#include "Misc/SecureHash.h"
 
 namespace TsuCodeGenerator_Private
 {
 
-void AppendToolTip(FString& Result, UField* Field)
+const TCHAR* GeneratedPreamble = TEXT("// Generated by the TSU generator. Do not modify!\r\n\r\n");
+
+// Must match the structs that have a TBaseStructure specialization
+const TCHAR* SupportedStructs[] =
 {
-	if (!Field->HasMetaData(TEXT("ToolTip")))
-		return;
+	TEXT("Vector"),
+	TEXT("Vector2D"),
+	TEXT("Rotator"),
+	TEXT("Quat"),
+	TEXT("Transform"),
+	TEXT("LinearColor"),
+	TEXT("Color"),
+};
+
+void HashString(FSHA1& Hash, const FString& String)
+{
+	Hash.UpdateWithString(*String, String.Len());
+	Hash.Update((const uint8*)TEXT("\n"), sizeof(TCHAR));
+}
 
-	static const std::wregex NewlinePattern(L"\\r?\\n");
+void HashMetaData(FSHA1& Hash, UObject* Object)
+{
+	if (TMap<FName, FString>* MetaData = UMetaData::GetMapForObject(Object))
+	{
+		for (const auto& Entry : *MetaData)
+		{
+			HashString(Hash, Entry.Key.ToString());
+			HashString(Hash, Entry.Value);
+		}
+	}
+}
 
-	const FString ToolTip = std::regex_replace(
-		*Field->GetMetaData(TEXT("ToolTip")),
-		NewlinePattern,
-		L"\r\n * "
-	).c_str();
+void HashField(FSHA1& Hash, UField* Field)
+{
+	HashString(Hash, Field->GetClass()->GetName());
+	HashString(Hash, Field->GetName());
+	HashMetaData(Hash, Field);
 
-	Result += TEXT("/**\r\n");
-	Result += FString::Printf(TEXT(" * %s\r\n"), *ToolTip);
-	Result += TEXT(" */\r\n");
+	if (auto Property = Cast<UProperty>(Field))
+	{
+		HashString(Hash, Property->GetCPPType());
+		HashString(Hash, FString::Printf(TEXT("%llx"), (uint64)Property->PropertyFlags));
+	}
+	else if (auto Function = Cast<UFunction>(Field))
+	{
+		HashString(Hash, FString::Printf(TEXT("%x"), (uint32)Function->FunctionFlags));
+
+		for (auto It = TFieldIterator<UProperty>(Function); It; ++It)
+			HashField(Hash, *It);
+	}
+}
+
+void HashType(FSHA1& Hash, UField* Type)
+{
+	HashString(Hash, Type->GetPathName());
+	HashMetaData(Hash, Type);
+
+	if (auto Struct = Cast<UStruct>(Type))
+	{
+		if (UStruct* SuperStruct = Struct->GetSuperStruct())
+			HashString(Hash, SuperStruct->GetPathName());
+
+		for (auto It = TFieldIterator<UField>(Struct, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+			HashField(Hash, *It);
+	}
+	else if (auto Enum = Cast<UEnum>(Type))
+	{
+		for (int32 Index = 0; Index < Enum->NumEnums(); ++Index)
+		{
+			HashString(Hash, Enum->GetNameStringByIndex(Index));
+			HashString(Hash, FString::Printf(TEXT("%lld"), Enum->GetValueByIndex(Index)));
+		}
+	}
+}
+
+/** Gets the C++ type of a parameter the way it's declared in the native function signature */
+FString GetParameterTypeCPP(UProperty* Param)
+{
+	FString Type = Param->GetCPPType();
+
+	if (Param->HasAnyPropertyFlags(CPF_ConstParm))
+		Type = TEXT("const ") + Type;
+
+	if (Param->HasAnyPropertyFlags(CPF_ReferenceParm))
+		Type += TEXT("&");
+
+	return Type;
+}
+
+/**
+ * Gets the exact C++ type of the pointer to a native function, which picks the right function when its name is
+ * overloaded in C++, e.g. `FVector(*)(const FVector&, float)` or `void(AActor::*)(bool) const`
+ */
+FString GetFunctionPointerTypeCPP(const FString& ClassNameCPP, UFunction* Function)
+{
+	FString ReturnType = TEXT("void");
+	TArray<FString> ParamTypes;
+
+	for (auto It = TFieldIterator<UProperty>(Function); It; ++It)
+	{
+		UProperty* Param = *It;
+
+		if (Param->HasAnyPropertyFlags(CPF_ReturnParm))
+			ReturnType = Param->GetCPPType();
+		else
+			ParamTypes.Add(GetParameterTypeCPP(Param));
+	}
+
+	const bool bIsStatic = Function->HasAnyFunctionFlags(FUNC_Static);
+	const bool bIsConst = Function->HasAnyFunctionFlags(FUNC_Const);
+
+	return FString::Printf(
+		TEXT("%s(%s*)(%s)%s"),
+		*ReturnType,
+		bIsStatic ? TEXT("") : *(ClassNameCPP + TEXT("::")),
+		*FString::Join(ParamTypes, TEXT(", ")),
+		!bIsStatic && bIsConst ? TEXT(" const") : TEXT(""));
 }
 
 } // namespace TsuCodeGenerator_Private
@@ -50,10 +148,6 @@ FTsuCodeGenerator::FTsuCodeGenerator(
 
 bool FTsuCodeGenerator::SaveHeaderIfChanged(const FString& HeaderPath, const FString& NewHeaderContents)
 {
-	// #hack(#mihe): Remove to make it actually run again
-	if (!HeaderPath.IsEmpty())
-		return false;
-
 	FString OriginalHeaderLocal;
 	FFileHelper::LoadFileToString(OriginalHeaderLocal, *HeaderPath);
 
@@ -113,15 +207,15 @@ FString FTsuCodeGenerator::GetScriptHeaderForClass(UClass* Class)
 
 bool FTsuCodeGenerator::CanExportClass(UClass* Class) const
 {
-	// #hack(#mihe): Remove to make it actually run again
-	if (Class)
-		return false;
-
-	const bool ExportsSymbols = Class->ClassFlags & (CLASS_RequiredAPI | CLASS_MinimalAPI);
+	// The trampolines take the address of the functions, so the whole class needs to be DLL exported
+	const bool ExportsSymbols = Class->HasAnyClassFlags(CLASS_RequiredAPI);
 	const bool HasBeenExported = ExportedClasses.Contains(Class->GetFName());
 	if (!ExportsSymbols || HasBeenExported)
 		return false;
 
+	if (Class->HasAnyClassFlags(CLASS_Interface | CLASS_Deprecated))
+		return false;
+
 	for (auto Function : TImmediateFieldRange<UFunction>(Class))
 	{
 		if (CanExportFunction(Class, Function))
@@ -151,7 +245,7 @@ void FTsuCodeGenerator::ExportClass(UClass* Class, const FString& SourceHeaderFi
 	AllScriptHeaders.Add(ClassGlueFilename);
 
 	const FString ClassNameCPP = GetClassNameCPP(Class);
-	FString GeneratedGlue(TEXT("#pragma once\r\n\r\n"));
+	FString GeneratedGlue(TsuCodeGenerator_Private::GeneratedPreamble);
 
 	for (auto Function : TImmediateFieldRange<UFunction>(Class))
 	{
@@ -179,27 +273,39 @@ bool FTsuCodeGenerator::CanExportFunction(UClass* Class, UFunction* Function)
 	if (Function->FunctionFlags & FUNC_Delegate)
 		return false;
 
+	// Networked functions and events need to go through ProcessEvent
+	if (!Function->HasAllFunctionFlags(FUNC_Native | FUNC_Public) ||
+		Function->HasAnyFunctionFlags(FUNC_Net | FUNC_BlueprintEvent | FUNC_EditorOnly))
+	{
+		return false;
+	}
+
 	if (IsFieldDeprecated(Function))
 		return false;
 
 	if (Function->HasMetaData(TEXT("BlueprintGetter")) || Function->HasMetaData("BlueprintSetter"))
 		return false;
 
+	// Custom thunks don't necessarily match the signature of the reflected function
+	if (Function->HasMetaData(TEXT("CustomThunk")))
+		return false;
+
+	// World context parameters are filled in by the reflection path
+	if (Function->HasMetaData(TEXT("WorldContext")))
+		return false;
+
 	if (Function->GetName().StartsWith(TEXT("OnRep_")))
 		return false;
 
 	for (auto It = TFieldIterator<UProperty>(Function); It; ++It)
 	{
 		UProperty* Param = *It;
-		if (Param->IsA<UArrayProperty>() ||
-			Param->ArrayDim > 1 ||
-			Param->IsA<UDelegateProperty>() ||
-			Param->IsA<UMulticastDelegateProperty>() ||
-			Param->IsA<UWeakObjectProperty>() ||
-			Param->IsA<UInterfaceProperty>())
-		{
+
+		const bool bIsOutParam = Param->HasAnyPropertyFlags(CPF_OutParm)
+			&& !Param->HasAnyPropertyFlags(CPF_ReturnParm | CPF_ConstParm);
+
+		if (bIsOutParam || !IsSupportedType(Param))
 			return false;
-		}
 	}
 
 	return true;
@@ -207,36 +313,13 @@ bool FTsuCodeGenerator::CanExportFunction(UClass* Class, UFunction* Function)
 
 FString FTsuCodeGenerator::ExportFunction(const FString& ClassNameCPP, UClass* Class, UFunction* Function)
 {
-	FString Result;
+	using namespace TsuCodeGenerator_Private;
 
-	TsuCodeGenerator_Private::AppendToolTip(Result, Function);
-
-	FString ResultTypeName = TEXT("void");
-	if (UProperty* ResultType = Function->GetReturnProperty())
-		ResultTypeName = ResultType->GetCPPType();
-
-	Result += FString::Printf(
-		TEXT("// Function: %s %s::%s("),
-		*ResultTypeName,
+	return FString::Printf(
+		TEXT("TSU_TYPED_TRAMPOLINE(%s, %s, %s);\r\n"),
 		*ClassNameCPP,
-		*Function->GetName());
-
-	for (auto It = TFieldIterator<UProperty>(Function); It; ++It)
-	{
-		UProperty* Param = *It;
-
-		if (!(Param->GetPropertyFlags() & CPF_ReturnParm))
-		{
-			if (Param->PassCPPArgsByRef())
-				Result += FString::Printf(TEXT("const %s& %s, "), *Param->GetCPPType(), *Param->GetNameCPP());
-			else
-				Result += FString::Printf(TEXT("%s %s, "), *Param->GetCPPType(), *Param->GetNameCPP());
-		}
-	}
-
-	Result += TEXT(")\r\n\r\n");
-
-	return Result;
+		*Function->GetName(),
+		*GetFunctionPointerTypeCPP(ClassNameCPP, Function));
 }
 
 bool FTsuCodeGenerator::CanExportProperty(UClass* Class, UProperty* Property)
@@ -245,10 +328,10 @@ bool FTsuCodeGenerator::CanExportProperty(UClass* Class, UProperty* Property)
 	if (!(Class->ClassFlags & CLASS_RequiredAPI))
 		return false;
 
-	// Only public, editable properties can be exported
+	// Only public, Blueprint-visible properties can be exported
 	if (!Property->HasAnyFlags(RF_Public) ||
-		(Property->PropertyFlags & CPF_Protected) ||
-		!(Property->PropertyFlags & CPF_Edit))
+		!Property->HasAllPropertyFlags(CPF_NativeAccessSpecifierPublic | CPF_BlueprintVisible) ||
+		Property->HasAnyPropertyFlags(CPF_EditorOnly))
 	{
 		return false;
 	}
@@ -256,57 +339,130 @@ bool FTsuCodeGenerator::CanExportProperty(UClass* Class, UProperty* Property)
 	if (IsFieldDeprecated(Property))
 		return false;
 
-	// Reject if it's one of the unsupported types (yet)
-	if (Property->IsA<UArrayProperty>() ||
-		Property->ArrayDim > 1 ||
-		Property->IsA<UDelegateProperty>() ||
-		Property->IsA<UMulticastDelegateProperty>() ||
-		Property->IsA<UWeakObjectProperty>() ||
-		Property->IsA<UInterfaceProperty>() ||
-		Property->IsA<UStructProperty>())
-	{
+	if (Property->HasMetaData(TEXT("BlueprintGetter")) || Property->HasMetaData("BlueprintSetter"))
 		return false;
-	}
 
-	return true;
+	// Struct properties are exposed as proxies to the struct inside the object, rather than copies
+	if (Property->IsA<UStructProperty>())
+		return false;
+
+	return IsSupportedType(Property);
 }
 
 FString FTsuCodeGenerator::ExportProperty(const FString& ClassNameCPP, UClass* Class, UProperty* Property)
 {
-	FString Result;
+	return FString::Printf(
+		TEXT("TSU_PROPERTY_TRAMPOLINE(%s, %s);\r\n"),
+		*ClassNameCPP,
+		*Property->GetNameCPP());
+}
 
-	TsuCodeGenerator_Private::AppendToolTip(Result, Property);
+bool FTsuCodeGenerator::IsSupportedType(UProperty* Property)
+{
+	if (Property->ArrayDim > 1)
+		return false;
 
-	Result += FString::Printf(
-		TEXT("// Property: (%s) %s::%s\r\n\r\n"),
-		*Property->GetCPPType(),
-		*ClassNameCPP,
-		*Property->GetName());
+	if (Property->IsA<UFloatProperty>() || Property->IsA<UIntProperty>() || Property->IsA<UStrProperty>())
+		return true;
 
-	return Result;
+	if (auto ByteProperty = Cast<UByteProperty>(Property))
+		return ByteProperty->Enum == nullptr;
+
+	// Bitfields can't be pointed to
+	if (auto BoolProperty = Cast<UBoolProperty>(Property))
+		return BoolProperty->IsNativeBool();
+
+	// Raw pointers only, as opposed to things like `TSubclassOf`
+	if (Property->GetClass() == UObjectProperty::StaticClass() || Property->GetClass() == UClassProperty::StaticClass())
+		return !Property->HasAnyPropertyFlags(CPF_UObjectWrapper);
+
+	if (auto StructProperty = Cast<UStructProperty>(Property))
+	{
+		for (const TCHAR* StructName : TsuCodeGenerator_Private::SupportedStructs)
+		{
+			if (StructProperty->Struct->GetName() == StructName)
+				return true;
+		}
+	}
+
+	return false;
 }
 
 void FTsuCodeGenerator::FinishExport()
 {
-	// GlueAllGeneratedFiles();
+	GlueAllGeneratedFiles();
 	RenameTempFiles();
+	WriteNativeTypesStamp();
+}
+
+void FTsuCodeGenerator::WriteNativeTypesStamp()
+{
+	using namespace TsuCodeGenerator_Private;
+
+	TArray<UField*> Types;
+
+	for (auto Class : TObjectRange<UClass>())
+		Types.Add(Class);
+
+	for (auto Struct : TObjectRange<UScriptStruct>())
+		Types.Add(Struct);
+
+	for (auto Enum : TObjectRange<UEnum>())
+		Types.Add(Enum);
+
+	// Object iteration order isn't something to rely on for a stable hash
+	Types.Sort([](const UField& Lhs, const UField& Rhs)
+	{
+		return Lhs.GetPathName() < Rhs.GetPathName();
+	});
+
+	FSHA1 Hash;
+
+	for (UField* Type : Types)
+		HashType(Hash, Type);
+
+	Hash.Final();
+
+	uint8 Digest[FSHA1::DigestSize];
+	Hash.GetHash(Digest);
+
+	const FString Stamp = BytesToHex(Digest, FSHA1::DigestSize);
+	const FString StampPath = FTsuPaths::NativeTypesStampPath();
+
+	FString ExistingStamp;
+	FFileHelper::LoadFileToString(ExistingStamp, *StampPath);
+
+	if (Stamp == ExistingStamp)
+		return;
+
+	if (FFileHelper::SaveStringToFile(Stamp, *StampPath))
+		UE_LOG(LogTsuGenerator, Log, TEXT("Native types have changed, typings will be regenerated"));
+	else
+		UE_LOG(LogTsuGenerator, Error, TEXT("Failed to save native types stamp: '%s'"), *StampPath);
 }
 
 void FTsuCodeGenerator::GlueAllGeneratedFiles()
 {
-	FString Result;
+	using namespace TsuCodeGenerator_Private;
+
+	// The headers are included at file scope, while the bindings are included inside of FTsuTrampolines
+
+	FString Headers(GeneratedPreamble);
 
 	for (FString& HeaderFilename : AllSourceClassHeaders)
 	{
 		const FString NewFilename = RebaseToBuildPath(HeaderFilename);
-		Result += FString::Printf(TEXT("#include \"%s\"\r\n"), *NewFilename);
+		Headers += FString::Printf(TEXT("#include \"%s\"\r\n"), *NewFilename);
 	}
 
+	FString Bindings(GeneratedPreamble);
+
 	for (FString& HeaderFilename : AllScriptHeaders)
 	{
 		const FString NewFilename = FPaths::GetCleanFilename(HeaderFilename);
-		Result += FString::Printf(TEXT("#include \"%s\"\r\n"), *NewFilename);
+		Bindings += FString::Printf(TEXT("#include \"%s\"\r\n"), *NewFilename);
 	}
 
-	SaveHeaderIfChanged(GeneratedCodePath / TEXT("GeneratedScriptLibraries.inl"), Result);
+	SaveHeaderIfChanged(GeneratedCodePath / TEXT("TsuGeneratedHeaders.inl"), Headers);
+	SaveHeaderIfChanged(GeneratedCodePath / TEXT("TsuGeneratedBindings.inl"), Bindings);
 }
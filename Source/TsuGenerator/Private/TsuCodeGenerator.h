@@ -1,27 +1,30 @@
-/**
- * #note(#mihe): This module is not currently used and is only meant to serve as a starting point for future development
- */
-
 #pragma once
 
 #include "CoreMinimal.h"
 
+/**
+ * Exports typed V8 trampolines for the functions and properties of the classes in the configured modules.
+ *
+ * Each exported class gets a `<Class>.tsu.h` file with one registration per function/property, which are glued
+ * together into `TsuGeneratedBindings.inl` and `TsuGeneratedHeaders.inl`, and are then compiled into TsuRuntime
+ * as part of `FTsuTrampolines`.
+ */
 class FTsuCodeGenerator
 {
 public:
 	FTsuCodeGenerator(const FString& RootLocalPath, const FString& RootBuildPath, const FString& OutputDirectory, const FString& InIncludeBase);
 
-	/** ... */
+	/** Exports the trampolines for a given class, if it has anything that can be exported */
 	void ExportClass(UClass* Class, const FString& SourceHeaderFilename, const FString& GeneratedHeaderFilename, bool bHasChanged);
 
-	/** ... */
+	/** Writes the glue files and replaces any existing files with the newly generated ones */
 	void FinishExport();
 
 private:
-	/** Exports a wrapper function */
+	/** Exports a trampoline for a function */
 	FString ExportFunction(const FString& ClassNameCPP, UClass* Class, UFunction* Function);
 
-	/** Exports a wrapper functions for properties */
+	/** Exports a trampoline for a property */
 	FString ExportProperty(const FString& ClassNameCPP, UClass* Class, UProperty* Property);
 
 	/** @see FScriptCodeGeneratorBase::CanExportClass */
@@ -33,6 +36,9 @@ private:
 	/** Returns true if the specified property can be exported */
 	static bool CanExportProperty(UClass* Class, UProperty* Property);
 
+	/** Returns true if the type of the specified property/parameter can be converted by a trampoline */
+	static bool IsSupportedType(UProperty* Property);
+
 	/** Saves generated script glue heade to a temporary file if its contents is different from the eexisting one. */
 	bool SaveHeaderIfChanged(const FString& HeaderPath, const FString& NewHeaderContents);
 
@@ -51,6 +57,12 @@ private:
 	/** Creats a 'glue' file that merges all generated script files */
 	void GlueAllGeneratedFiles();
 
+	/**
+	 * Writes a hash of the reflection data of all native types, which lets the editor skip generating typings for
+	 * native types when nothing has changed since they were last generated.
+	 */
+	void WriteNativeTypesStamp();
+
 	/** All generated script header filenames */
 	TArray<FString> AllScriptHeaders;
 
@@ -1,7 +1,3 @@
-/**
- * #note(#mihe): This module is not currently used and is only meant to serve as a starting point for future development
- */
-
 #include "TsuGeneratorModule.h"
 
 #include "TsuGeneratorLog.h"
@@ -107,14 +103,15 @@ bool FTsuGeneratorModule::ShouldExportClassesForModule(const FString& ModuleName
 	bool bCanExport = (ModuleType == EBuildModuleType::EngineRuntime || ModuleType == EBuildModuleType::GameRuntime);
 	if (bCanExport)
 	{
-		// Only export functions from selected modules
+		// Only export functions from the modules listed under [TsuGenerator] in the engine config, which TsuRuntime
+		// also picks up as dependencies, since that's where the generated code ends up being compiled
 		static TArray<FString> SupportedModules = [] {
 			TArray<FString> Result;
-			GConfig->GetArray(TEXT("Plugins"), TEXT("ScriptSupportedModules"), Result, GEngineIni);
+			GConfig->GetArray(TEXT("TsuGenerator"), TEXT("Modules"), Result, GEngineIni);
 			return Result;
 		}();
 
-		bCanExport = SupportedModules.Num() == 0 || SupportedModules.Contains(ModuleName);
+		bCanExport = SupportedModules.Contains(ModuleName);
 	}
 	return bCanExport;
 }
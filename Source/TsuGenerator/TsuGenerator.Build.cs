@@ -1,7 +1,3 @@
-/**
- * #note(#mihe): This module is not currently used and is only meant to serve as a starting point for future development
- */
-
 using UnrealBuildTool;
 
 public class TsuGenerator : ModuleRules
@@ -1,19 +1,41 @@
 "use strict";
 Object.defineProperty(exports, "__esModule", { value: true });
 require("source-map-support/register");
+const crypto = require("crypto");
+const fs = require("fs");
+const Module = require("module");
 const path = require("path");
+const rollup = require("rollup");
+const commonjs = require("rollup-plugin-commonjs");
+const json = require("rollup-plugin-json");
+const nodeResolve = require("rollup-plugin-node-resolve");
+const terser = require("terser");
 const ts = require("typescript");
 if (process.argv.length < 3) {
     throw new Error('No project directory specified');
 }
 const projectDirectory = path.resolve(process.argv[2]);
-const responseCache = new Map();
+const cacheDirectory = process.argv.length > 3 ? path.resolve(process.argv[3]) : undefined;
+const pendingTypeChecks = new Set();
 const scriptFileNames = new Array();
 const scriptVersions = new Map();
 const fileCache = new Map();
-const compilerOptions = findCompilerOptions();
+const fileHashes = new Map();
+const importedFiles = new WeakMap();
+const declaredConstEnums = new WeakMap();
+const saveTimers = new Map();
+const commonJSPackages = new Map();
+const vendorWrites = new Map();
+const emitExpiryMs = 10 * 60 * 1000;
+const { compilerOptions, tsuOptions } = findOptions();
+const optionsHash = getOptionsHash();
+const moduleResolutionCache = ts.createModuleResolutionCache(projectDirectory, fileName => fileName.toLowerCase());
+const emitsESModules = compilerOptions.module !== undefined && compilerOptions.module >= ts.ModuleKind.ES2015;
+const resolutionCache = loadCache('resolutions.json');
+const responseCache = loadCache('responses.json');
 const languageService = createLanguageService();
-function findCompilerOptions() {
+const uobjectSymbols = new WeakMap();
+function findOptions() {
     const configPath = ts.findConfigFile(projectDirectory, ts.sys.fileExists);
     if (!configPath) {
         throw new Error(`Failed to find tsconfig in: ${projectDirectory}`);
@@ -22,23 +44,32 @@ function findCompilerOptions() {
     if (configJson.error) {
         throw new Error(formatDiagnostic(configJson.error));
     }
-    const config = ts.parseJsonConfigFileContent(configJson.config, {
-        readDirectory: ts.sys.readDirectory,
-        fileExists: ts.sys.fileExists,
-        readFile: ts.sys.readFile,
-        useCaseSensitiveFileNames: false
-    }, projectDirectory);
+    const config = ts.parseJsonConfigFileContent(
+        configJson.config,
+        {
+            readDirectory: ts.sys.readDirectory,
+            fileExists: ts.sys.fileExists,
+            readFile: ts.sys.readFile,
+            useCaseSensitiveFileNames: false
+        },
+        projectDirectory
+    );
     if (config.errors.length) {
-        throw new Error(config.errors.map(error => (formatDiagnostic(error))).join('\n'));
+        throw new Error(config.errors.map(error => (
+            formatDiagnostic(error)
+        )).join('\n'));
     }
-    return config.options;
+    const tsuOptions = configJson.config.tsu || {};
+    return { compilerOptions: config.options, tsuOptions: tsuOptions };
 }
 function formatDiagnostic(diagnostic) {
     const msg = ts.flattenDiagnosticMessageText(diagnostic.messageText, '\n');
     if (!diagnostic.file) {
         return `[TS]: ${msg}`;
     }
-    const pos = diagnostic.file.getLineAndCharacterOfPosition(diagnostic.start || 0);
+    const pos = diagnostic.file.getLineAndCharacterOfPosition(
+        diagnostic.start || 0
+    );
     const file = path.basename(diagnostic.file.fileName);
     const line = pos.line + 1;
     const char = pos.character + 1;
@@ -56,9 +87,7 @@ function createLanguageService() {
         },
         getScriptSnapshot: fileName => {
             const cachedSnapshot = fileCache.get(fileName);
-            if (cachedSnapshot) {
-                return cachedSnapshot;
-            }
+            if (cachedSnapshot) { return cachedSnapshot; }
             const fileContent = ts.sys.readFile(fileName);
             if (fileContent === undefined) {
                 scriptVersions.delete(fileName);
@@ -75,9 +104,7 @@ function createLanguageService() {
                 });
             }
             const scriptVersion = scriptVersions.get(fileName);
-            if (!scriptVersion) {
-                return undefined;
-            }
+            if (!scriptVersion) { return undefined; }
             const modifiedTime = getModifiedTime(fileName);
             if (modifiedTime > scriptVersion.modifiedTime) {
                 scriptVersion.modifiedTime = modifiedTime;
@@ -85,6 +112,9 @@ function createLanguageService() {
             }
             return snapshot;
         },
+        resolveModuleNames: (moduleNames, containingFile) => (
+            moduleNames.map(moduleName => resolveModuleName(moduleName, containingFile))
+        ),
         getCurrentDirectory: () => projectDirectory,
         getCompilationSettings: () => compilerOptions,
         getDefaultLibFileName: ts.getDefaultLibFilePath,
@@ -93,6 +123,89 @@ function createLanguageService() {
         readDirectory: ts.sys.readDirectory
     }, ts.createDocumentRegistry());
 }
+function getOptionsHash() {
+    return crypto.createHash('sha1').update(JSON.stringify(compilerOptions)).digest('hex');
+}
+function loadCache(fileName) {
+    const emptyCache = { optionsHash: optionsHash, entries: {} };
+    if (!cacheDirectory) { return emptyCache; }
+    try {
+        const cacheFile = JSON.parse(
+            fs.readFileSync(path.join(cacheDirectory, fileName), 'utf8')
+        );
+        return (cacheFile.optionsHash === optionsHash && cacheFile.entries) ? cacheFile : emptyCache;
+    }
+    catch {
+        return emptyCache;
+    }
+}
+function saveCache(fileName, cache, onSaved) {
+    if (!cacheDirectory || saveTimers.has(fileName)) { return; }
+    const saveTimer = setTimeout(() => {
+        saveTimers.delete(fileName);
+        try {
+            const savedCache = loadCache(fileName);
+            const mergedCache = {
+                optionsHash: optionsHash,
+                entries: { ...savedCache.entries, ...cache.entries }
+            };
+            fs.mkdirSync(cacheDirectory, { recursive: true });
+            const cachePath = path.join(cacheDirectory, fileName);
+            const tempPath = `${cachePath}.${process.pid}.tmp`;
+            fs.writeFileSync(tempPath, JSON.stringify(mergedCache));
+            fs.renameSync(tempPath, cachePath);
+            if (onSaved) { onSaved(mergedCache); }
+        }
+        catch (error) {
+            process.stderr.write(`Failed to save ${fileName}: ${error}\n`);
+        }
+    }, 1000);
+    saveTimer.unref();
+    saveTimers.set(fileName, saveTimer);
+}
+function hashText(text) {
+    return crypto.createHash('sha1').update(text).digest('hex');
+}
+function getFileHash(filePath) {
+    const modifiedTime = ts.sys.getModifiedTime(filePath);
+    if (!modifiedTime) { return undefined; }
+    const cachedHash = fileHashes.get(filePath);
+    if (cachedHash && cachedHash.modifiedTime === modifiedTime.getTime()) {
+        return cachedHash.hash;
+    }
+    const content = ts.sys.readFile(filePath);
+    if (content === undefined) { return undefined; }
+    const hash = hashText(content);
+    fileHashes.set(filePath, { modifiedTime: modifiedTime.getTime(), hash: hash });
+    return hash;
+}
+function resolveModuleName(moduleName, containingFile) {
+    const modifiedTime = ts.sys.getModifiedTime(containingFile);
+    const fileTime = modifiedTime ? modifiedTime.getTime() : 0;
+    let cachedFile = resolutionCache.entries[containingFile];
+    if (cachedFile && cachedFile.modifiedTime === fileTime) {
+        const cachedModule = cachedFile.modules[moduleName];
+        if (cachedModule && ts.sys.fileExists(cachedModule.resolvedFileName)) {
+            return cachedModule;
+        }
+    }
+    else {
+        cachedFile = { modifiedTime: fileTime, modules: {} };
+        resolutionCache.entries[containingFile] = cachedFile;
+    }
+    const resolvedModule = ts.resolveModuleName(
+        moduleName,
+        containingFile,
+        compilerOptions,
+        ts.sys,
+        moduleResolutionCache
+    ).resolvedModule;
+    if (resolvedModule) {
+        cachedFile.modules[moduleName] = resolvedModule;
+        saveCache('resolutions.json', resolutionCache);
+    }
+    return resolvedModule;
+}
 function getModifiedTime(filePath) {
     const modifiedTime = ts.sys.getModifiedTime(filePath);
     if (!modifiedTime) {
@@ -100,7 +213,7 @@ function getModifiedTime(filePath) {
     }
     return modifiedTime.getTime();
 }
-function parseFile(filePath) {
+function updateScriptVersion(filePath) {
     const modifiedTime = getModifiedTime(filePath);
     let scriptVersion = scriptVersions.get(filePath);
     if (!scriptVersion) {
@@ -114,10 +227,36 @@ function parseFile(filePath) {
     else {
         scriptVersion.version += 1;
     }
+    return { scriptVersion, modifiedTime };
+}
+function parseFiles(
+    filePaths,
+    onResponse
+) {
+    const versions = filePaths.map(updateScriptVersion);
     const program = languageService.getProgram();
     if (program === undefined) {
         throw new Error('Failed to get program');
     }
+    filePaths.forEach((filePath, index) => {
+        const { scriptVersion, modifiedTime } = versions[index];
+        let response;
+        try {
+            response = parseFile(program, filePath, scriptVersion, modifiedTime);
+        }
+        catch (error) {
+            onResponse(filePath, { errors: [`[TSU]: ${error.stack || error}`] });
+            return;
+        }
+        onResponse(filePath, response, program);
+    });
+}
+function parseFile(
+    program,
+    filePath,
+    scriptVersion,
+    modifiedTime
+) {
     const sourceFile = program.getSourceFile(filePath);
     if (sourceFile === undefined) {
         throw new Error(`Failed to get source file: ${filePath}`);
@@ -127,58 +266,534 @@ function parseFile(filePath) {
     if (errors.length > 0) {
         return { errors: errors };
     }
-    const emitOutput = languageService.getEmitOutput(filePath);
-    if (emitOutput.emitSkipped) {
+    const source = emitFile(filePath);
+    if (source === undefined) {
         throw new Error('Emit skipped');
     }
-    const numOutput = emitOutput.outputFiles.length;
-    if (numOutput !== 1) {
-        throw new Error(`Unexpected number of output files: ${numOutput}`);
-    }
     scriptVersion.modifiedTime = modifiedTime;
-    const output = emitOutput.outputFiles[0];
-    const sources = new Map();
-    sources.set(filePath, output.text);
     const fileExtension = path.parse(filePath).ext;
     const fileName = path.basename(filePath);
     const plainName = fileName.replace(fileExtension, '');
-    const functions = (sourceFile.statements
-        .filter(ts.isFunctionDeclaration)
-        .filter(f => f.body !== undefined)
-        .filter(isExported)
-        .map(declaration => parseFunction(declaration, filePath, program, sourceFile, errors))
-        .filter(isNonEmpty));
+    const functions = (
+        sourceFile.statements
+            .filter(ts.isFunctionDeclaration)
+            .filter(f => f.body !== undefined)
+            .filter(isExported)
+            .map(declaration =>
+                parseFunction(
+                    declaration,
+                    filePath,
+                    program,
+                    sourceFile,
+                    errors))
+            .filter(isNonEmpty)
+    );
     const dependencies = findDependencies(program, sourceFile);
     return {
+        source: source,
         fileName: fileName,
         name: plainName,
         path: filePath,
-        source: sources.get(filePath) || '',
         errors: errors,
         exports: functions,
         dependencies: dependencies
     };
 }
+function emitFile(filePath) {
+    const emitOutput = languageService.getEmitOutput(filePath);
+    if (emitOutput.emitSkipped) { return undefined; }
+    const numOutput = emitOutput.outputFiles.length;
+    if (numOutput !== 1) {
+        throw new Error(`Unexpected number of output files: ${numOutput}`);
+    }
+    return emitOutput.outputFiles[0].text;
+}
+function getEnumValues(declaration) {
+    const values = new Map();
+    let nextValue = 0;
+    for (const member of declaration.members) {
+        if (!ts.isIdentifier(member.name) && !ts.isStringLiteral(member.name)) { return undefined; }
+        const initializer = member.initializer;
+        let value;
+        if (initializer === undefined) {
+            value = nextValue;
+        }
+        else if (ts.isNumericLiteral(initializer)) {
+            value = Number(initializer.text);
+        }
+        else if (ts.isStringLiteral(initializer)) {
+            value = initializer.text;
+        }
+        else if (
+            ts.isPrefixUnaryExpression(initializer) &&
+            initializer.operator === ts.SyntaxKind.MinusToken &&
+            ts.isNumericLiteral(initializer.operand)
+        ) {
+            value = -Number(initializer.operand.text);
+        }
+        if (value === undefined) { return undefined; }
+        values.set(member.name.text, value);
+        if (typeof value === 'number') { nextValue = value + 1; }
+    }
+    return values;
+}
+function getDeclaredConstEnums(sourceFile) {
+    const cachedEnums = declaredConstEnums.get(sourceFile);
+    if (cachedEnums) { return cachedEnums; }
+    const modules = new Map();
+    const addModule = (moduleName, statements) => {
+        const enums = new Map();
+        for (const statement of statements) {
+            if (!ts.isEnumDeclaration(statement) || !(ts.getCombinedModifierFlags(statement) & ts.ModifierFlags.Const)) {
+                continue;
+            }
+            const values = getEnumValues(statement);
+            if (values) { enums.set(statement.name.text, values); }
+        }
+        if (enums.size > 0) { modules.set(moduleName, enums); }
+    };
+    if (ts.isExternalModule(sourceFile)) {
+        addModule(sourceFile.fileName, sourceFile.statements);
+    }
+    for (const statement of sourceFile.statements) {
+        if (ts.isModuleDeclaration(statement) && ts.isStringLiteral(statement.name) &&
+            statement.body && ts.isModuleBlock(statement.body)) {
+            addModule(statement.name.text, statement.body.statements);
+        }
+    }
+    declaredConstEnums.set(sourceFile, modules);
+    return modules;
+}
+function findImportedConstEnums(program, sourceFile, filePath) {
+    const modules = new Map();
+    for (const file of program.getSourceFiles()) {
+        getDeclaredConstEnums(file).forEach((enums, moduleName) => modules.set(moduleName, enums));
+    }
+    const importedEnums = new Map();
+    for (const statement of sourceFile.statements) {
+        if (!ts.isImportDeclaration(statement) || !ts.isStringLiteral(statement.moduleSpecifier)) { continue; }
+        const importClause = statement.importClause;
+        const namedBindings = importClause && importClause.namedBindings;
+        if (!namedBindings || !ts.isNamedImports(namedBindings)) { continue; }
+        const moduleName = statement.moduleSpecifier.text;
+        const resolvedModule = resolveModuleName(moduleName, filePath);
+        const enums = modules.get(resolvedModule ? resolvedModule.resolvedFileName : moduleName);
+        if (!enums) { continue; }
+        for (const element of namedBindings.elements) {
+            const values = enums.get((element.propertyName || element.name).text);
+            if (values) { importedEnums.set(element.name.text, values); }
+        }
+    }
+    return importedEnums;
+}
+function inlineConstEnums(program, filePath) {
+    return context => sourceFile => {
+        const importedEnums = findImportedConstEnums(program, sourceFile, filePath);
+        if (importedEnums.size === 0) { return sourceFile; }
+        const visitImport = (node) => {
+            const importClause = node.importClause;
+            const namedBindings = importClause && importClause.namedBindings;
+            if (!importClause || !namedBindings || !ts.isNamedImports(namedBindings)) { return node; }
+            const elements = namedBindings.elements.filter(element => !importedEnums.has(element.name.text));
+            if (elements.length === namedBindings.elements.length) { return node; }
+            if (elements.length === 0 && !importClause.name) { return undefined; }
+            return ts.updateImportDeclaration(
+                node,
+                node.decorators,
+                node.modifiers,
+                ts.updateImportClause(
+                    importClause,
+                    importClause.name,
+                    elements.length > 0 ? ts.updateNamedImports(namedBindings, elements) : undefined
+                ),
+                node.moduleSpecifier
+            );
+        };
+        const findValue = (node) => {
+            let enumName;
+            let memberName;
+            if (ts.isPropertyAccessExpression(node)) {
+                enumName = node.expression;
+                memberName = node.name.text;
+            }
+            else if (ts.isElementAccessExpression(node) && ts.isStringLiteral(node.argumentExpression)) {
+                enumName = node.expression;
+                memberName = node.argumentExpression.text;
+            }
+            else {
+                return undefined;
+            }
+            const values = ts.isIdentifier(enumName) ? importedEnums.get(enumName.text) : undefined;
+            return values && values.get(memberName);
+        };
+        const visit = (node) => {
+            if (ts.isImportDeclaration(node)) { return visitImport(node); }
+            const value = findValue(node);
+            if (typeof value === 'number' && value < 0) {
+                return ts.createPrefix(ts.SyntaxKind.MinusToken, ts.createLiteral(-value));
+            }
+            else if (value !== undefined) {
+                return ts.createLiteral(value);
+            }
+            return ts.visitEachChild(node, visit, context);
+        };
+        return ts.visitEachChild(sourceFile, visit, context);
+    };
+}
+function transpileFile(filePath) {
+    updateScriptVersion(filePath);
+    const program = languageService.getProgram();
+    if (program === undefined) {
+        throw new Error('Failed to get program');
+    }
+    const sourceFile = program.getSourceFile(filePath);
+    if (sourceFile === undefined) {
+        throw new Error(`Failed to get source file: ${filePath}`);
+    }
+    const output = ts.transpileModule(sourceFile.text, {
+        compilerOptions: compilerOptions,
+        fileName: filePath,
+        reportDiagnostics: true,
+        transformers: { before: [inlineConstEnums(program, filePath)] }
+    });
+    const errors = (output.diagnostics || []).map(formatDiagnostic);
+    if (errors.length > 0) {
+        return { errors: errors };
+    }
+    const source = output.outputText;
+    pendingTypeChecks.add(filePath);
+    scheduleTypeCheck();
+    const fileExtension = path.parse(filePath).ext;
+    const fileName = path.basename(filePath);
+    const plainName = fileName.replace(fileExtension, '');
+    return {
+        source: source,
+        fileName: fileName,
+        name: plainName,
+        path: filePath,
+        errors: errors,
+        exports: [],
+        dependencies: []
+    };
+}
+function typeCheckFile(filePath) {
+    updateScriptVersion(filePath);
+    const program = languageService.getProgram();
+    if (program === undefined) {
+        throw new Error('Failed to get program');
+    }
+    const sourceFile = program.getSourceFile(filePath);
+    if (sourceFile === undefined) {
+        throw new Error(`Failed to get source file: ${filePath}`);
+    }
+    const diagnostics = ts.getPreEmitDiagnostics(program, sourceFile);
+    return {
+        kind: 'typeCheck',
+        file: filePath,
+        errors: diagnostics.map(formatDiagnostic)
+    };
+}
+let typeCheckScheduled = false;
+function scheduleTypeCheck() {
+    if (typeCheckScheduled || pendingTypeChecks.size === 0) { return; }
+    typeCheckScheduled = true;
+    setImmediate(() => {
+        typeCheckScheduled = false;
+        const filePath = pendingTypeChecks.values().next().value;
+        pendingTypeChecks.delete(filePath);
+        let result;
+        try {
+            result = typeCheckFile(filePath);
+        }
+        catch (error) {
+            result = { kind: 'typeCheck', file: filePath, errors: [`[TSU]: ${error.stack || error}`] };
+        }
+        writeNotification(result);
+        scheduleTypeCheck();
+    });
+}
+function warmUp(filePaths) {
+    filePaths = filePaths.filter(filePath => {
+        try {
+            if (!scriptVersions.has(filePath)) { updateScriptVersion(filePath); }
+            return true;
+        }
+        catch {
+            return false;
+        }
+    });
+    let loaded = 0;
+    const total = filePaths.length;
+    const warmUpNext = () => {
+        try {
+            const program = languageService.getProgram();
+            const sourceFile = program && program.getSourceFile(filePaths[loaded]);
+            if (program && sourceFile) { program.getSemanticDiagnostics(sourceFile); }
+        }
+        catch {
+        }
+        loaded += 1;
+        writeNotification({ kind: 'warmUp', loaded: loaded, total: total });
+        if (loaded < total) { setImmediate(warmUpNext); }
+    };
+    writeNotification({ kind: 'warmUp', loaded: loaded, total: total });
+    if (total > 0) { setImmediate(warmUpNext); }
+}
+function touchFile(filePath) {
+    const now = new Date();
+    try { fs.utimesSync(filePath, now, now); }
+    catch { }
+}
+function writeSource(source, sourceMap) {
+    if (!cacheDirectory) { return { source: source }; }
+    const sourceHash = crypto.createHash('sha1').update(source).digest('hex');
+    const emitDirectory = path.join(cacheDirectory, 'Emit');
+    const sourcePath = path.join(emitDirectory, `${sourceHash}.js`);
+    if (!fs.existsSync(sourcePath)) {
+        fs.mkdirSync(emitDirectory, { recursive: true });
+        const tempPath = `${sourcePath}.${process.pid}.tmp`;
+        fs.writeFileSync(tempPath, source, 'utf8');
+        fs.renameSync(tempPath, sourcePath);
+    }
+    else {
+        touchFile(sourcePath);
+    }
+    const sourceMapPath = sourceMap !== undefined ? `${sourcePath}.map` : undefined;
+    if (sourceMapPath && !fs.existsSync(sourceMapPath)) {
+        const tempPath = `${sourceMapPath}.${process.pid}.tmp`;
+        fs.writeFileSync(tempPath, sourceMap, 'utf8');
+        fs.renameSync(tempPath, sourceMapPath);
+    }
+    else if (sourceMapPath) {
+        touchFile(sourceMapPath);
+    }
+    return {
+        sourcePath: sourcePath,
+        sourceHash: sourceHash,
+        sourceMapPath: sourceMapPath
+    };
+}
+function splitSourceMap(source) {
+    const sourceMapPattern = /\n\/\/# sourceMappingURL=data:application\/json;base64,(\S*)\s*$/;
+    const match = sourceMapPattern.exec(source);
+    if (!match) { return { code: source }; }
+    return {
+        code: source.slice(0, match.index),
+        map: Buffer.from(match[1], 'base64').toString('utf8')
+    };
+}
+function minifySource(filePath, source) {
+    const { code, map } = splitSourceMap(source);
+    const output = terser.minify(code, {
+        compress: {
+            global_defs: { __DEV__: false },
+            drop_console: true,
+            passes: 2
+        },
+        mangle: true,
+        sourceMap: map !== undefined ? { content: JSON.parse(map) } : false
+    });
+    if (output.error) {
+        throw new Error(`Failed to minify ${path.basename(filePath)}: ${output.error.message}`);
+    }
+    return {
+        code: output.code || '',
+        map: typeof output.map === 'string' ? output.map : undefined
+    };
+}
+function findPackage(moduleName, importer) {
+    const segments = moduleName.split('/');
+    const packageName = moduleName.startsWith('@') ? segments.slice(0, 2).join('/') : segments[0];
+    for (let directory = path.dirname(importer); ; directory = path.dirname(directory)) {
+        const nodeModulesPath = path.join(directory, 'node_modules');
+        const packagePath = path.join(nodeModulesPath, packageName, 'package.json');
+        if (fs.existsSync(packagePath)) { return { nodeModulesPath: nodeModulesPath, packagePath: packagePath }; }
+        if (path.dirname(directory) === directory) { return undefined; }
+    }
+}
+function isCommonJSPackage(moduleName, importer) {
+    const installedPackage = findPackage(moduleName, importer);
+    if (!installedPackage) { return false; }
+    const { packagePath } = installedPackage;
+    const cachedResult = commonJSPackages.get(packagePath);
+    if (cachedResult !== undefined) { return cachedResult; }
+    let result = false;
+    try {
+        const packageJson = JSON.parse(fs.readFileSync(packagePath, 'utf8'));
+        result = !packageJson.module && !packageJson['jsnext:main'];
+    }
+    catch {
+    }
+    commonJSPackages.set(packagePath, result);
+    return result;
+}
+async function vendorPackage(moduleName, importer) {
+    const installedPackage = findPackage(moduleName, importer);
+    if (!installedPackage) { return undefined; }
+    const { nodeModulesPath, packagePath } = installedPackage;
+    let packageJson;
+    try { packageJson = fs.readFileSync(packagePath, 'utf8'); }
+    catch { return undefined; }
+    const vendorHash = hashText(`${moduleName}\n${packagePath}\n${packageJson}`);
+    const vendorDirectory = path.join(nodeModulesPath, '.cache', 'tsu');
+    const vendorPath = path.join(vendorDirectory, `${vendorHash}.js`);
+    let vendorWrite = vendorWrites.get(vendorPath);
+    if (!vendorWrite) {
+        vendorWrite = writeVendoredPackage(moduleName, importer, vendorPath);
+        vendorWrites.set(vendorPath, vendorWrite);
+        vendorWrite.catch(() => vendorWrites.delete(vendorPath));
+    }
+    try {
+        await vendorWrite;
+    }
+    catch {
+        return undefined;
+    }
+    return {
+        specifier: `.cache/tsu/${vendorHash}`,
+        files: [packagePath, vendorPath]
+    };
+}
+async function writeVendoredPackage(moduleName, importer, vendorPath) {
+    if (fs.existsSync(vendorPath)) { return; }
+    const entryId = path.join(path.dirname(importer), '__tsuVendor.js');
+    const entryCode = `import vendored from ${JSON.stringify(moduleName)};\nexport default vendored;\n`;
+    const bundle = await rollup.rollup({
+        input: entryId,
+        external: id => Module.builtinModules.includes(id),
+        plugins: [
+            {
+                name: 'tsu-vendor',
+                resolveId: id => (id === entryId ? id : null),
+                load: id => (id === entryId ? entryCode : null)
+            },
+            nodeResolve(),
+            commonjs(),
+            json()
+        ],
+        onwarn: () => undefined
+    });
+    const { output } = await bundle.generate({
+        format: 'cjs',
+        exports: 'default',
+        interop: false
+    });
+    const chunk = output[0];
+    fs.mkdirSync(path.dirname(vendorPath), { recursive: true });
+    const tempPath = `${vendorPath}.${process.pid}.tmp`;
+    fs.writeFileSync(tempPath, chunk.code, 'utf8');
+    fs.renameSync(tempPath, vendorPath);
+}
+function findBareRequires(source) {
+    const requirePattern = /(?:\brequire\(|\bimport\(|\bfrom\s*)(["'])([^"'.\/][^"']*)\1/g;
+    const bareRequires = [];
+    for (let match = requirePattern.exec(source); match; match = requirePattern.exec(source)) {
+        if (!match[2].startsWith('UE/')) { bareRequires.push(match[2]); }
+    }
+    return bareRequires;
+}
+async function bundleSource(filePath, source) {
+    const entryId = filePath.replace(/\.tsx?$/, '.js');
+    const { code: entryCode, map: entryMap } = splitSourceMap(source);
+    const isBareModule = (id) => !id.startsWith('.') && !path.isAbsolute(id);
+    const commonJSImports = new Map();
+    const isCommonJSImport = (id, importer) => {
+        if (!isBareModule(id) || !isCommonJSPackage(id, importer)) { return false; }
+        if (!commonJSImports.has(id)) { commonJSImports.set(id, importer); }
+        return true;
+    };
+    const bundle = await rollup.rollup({
+        input: entryId,
+        external: (id, parentId) => (
+            id.startsWith('UE/') ||
+            Module.builtinModules.includes(id) ||
+            (parentId === entryId && !isBareModule(id)) ||
+            isCommonJSImport(id, parentId || entryId)
+        ),
+        plugins: [
+            {
+                name: 'tsu-entry',
+                resolveId: id => (id === entryId ? id : null),
+                load: id => (id === entryId ? { code: entryCode, map: entryMap } : null)
+            },
+            nodeResolve(),
+            commonjs(),
+            json()
+        ],
+        onwarn: () => undefined
+    });
+    const bundledFiles = bundle.watchFiles.filter(file => file !== entryId && path.isAbsolute(file));
+    const vendoredSpecifiers = new Map();
+    for (const [id, importer] of commonJSImports) {
+        const vendoredPackage = await vendorPackage(id, importer);
+        if (vendoredPackage) {
+            vendoredSpecifiers.set(id, vendoredPackage.specifier);
+            bundledFiles.push(...vendoredPackage.files);
+        }
+    }
+    const { output } = await bundle.generate({
+        format: emitsESModules ? 'esm' : 'cjs',
+        interop: false,
+        paths: id => vendoredSpecifiers.get(id) || id,
+        sourcemap: entryMap !== undefined,
+        sourcemapFile: entryId
+    });
+    const chunk = output[0];
+    const bundledSource = chunk.map ? `${chunk.code}\n//# sourceMappingURL=${chunk.map.toUrl()}` : chunk.code;
+    return {
+        source: bundledSource,
+        bundledFiles: bundledFiles
+    };
+}
+function finishResponse(response, bundled, production = false) {
+    const { source, ...rest } = response;
+    if (source === undefined) { return { response: response, bundledFiles: [] }; }
+    if (bundled === undefined) {
+        bundled = { source: source, bundledFiles: [] };
+    }
+    const emitted = production
+        ? minifySource(rest.path, bundled.source)
+        : { code: bundled.source, map: undefined };
+    return {
+        response: { ...rest, ...writeSource(emitted.code, emitted.map) },
+        bundledFiles: bundled.bundledFiles
+    };
+}
 function isExported(node) {
     const modifiers = node.modifiers;
-    return modifiers && modifiers.some(mod => mod.kind === ts.SyntaxKind.ExportKeyword);
+    return modifiers && modifiers.some(mod =>
+        mod.kind === ts.SyntaxKind.ExportKeyword
+    );
 }
 function isNonEmpty(value) {
     return value != undefined;
 }
-function parseFunction(declaration, filePath, program, sourceFile, errors) {
+function parseFunction(
+    declaration,
+    filePath,
+    program,
+    sourceFile,
+    errors
+) {
     const typeChecker = program.getTypeChecker();
     const signature = typeChecker.getSignatureFromDeclaration(declaration);
-    const returnType = typeChecker.getReturnTypeOfSignature(signature);
-    const returnTypeStr = typeChecker.typeToString(returnType);
+    let returnType = typeChecker.getReturnTypeOfSignature(signature);
+    const latent = isPromiseType(returnType);
+    if (latent) {
+        const typeArguments = (returnType).typeArguments;
+        returnType = typeArguments ? typeArguments[0] : undefined;
+    }
+    const returnTypeStr = returnType ? typeChecker.typeToString(returnType) : 'void';
     const returnTypes = parseType(returnTypeStr);
     const position = getPosition(declaration, sourceFile);
     if (returnTypes.length > 1) {
         const file = path.basename(filePath);
         const line = position.line;
         const char = position.character;
-        errors.push(`[TSU] ${file}(${line},${char}): ` +
-            `Disallowed union return type (${returnTypeStr})`);
+        errors.push(
+            `[TSU] ${file}(${line},${char}): ` +
+            `Disallowed union return type (${returnTypeStr})`
+        );
         return null;
     }
     const parameters = declaration.parameters.map(param => {
@@ -188,16 +803,26 @@ function parseFunction(declaration, filePath, program, sourceFile, errors) {
         name: declaration.name.getText(),
         parameters: parameters,
         returnTypes: returnTypes,
+        latent: latent,
         line: position.line,
         character: position.character
     };
 }
-function parseParameter(param, typeChecker) {
+function isPromiseType(type) {
+    const symbol = type.getSymbol();
+    return symbol !== undefined && symbol.getName() === 'Promise';
+}
+function parseParameter(
+    param,
+    typeChecker
+) {
     const type = typeChecker.getTypeAtLocation(param.type);
     const types = parseType(typeChecker.typeToString(type));
-    const optional = (param.initializer === undefined
-        ? typeChecker.isOptionalParameter(param)
-        : false);
+    const optional = (
+        param.initializer === undefined
+            ? typeChecker.isOptionalParameter(param)
+            : false
+    );
     return {
         name: param.name.getText(),
         types: types,
@@ -215,88 +840,311 @@ function parseType(typeStr) {
     });
 }
 function getPosition(node, sourceFile) {
-    const pos = sourceFile.getLineAndCharacterOfPosition(node.getStart(sourceFile, true));
+    const pos = sourceFile.getLineAndCharacterOfPosition(
+        node.getStart(sourceFile, true)
+    );
     pos.line += 1;
     pos.character += 1;
     return pos;
 }
-function findDependencies(program, sourceFile) {
+function isUObject(symbol, typeChecker) {
+    const cachedResult = uobjectSymbols.get(symbol);
+    if (cachedResult !== undefined) { return cachedResult; }
+    uobjectSymbols.set(symbol, false);
+    let result = (symbol.getName() === 'UObject');
+    if (!result && (symbol.flags & ts.SymbolFlags.Class)) {
+        const baseTypes = typeChecker.getDeclaredTypeOfSymbol(symbol).getBaseTypes() || [];
+        result = baseTypes.some(baseType => {
+            const baseSymbol = baseType.getSymbol();
+            return baseSymbol !== undefined && isUObject(baseSymbol, typeChecker);
+        });
+    }
+    uobjectSymbols.set(symbol, result);
+    return result;
+}
+function findDependencies(
+    program,
+    sourceFile
+) {
     const typeChecker = program.getTypeChecker();
-    const isUObject = (type) => {
-        const typeName = typeChecker.typeToString(type);
-        if (typeName === 'UObject') {
-            return true;
+    const dependencies = new Set();
+    const addSymbol = (symbol) => {
+        if (symbol === undefined) { return; }
+        if (symbol.flags & ts.SymbolFlags.Alias) {
+            symbol = typeChecker.getAliasedSymbol(symbol);
+        }
+        if (isUObject(symbol, typeChecker)) {
+            dependencies.add(symbol.getName());
         }
-        const baseTypes = type.getBaseTypes() || [];
-        return !!baseTypes.find(isUObject);
     };
-    const dependencies = new Set();
-    const traverseTree = (node) => {
-        ts.forEachChild(node, traverseTree);
-        let type;
-        try {
-            type = typeChecker.getTypeAtLocation(node);
+    const addImport = (declaration) => {
+        const moduleName = (declaration.moduleSpecifier).text;
+        const importClause = declaration.importClause;
+        if (!moduleName.startsWith('UE/') || !importClause) { return; }
+        if (importClause.name) {
+            addSymbol(typeChecker.getSymbolAtLocation(importClause.name));
         }
-        catch (_a) {
-            return;
+        const namedBindings = importClause.namedBindings;
+        if (!namedBindings) { return; }
+        if (ts.isNamespaceImport(namedBindings)) {
+            const moduleSymbol = typeChecker.getSymbolAtLocation(declaration.moduleSpecifier);
+            if (moduleSymbol) {
+                typeChecker.getExportsOfModule(moduleSymbol).forEach(addSymbol);
+            }
         }
-        if (!type) {
-            return;
+        else {
+            for (const element of namedBindings.elements) {
+                addSymbol(typeChecker.getSymbolAtLocation(element.name));
+            }
         }
-        const flagName = (ts.TypeFlags[type.flags] || '');
-        const isLiteral = (flagName.search(/Literal/) !== -1);
-        const isCallable = !type.getCallSignatures().length;
-        const isValidNode = !isLiteral && isCallable;
-        if (!isValidNode) {
+    };
+    const traverseTree = (node) => {
+        if (ts.isImportDeclaration(node)) {
+            addImport(node);
             return;
         }
-        const constructSignatures = type.getConstructSignatures();
-        if (constructSignatures.length) {
-            type = constructSignatures[0].getReturnType();
-        }
-        if (isUObject(type)) {
-            const typeName = typeChecker.typeToString(type);
-            dependencies.add(typeName);
+        if (ts.isTypeReferenceNode(node)) {
+            addSymbol(typeChecker.getSymbolAtLocation(node.typeName));
         }
+        ts.forEachChild(node, traverseTree);
     };
     traverseTree(sourceFile);
     return Array.from(dependencies);
 }
-function writeResponse(response) {
+function writeMessage(id, message) {
+    const body = Buffer.from(message, 'utf8');
+    process.stdout.write(`${id} ${body.length}\n`);
+    process.stdout.write(body);
+}
+function writeNotification(notification) {
+    writeMessage(0, JSON.stringify(notification));
+}
+function writeResponse(ids, response) {
     if (typeof response !== 'string') {
-        response = JSON.stringify(response, null, '  ');
+        response = JSON.stringify(response);
+    }
+    for (const id of Array.isArray(ids) ? ids : [ids]) {
+        writeMessage(id, response);
     }
-    process.stdout.write(response + '\n');
     return response;
 }
+function getImportedFiles(sourceFile) {
+    const cachedFiles = importedFiles.get(sourceFile);
+    if (cachedFiles) { return cachedFiles; }
+    const fileInfo = ts.preProcessFile(sourceFile.text, true, true);
+    const directory = path.dirname(sourceFile.fileName);
+    const fileNames = [];
+    const unresolved = [];
+    for (const ref of fileInfo.importedFiles) {
+        const resolvedModule = resolveModuleName(ref.fileName, sourceFile.fileName);
+        if (resolvedModule) {
+            fileNames.push(resolvedModule.resolvedFileName);
+        }
+        else {
+            unresolved.push(ref.fileName);
+        }
+    }
+    for (const ref of fileInfo.referencedFiles) {
+        fileNames.push(path.resolve(directory, ref.fileName));
+    }
+    const files = { fileNames: fileNames, unresolved: unresolved };
+    if (unresolved.length === 0) {
+        importedFiles.set(sourceFile, files);
+    }
+    return files;
+}
+function findDependencyFiles(program, sourceFile) {
+    const dependencies = new Set();
+    const unresolved = {};
+    const visit = (file) => {
+        const files = getImportedFiles(file);
+        if (files.unresolved.length > 0) {
+            unresolved[file.fileName] = files.unresolved;
+        }
+        for (const fileName of files.fileNames) {
+            if (dependencies.has(fileName)) { continue; }
+            dependencies.add(fileName);
+            const dependencyFile = program.getSourceFile(fileName);
+            if (dependencyFile) { visit(dependencyFile); }
+        }
+    };
+    visit(sourceFile);
+    for (const file of program.getSourceFiles()) {
+        if (!ts.isExternalModule(file) && !program.isSourceFileDefaultLibrary(file)) {
+            dependencies.add(file.fileName);
+        }
+    }
+    dependencies.delete(sourceFile.fileName);
+    return { fileNames: Array.from(dependencies), unresolved: unresolved };
+}
+function cacheResponse(
+    filePath,
+    response,
+    responseStr,
+    program,
+    bundledFiles
+) {
+    const sourceFile = program.getSourceFile(filePath);
+    if (!sourceFile) { return; }
+    const fileHash = hashText(sourceFile.text);
+    const dependencyFiles = findDependencyFiles(program, sourceFile);
+    const dependencies = {};
+    for (const dependency of [...dependencyFiles.fileNames, ...bundledFiles]) {
+        const dependencyFile = program.getSourceFile(dependency);
+        const dependencyHash = dependencyFile ? hashText(dependencyFile.text) : getFileHash(dependency);
+        if (!dependencyHash) { return; }
+        dependencies[dependency] = dependencyHash;
+    }
+    responseCache.entries[filePath] = {
+        response: responseStr,
+        sourcePath: (response).sourcePath,
+        bundled: tsuOptions.bundleNodeModules,
+        fileHash: fileHash,
+        dependencies: dependencies,
+        unresolved: dependencyFiles.unresolved
+    };
+    saveCache('responses.json', responseCache, pruneEmittedSources);
+}
+function pruneEmittedSources(cache) {
+    if (!cacheDirectory) { return; }
+    const referencedSources = new Set();
+    for (const filePath of Object.keys(cache.entries)) {
+        const sourcePath = cache.entries[filePath].sourcePath;
+        if (sourcePath) { referencedSources.add(path.basename(sourcePath)); }
+    }
+    const emitDirectory = path.join(cacheDirectory, 'Emit');
+    let fileNames;
+    try { fileNames = fs.readdirSync(emitDirectory); }
+    catch { return; }
+    const expiryTime = Date.now() - emitExpiryMs;
+    for (const fileName of fileNames) {
+        const extensionEnd = fileName.indexOf('.js');
+        const sourceName = extensionEnd !== -1 ? fileName.slice(0, extensionEnd + 3) : fileName;
+        if (referencedSources.has(sourceName)) { continue; }
+        const filePath = path.join(emitDirectory, fileName);
+        try {
+            if (fs.statSync(filePath).mtimeMs < expiryTime) { fs.unlinkSync(filePath); }
+        }
+        catch {
+        }
+    }
+}
+function findCachedResponse(filePath) {
+    const cachedResponse = responseCache.entries[filePath];
+    if (!cachedResponse || getFileHash(filePath) !== cachedResponse.fileHash) { return undefined; }
+    if (!!cachedResponse.bundled !== !!tsuOptions.bundleNodeModules) { return undefined; }
+    for (const dependency of Object.keys(cachedResponse.dependencies)) {
+        if (getFileHash(dependency) !== cachedResponse.dependencies[dependency]) { return undefined; }
+    }
+    const unresolved = cachedResponse.unresolved || {};
+    for (const containingFile of Object.keys(unresolved)) {
+        if (unresolved[containingFile].some(moduleName => resolveModuleName(moduleName, containingFile) !== undefined)) {
+            return undefined;
+        }
+    }
+    if (cachedResponse.sourcePath && !fs.existsSync(cachedResponse.sourcePath)) { return undefined; }
+    return cachedResponse.response;
+}
+function respond(
+    ids,
+    filePath,
+    response,
+    program,
+    production = false
+) {
+    const finish = (bundled) => {
+        const { response: finishedResponse, bundledFiles } = finishResponse(response, bundled, production);
+        const responseStr = writeResponse(ids, finishedResponse);
+        if (program && 'exports' in finishedResponse) {
+            cacheResponse(filePath, finishedResponse, responseStr, program, bundledFiles);
+        }
+    };
+    const fail = (error) => {
+        writeResponse(ids, { errors: [`[TSU]: ${error.stack || error}`] });
+    };
+    const { source } = response;
+    if (source === undefined || !tsuOptions.bundleNodeModules || findBareRequires(source).length === 0) {
+        try { finish(); }
+        catch (error) { fail(error); }
+        return;
+    }
+    writeNotification({ kind: 'progress', file: filePath });
+    bundleSource(filePath, source)
+        .then(finish)
+        .catch(fail);
+}
+function addRequestId(idsByFile, filePath, id) {
+    const ids = idsByFile.get(filePath);
+    if (ids) {
+        ids.push(id);
+    }
+    else {
+        idsByFile.set(filePath, [id]);
+    }
+}
+function parseRequestedFiles(idsByFile, production = false) {
+    if (idsByFile.size === 0) { return; }
+    let filePaths = Array.from(idsByFile.keys());
+    try {
+        parseFiles(filePaths, (filePath, response, program) => {
+            respond(idsByFile.get(filePath), filePath, response, production ? undefined : program, production);
+            filePaths = filePaths.filter(other => other !== filePath);
+        });
+    }
+    catch (error) {
+        const response = { errors: [`[TSU]: ${error.stack || error}`] };
+        for (const filePath of filePaths) {
+            writeResponse(idsByFile.get(filePath), response);
+        }
+    }
+}
 function processRequest(requestStr) {
     const request = JSON.parse(requestStr);
-    const cachedResponse = responseCache.get(request.file);
-    if (cachedResponse) {
-        return writeResponse(cachedResponse);
-    }
-    const response = parseFile(request.file);
-    const responseStr = writeResponse(response);
-    responseCache.set(request.file, responseStr);
-    setTimeout(() => {
-        responseCache.delete(request.file);
-    }, 1000);
-    return responseStr;
+    const idsByFile = new Map();
+    const productionIdsByFile = new Map();
+    if (request.warmUp) {
+        warmUp(request.warmUp);
+    }
+    for (const { id, file, transpileOnly, production } of request.files) {
+        if (production) {
+            addRequestId(productionIdsByFile, file, id);
+            continue;
+        }
+        if (transpileOnly) {
+            let response;
+            try {
+                response = transpileFile(file);
+            }
+            catch (error) {
+                response = { errors: [`[TSU]: ${error.stack || error}`] };
+            }
+            respond(id, file, response);
+            continue;
+        }
+        pendingTypeChecks.delete(file);
+        const cachedResponse = findCachedResponse(file);
+        if (cachedResponse) {
+            writeResponse(id, cachedResponse);
+            continue;
+        }
+        addRequestId(idsByFile, file, id);
+    }
+    parseRequestedFiles(idsByFile);
+    parseRequestedFiles(productionIdsByFile, true);
 }
-let input = '';
-process.stdin.setEncoding('utf8');
+let input = Buffer.alloc(0);
 process.stdin.on('data', (chunk) => {
-    const lines = chunk.split(/\r?\n/);
-    if (lines.length <= 1) {
-        input += chunk;
-        return;
-    }
-    const lastLine = lines.splice(-1, 1)[0];
-    const firstLine = lines.splice(0, 1)[0];
-    processRequest(input + firstLine);
-    for (const line of lines) {
-        processRequest(line);
+    input = Buffer.concat([input, chunk]);
+    for (;;) {
+        const headerEnd = input.indexOf('\n');
+        if (headerEnd === -1) { return; }
+        const [, length] = input.toString('ascii', 0, headerEnd).trim().split(' ').map(Number);
+        const bodyStart = headerEnd + 1;
+        const bodyEnd = bodyStart + length;
+        if (input.length < bodyEnd) { return; }
+        const body = input.toString('utf8', bodyStart, bodyEnd);
+        input = input.slice(bodyEnd);
+        processRequest(body);
     }
-    input = lastLine;
 });
-//# sourceMappingURL=data:application/json;base64,eyJ2ZXJzaW9uIjozLCJmaWxlIjoiaW5kZXguanMiLCJzb3VyY2VSb290IjoiIiwic291cmNlcyI6WyIuLi9zb3VyY2UvaW5kZXgudHMiXSwibmFtZXMiOltdLCJtYXBwaW5ncyI6Ijs7QUFBQSx1Q0FBcUM7QUFFckMsNkJBQTZCO0FBQzdCLGlDQUFpQztBQThDakMsSUFBSSxPQUFPLENBQUMsSUFBSSxDQUFDLE1BQU0sR0FBRyxDQUFDLEVBQUU7SUFDNUIsTUFBTSxJQUFJLEtBQUssQ0FBQyxnQ0FBZ0MsQ0FBQyxDQUFDO0NBQ2xEO0FBRUQsTUFBTSxnQkFBZ0IsR0FBRyxJQUFJLENBQUMsT0FBTyxDQUFDLE9BQU8sQ0FBQyxJQUFJLENBQUMsQ0FBQyxDQUFDLENBQUMsQ0FBQztBQUN2RCxNQUFNLGFBQWEsR0FBRyxJQUFJLEdBQUcsRUFBa0IsQ0FBQztBQUNoRCxNQUFNLGVBQWUsR0FBRyxJQUFJLEtBQUssRUFBVSxDQUFDO0FBQzVDLE1BQU0sY0FBYyxHQUFHLElBQUksR0FBRyxFQUF5QixDQUFDO0FBQ3hELE1BQU0sU0FBUyxHQUFHLElBQUksR0FBRyxFQUE4QixDQUFDO0FBQ3hELE1BQU0sZUFBZSxHQUFHLG1CQUFtQixFQUFFLENBQUM7QUFDOUMsTUFBTSxlQUFlLEdBQUcscUJBQXFCLEVBQUUsQ0FBQztBQUVoRCxTQUFTLG1CQUFtQjtJQUMzQixNQUFNLFVBQVUsR0FBRyxFQUFFLENBQUMsY0FBYyxDQUFDLGdCQUFnQixFQUFFLEVBQUUsQ0FBQyxHQUFHLENBQUMsVUFBVSxDQUFDLENBQUM7SUFDMUUsSUFBSSxDQUFDLFVBQVUsRUFBRTtRQUNoQixNQUFNLElBQUksS0FBSyxDQUFDLCtCQUErQixnQkFBZ0IsRUFBRSxDQUFDLENBQUM7S0FDbkU7SUFFRCxNQUFNLFVBQVUsR0FBRyxFQUFFLENBQUMsY0FBYyxDQUFDLFVBQVUsRUFBRSxFQUFFLENBQUMsR0FBRyxDQUFDLFFBQVEsQ0FBQyxDQUFDO0lBQ2xFLElBQUksVUFBVSxDQUFDLEtBQUssRUFBRTtRQUNyQixNQUFNLElBQUksS0FBSyxDQUFDLGdCQUFnQixDQUFDLFVBQVUsQ0FBQyxLQUFLLENBQUMsQ0FBQyxDQUFDO0tBQ3BEO0lBRUQsTUFBTSxNQUFNLEdBQUcsRUFBRSxDQUFDLDBCQUEwQixDQUMzQyxVQUFVLENBQUMsTUFBTSxFQUNqQjtRQUNDLGFBQWEsRUFBRSxFQUFFLENBQUMsR0FBRyxDQUFDLGFBQWE7UUFDbkMsVUFBVSxFQUFFLEVBQUUsQ0FBQyxHQUFHLENBQUMsVUFBVTtRQUM3QixRQUFRLEVBQUUsRUFBRSxDQUFDLEdBQUcsQ0FBQyxRQUFRO1FBQ3pCLHlCQUF5QixFQUFFLEtBQUs7S0FDaEMsRUFDRCxnQkFBZ0IsQ0FDaEIsQ0FBQztJQUVGLElBQUksTUFBTSxDQUFDLE1BQU0sQ0FBQyxNQUFNLEVBQUU7UUFDekIsTUFBTSxJQUFJLEtBQUssQ0FBQyxNQUFNLENBQUMsTUFBTSxDQUFDLEdBQUcsQ0FBQyxLQUFLLENBQUMsRUFBRSxDQUFDLENBQzFDLGdCQUFnQixDQUFDLEtBQUssQ0FBQyxDQUN2QixDQUFDLENBQUMsSUFBSSxDQUFDLElBQUksQ0FBQyxDQUFDLENBQUM7S0FDZjtJQUVELE9BQU8sTUFBTSxDQUFDLE9BQU8sQ0FBQztBQUN2QixDQUFDO0FBRUQsU0FBUyxnQkFBZ0IsQ0FBQyxVQUF5QjtJQUNsRCxNQUFNLEdBQUcsR0FBRyxFQUFFLENBQUMsNEJBQTRCLENBQUMsVUFBVSxDQUFDLFdBQVcsRUFBRSxJQUFJLENBQUMsQ0FBQztJQUUxRSxJQUFJLENBQUMsVUFBVSxDQUFDLElBQUksRUFBRTtRQUNyQixPQUFPLFNBQVMsR0FBRyxFQUFFLENBQUM7S0FDdEI7SUFFRCxNQUFNLEdBQUcsR0FBRyxVQUFVLENBQUMsSUFBSSxDQUFDLDZCQUE2QixDQUN4RCxVQUFVLENBQUMsS0FBSyxJQUFJLENBQUMsQ0FDckIsQ0FBQztJQUVGLE1BQU0sSUFBSSxHQUFHLElBQUksQ0FBQyxRQUFRLENBQUMsVUFBVSxDQUFDLElBQUksQ0FBQyxRQUFRLENBQUMsQ0FBQztJQUNyRCxNQUFNLElBQUksR0FBRyxHQUFHLENBQUMsSUFBSSxHQUFHLENBQUMsQ0FBQztJQUMxQixNQUFNLElBQUksR0FBRyxHQUFHLENBQUMsU0FBUyxHQUFHLENBQUMsQ0FBQztJQUMvQixNQUFNLFFBQVEsR0FBRyxVQUFVLENBQUMsUUFBUSxDQUFDO0lBQ3JDLE1BQU0sSUFBSSxHQUFHLEVBQUUsQ0FBQyxrQkFBa0IsQ0FBQyxRQUFRLENBQUMsQ0FBQyxXQUFXLEVBQUUsQ0FBQztJQUMzRCxNQUFNLElBQUksR0FBRyxVQUFVLENBQUMsSUFBSSxDQUFDO0lBRTdCLE9BQU8sU0FBUyxJQUFJLElBQUksSUFBSSxJQUFJLElBQUksTUFBTSxJQUFJLE1BQU0sSUFBSSxLQUFLLEdBQUcsRUFBRSxDQUFDO0FBQ3BFLENBQUM7QUFFRCxTQUFTLHFCQUFxQjtJQUM3QixPQUFPLEVBQUUsQ0FBQyxxQkFBcUIsQ0FBQztRQUMvQixrQkFBa0IsRUFBRSxHQUFHLEVBQUUsQ0FBQyxlQUFlO1FBQ3pDLGdCQUFnQixFQUFFLFFBQVEsQ0FBQyxFQUFFO1lBQzVCLE1BQU0sYUFBYSxHQUFHLGNBQWMsQ0FBQyxHQUFHLENBQUMsUUFBUSxDQUFDLENBQUM7WUFDbkQsT0FBTyxhQUFhLENBQUMsQ0FBQyxDQUFDLGFBQWEsQ0FBQyxPQUFPLENBQUMsUUFBUSxFQUFFLENBQUMsQ0FBQyxDQUFDLEdBQUcsQ0FBQztRQUMvRCxDQUFDO1FBQ0QsaUJBQWlCLEVBQUUsUUFBUSxDQUFDLEVBQUU7WUFDN0IsTUFBTSxjQUFjLEdBQUcsU0FBUyxDQUFDLEdBQUcsQ0FBQyxRQUFRLENBQUMsQ0FBQztZQUMvQyxJQUFJLGNBQWMsRUFBRTtnQkFBRSxPQUFPLGNBQWMsQ0FBQzthQUFFO1lBRTlDLE1BQU0sV0FBVyxHQUFHLEVBQUUsQ0FBQyxHQUFHLENBQUMsUUFBUSxDQUFDLFFBQVEsQ0FBQyxDQUFDO1lBQzlDLElBQUksV0FBVyxLQUFLLFNBQVMsRUFBRTtnQkFDOUIsY0FBYyxDQUFDLE1BQU0sQ0FBQyxRQUFRLENBQUMsQ0FBQztnQkFDaEMsT0FBTyxTQUFTLENBQUM7YUFDakI7WUFFRCxNQUFNLFFBQVEsR0FBRyxFQUFFLENBQUMsY0FBYyxDQUFDLFVBQVUsQ0FBQyxXQUFXLENBQUMsQ0FBQztZQUczRCxJQUFJLFFBQVEsQ0FBQyxNQUFNLENBQUMsY0FBYyxDQUFDLEtBQUssQ0FBQyxDQUFDLEVBQUU7Z0JBQzNDLFNBQVMsQ0FBQyxHQUFHLENBQUMsUUFBUSxFQUFFLFFBQVEsQ0FBQyxDQUFDO2FBQ2xDO1lBRUQsSUFBSSxDQUFDLGNBQWMsQ0FBQyxHQUFHLENBQUMsUUFBUSxDQUFDLEVBQUU7Z0JBQ2xDLGNBQWMsQ0FBQyxHQUFHLENBQUMsUUFBUSxFQUFFO29CQUM1QixPQUFPLEVBQUUsQ0FBQztvQkFDVixZQUFZLEVBQUUsSUFBSSxDQUFDLEdBQUcsRUFBRTtpQkFDeEIsQ0FBQyxDQUFDO2FBQ0g7WUFFRCxNQUFNLGFBQWEsR0FBRyxjQUFjLENBQUMsR0FBRyxDQUFDLFFBQVEsQ0FBQyxDQUFDO1lBQ25ELElBQUksQ0FBQyxhQUFhLEVBQUU7Z0JBQUUsT0FBTyxTQUFTLENBQUM7YUFBRTtZQUV6QyxNQUFNLFlBQVksR0FBRyxlQUFlLENBQUMsUUFBUSxDQUFDLENBQUM7WUFDL0MsSUFBSSxZQUFZLEdBQUcsYUFBYSxDQUFDLFlBQVksRUFBRTtnQkFDOUMsYUFBYSxDQUFDLFlBQVksR0FBRyxZQUFZLENBQUM7Z0JBQzFDLGFBQWEsQ0FBQyxPQUFPLElBQUksQ0FBQyxDQUFDO2FBQzNCO1lBRUQsT0FBTyxRQUFRLENBQUM7UUFDakIsQ0FBQztRQUNELG1CQUFtQixFQUFFLEdBQUcsRUFBRSxDQUFDLGdCQUFnQjtRQUMzQyxzQkFBc0IsRUFBRSxHQUFHLEVBQUUsQ0FBQyxlQUFlO1FBQzdDLHFCQUFxQixFQUFFLEVBQUUsQ0FBQyxxQkFBcUI7UUFDL0MsVUFBVSxFQUFFLEVBQUUsQ0FBQyxHQUFHLENBQUMsVUFBVTtRQUM3QixRQUFRLEVBQUUsRUFBRSxDQUFDLEdBQUcsQ0FBQyxRQUFRO1FBQ3pCLGFBQWEsRUFBRSxFQUFFLENBQUMsR0FBRyxDQUFDLGFBQWE7S0FDbkMsRUFBRSxFQUFFLENBQUMsc0JBQXNCLEVBQUUsQ0FBQyxDQUFDO0FBQ2pDLENBQUM7QUFFRCxTQUFTLGVBQWUsQ0FBQyxRQUFnQjtJQUN4QyxNQUFNLFlBQVksR0FBRyxFQUFFLENBQUMsR0FBRyxDQUFDLGVBQWdCLENBQUMsUUFBUSxDQUFDLENBQUM7SUFDdkQsSUFBSSxDQUFDLFlBQVksRUFBRTtRQUNsQixNQUFNLElBQUksS0FBSyxDQUFDLDBDQUEwQyxRQUFRLEdBQUcsQ0FBQyxDQUFDO0tBQ3ZFO0lBRUQsT0FBTyxZQUFZLENBQUMsT0FBTyxFQUFFLENBQUM7QUFDL0IsQ0FBQztBQUVELFNBQVMsU0FBUyxDQUFDLFFBQWdCO0lBQ2xDLE1BQU0sWUFBWSxHQUFHLGVBQWUsQ0FBQyxRQUFRLENBQUMsQ0FBQztJQUUvQyxJQUFJLGFBQWEsR0FBRyxjQUFjLENBQUMsR0FBRyxDQUFDLFFBQVEsQ0FBQyxDQUFDO0lBQ2pELElBQUksQ0FBQyxhQUFhLEVBQUU7UUFDbkIsYUFBYSxHQUFHO1lBQ2YsT0FBTyxFQUFFLENBQUM7WUFDVixZQUFZLEVBQUUsWUFBWTtTQUMxQixDQUFDO1FBRUYsZUFBZSxDQUFDLElBQUksQ0FBQyxRQUFRLENBQUMsQ0FBQztRQUMvQixjQUFjLENBQUMsR0FBRyxDQUFDLFFBQVEsRUFBRSxhQUFhLENBQUMsQ0FBQztLQUM1QztTQUNJO1FBQ0osYUFBYSxDQUFDLE9BQU8sSUFBSSxDQUFDLENBQUM7S0FDM0I7SUFFRCxNQUFNLE9BQU8sR0FBRyxlQUFlLENBQUMsVUFBVSxFQUFFLENBQUM7SUFDN0MsSUFBSSxPQUFPLEtBQUssU0FBUyxFQUFFO1FBQzFCLE1BQU0sSUFBSSxLQUFLLENBQUMsdUJBQXVCLENBQUMsQ0FBQztLQUN6QztJQUVELE1BQU0sVUFBVSxHQUFHLE9BQU8sQ0FBQyxhQUFhLENBQUMsUUFBUSxDQUFDLENBQUM7SUFDbkQsSUFBSSxVQUFVLEtBQUssU0FBUyxFQUFFO1FBQzdCLE1BQU0sSUFBSSxLQUFLLENBQUMsOEJBQThCLFFBQVEsRUFBRSxDQUFDLENBQUM7S0FDMUQ7SUFFRCxNQUFNLFdBQVcsR0FBRyxFQUFFLENBQUMscUJBQXFCLENBQUMsT0FBTyxFQUFFLFVBQVUsQ0FBQyxDQUFDO0lBQ2xFLE1BQU0sTUFBTSxHQUFHLFdBQVcsQ0FBQyxHQUFHLENBQUMsZ0JBQWdCLENBQUMsQ0FBQztJQUNqRCxJQUFJLE1BQU0sQ0FBQyxNQUFNLEdBQUcsQ0FBQyxFQUFFO1FBQ3RCLE9BQU8sRUFBRSxNQUFNLEVBQUUsTUFBTSxFQUFFLENBQUM7S0FDMUI7SUFFRCxNQUFNLFVBQVUsR0FBRyxlQUFlLENBQUMsYUFBYSxDQUFDLFFBQVEsQ0FBQyxDQUFDO0lBQzNELElBQUksVUFBVSxDQUFDLFdBQVcsRUFBRTtRQUMzQixNQUFNLElBQUksS0FBSyxDQUFDLGNBQWMsQ0FBQyxDQUFDO0tBQ2hDO0lBRUQsTUFBTSxTQUFTLEdBQUcsVUFBVSxDQUFDLFdBQVcsQ0FBQyxNQUFNLENBQUM7SUFDaEQsSUFBSSxTQUFTLEtBQUssQ0FBQyxFQUFFO1FBQ3BCLE1BQU0sSUFBSSxLQUFLLENBQUMsc0NBQXNDLFNBQVMsRUFBRSxDQUFDLENBQUM7S0FDbkU7SUFFRCxhQUFhLENBQUMsWUFBWSxHQUFHLFlBQVksQ0FBQztJQUUxQyxNQUFNLE1BQU0sR0FBRyxVQUFVLENBQUMsV0FBVyxDQUFDLENBQUMsQ0FBQyxDQUFDO0lBQ3pDLE1BQU0sT0FBTyxHQUFHLElBQUksR0FBRyxFQUFrQixDQUFDO0lBQzFDLE9BQU8sQ0FBQyxHQUFHLENBQUMsUUFBUSxFQUFFLE1BQU0sQ0FBQyxJQUFJLENBQUMsQ0FBQztJQUVuQyxNQUFNLGFBQWEsR0FBRyxJQUFJLENBQUMsS0FBSyxDQUFDLFFBQVEsQ0FBQyxDQUFDLEdBQUcsQ0FBQztJQUMvQyxNQUFNLFFBQVEsR0FBRyxJQUFJLENBQUMsUUFBUSxDQUFDLFFBQVEsQ0FBQyxDQUFDO0lBQ3pDLE1BQU0sU0FBUyxHQUFHLFFBQVEsQ0FBQyxPQUFPLENBQUMsYUFBYSxFQUFFLEVBQUUsQ0FBQyxDQUFDO0lBRXRELE1BQU0sU0FBUyxHQUFHLENBQ2pCLFVBQVUsQ0FBQyxVQUFVO1NBQ25CLE1BQU0sQ0FBQyxFQUFFLENBQUMscUJBQXFCLENBQUM7U0FDaEMsTUFBTSxDQUFDLENBQUMsQ0FBQyxFQUFFLENBQUMsQ0FBQyxDQUFDLElBQUksS0FBSyxTQUFTLENBQUM7U0FDakMsTUFBTSxDQUFDLFVBQVUsQ0FBQztTQUNsQixHQUFHLENBQUMsV0FBVyxDQUFDLEVBQUUsQ0FDbEIsYUFBYSxDQUNaLFdBQVcsRUFDWCxRQUFRLEVBQ1IsT0FBTyxFQUNQLFVBQVUsRUFDVixNQUFNLENBQUMsQ0FBQztTQUNULE1BQU0sQ0FBQyxVQUFVLENBQUMsQ0FDcEIsQ0FBQztJQUVGLE1BQU0sWUFBWSxHQUFHLGdCQUFnQixDQUFDLE9BQU8sRUFBRSxVQUFVLENBQUMsQ0FBQztJQUUzRCxPQUFPO1FBQ04sUUFBUSxFQUFFLFFBQVE7UUFDbEIsSUFBSSxFQUFFLFNBQVM7UUFDZixJQUFJLEVBQUUsUUFBUTtRQUNkLE1BQU0sRUFBRSxPQUFPLENBQUMsR0FBRyxDQUFDLFFBQVEsQ0FBQyxJQUFJLEVBQUU7UUFDbkMsTUFBTSxFQUFFLE1BQU07UUFDZCxPQUFPLEVBQUUsU0FBUztRQUNsQixZQUFZLEVBQUUsWUFBWTtLQUMxQixDQUFDO0FBQ0gsQ0FBQztBQUVELFNBQVMsVUFBVSxDQUFDLElBQWE7SUFDaEMsTUFBTSxTQUFTLEdBQUcsSUFBSSxDQUFDLFNBQVMsQ0FBQztJQUNqQyxPQUFPLFNBQVMsSUFBSSxTQUFTLENBQUMsSUFBSSxDQUFDLEdBQUcsQ0FBQyxFQUFFLENBQ3hDLEdBQUcsQ0FBQyxJQUFJLEtBQUssRUFBRSxDQUFDLFVBQVUsQ0FBQyxhQUFhLENBQ3hDLENBQUM7QUFDSCxDQUFDO0FBRUQsU0FBUyxVQUFVLENBQUksS0FBMkI7SUFDakQsT0FBTyxLQUFLLElBQUksU0FBUyxDQUFDO0FBQzNCLENBQUM7QUFFRCxTQUFTLGFBQWEsQ0FDckIsV0FBbUMsRUFDbkMsUUFBZ0IsRUFDaEIsT0FBbUIsRUFDbkIsVUFBeUIsRUFDekIsTUFBZ0I7SUFFaEIsTUFBTSxXQUFXLEdBQUcsT0FBTyxDQUFDLGNBQWMsRUFBRSxDQUFDO0lBRTdDLE1BQU0sU0FBUyxHQUFHLFdBQVcsQ0FBQywyQkFBMkIsQ0FBQyxXQUFXLENBQUUsQ0FBQztJQUN4RSxNQUFNLFVBQVUsR0FBRyxXQUFXLENBQUMsd0JBQXdCLENBQUMsU0FBUyxDQUFDLENBQUM7SUFDbkUsTUFBTSxhQUFhLEdBQUcsV0FBVyxDQUFDLFlBQVksQ0FBQyxVQUFVLENBQUMsQ0FBQztJQUMzRCxNQUFNLFdBQVcsR0FBRyxTQUFTLENBQUMsYUFBYSxDQUFDLENBQUM7SUFFN0MsTUFBTSxRQUFRLEdBQUcsV0FBVyxDQUFDLFdBQVcsRUFBRSxVQUFVLENBQUMsQ0FBQztJQUd0RCxJQUFJLFdBQVcsQ0FBQyxNQUFNLEdBQUcsQ0FBQyxFQUFFO1FBQzNCLE1BQU0sSUFBSSxHQUFHLElBQUksQ0FBQyxRQUFRLENBQUMsUUFBUSxDQUFDLENBQUM7UUFDckMsTUFBTSxJQUFJLEdBQUcsUUFBUSxDQUFDLElBQUksQ0FBQztRQUMzQixNQUFNLElBQUksR0FBRyxRQUFRLENBQUMsU0FBUyxDQUFDO1FBRWhDLE1BQU0sQ0FBQyxJQUFJLENBQ1YsU0FBUyxJQUFJLElBQUksSUFBSSxJQUFJLElBQUksS0FBSztZQUNsQyxpQ0FBaUMsYUFBYSxHQUFHLENBQ2pELENBQUM7UUFFRixPQUFPLElBQUksQ0FBQztLQUNaO0lBRUQsTUFBTSxVQUFVLEdBQUcsV0FBVyxDQUFDLFVBQVUsQ0FBQyxHQUFHLENBQUMsS0FBSyxDQUFDLEVBQUU7UUFDckQsT0FBTyxjQUFjLENBQUMsS0FBSyxFQUFFLFdBQVcsQ0FBQyxDQUFDO0lBQzNDLENBQUMsQ0FBQyxDQUFDO0lBRUgsT0FBTztRQUNOLElBQUksRUFBRSxXQUFXLENBQUMsSUFBSyxDQUFDLE9BQU8sRUFBRTtRQUNqQyxVQUFVLEVBQUUsVUFBVTtRQUN0QixXQUFXLEVBQUUsV0FBVztRQUN4QixJQUFJLEVBQUUsUUFBUSxDQUFDLElBQUk7UUFDbkIsU0FBUyxFQUFFLFFBQVEsQ0FBQyxTQUFTO0tBQzdCLENBQUM7QUFDSCxDQUFDO0FBRUQsU0FBUyxjQUFjLENBQ3RCLEtBQThCLEVBQzlCLFdBQTJCO0lBRTNCLE1BQU0sSUFBSSxHQUFHLFdBQVcsQ0FBQyxpQkFBaUIsQ0FBQyxLQUFLLENBQUMsSUFBSyxDQUFDLENBQUM7SUFDeEQsTUFBTSxLQUFLLEdBQUcsU0FBUyxDQUFDLFdBQVcsQ0FBQyxZQUFZLENBQUMsSUFBSSxDQUFDLENBQUMsQ0FBQztJQUN4RCxNQUFNLFFBQVEsR0FBRyxDQUNoQixLQUFLLENBQUMsV0FBVyxLQUFLLFNBQVM7UUFDOUIsQ0FBQyxDQUFDLFdBQVcsQ0FBQyxtQkFBbUIsQ0FBQyxLQUFLLENBQUM7UUFDeEMsQ0FBQyxDQUFDLEtBQUssQ0FDUixDQUFDO0lBRUYsT0FBTztRQUNOLElBQUksRUFBRSxLQUFLLENBQUMsSUFBSSxDQUFDLE9BQU8sRUFBRTtRQUMxQixLQUFLLEVBQUUsS0FBSztRQUNaLFFBQVEsRUFBRSxRQUFRO0tBQ2xCLENBQUM7QUFDSCxDQUFDO0FBRUQsU0FBUyxTQUFTLENBQUMsT0FBZTtJQUNqQyxPQUFPLE9BQU8sQ0FBQyxLQUFLLENBQUMsS0FBSyxDQUFDLENBQUMsR0FBRyxDQUFDLEdBQUcsQ0FBQyxFQUFFO1FBQ3JDLE1BQU0sSUFBSSxHQUFHLEdBQUcsQ0FBQyxPQUFPLENBQUMsT0FBTyxFQUFFLEVBQUUsQ0FBQyxDQUFDO1FBQ3RDLE1BQU0sVUFBVSxHQUFHLENBQUMsR0FBRyxDQUFDLEtBQUssQ0FBQyxPQUFPLENBQUMsSUFBSSxFQUFFLENBQUMsQ0FBQyxNQUFNLENBQUM7UUFDckQsT0FBTztZQUNOLElBQUksRUFBRSxJQUFJO1lBQ1YsVUFBVSxFQUFFLFVBQVU7U0FDdEIsQ0FBQztJQUNILENBQUMsQ0FBQyxDQUFDO0FBQ0osQ0FBQztBQUVELFNBQVMsV0FBVyxDQUFDLElBQWEsRUFBRSxVQUF5QjtJQUM1RCxNQUFNLEdBQUcsR0FBRyxVQUFVLENBQUMsNkJBQTZCLENBQ25ELElBQUksQ0FBQyxRQUFRLENBQUMsVUFBVSxFQUFFLElBQUksQ0FBQyxDQUMvQixDQUFDO0lBRUYsR0FBRyxDQUFDLElBQUksSUFBSSxDQUFDLENBQUM7SUFDZCxHQUFHLENBQUMsU0FBUyxJQUFJLENBQUMsQ0FBQztJQUVuQixPQUFPLEdBQUcsQ0FBQztBQUNaLENBQUM7QUFFRCxTQUFTLGdCQUFnQixDQUN4QixPQUFtQixFQUNuQixVQUF5QjtJQUV6QixNQUFNLFdBQVcsR0FBRyxPQUFPLENBQUMsY0FBYyxFQUFFLENBQUM7SUFFN0MsTUFBTSxTQUFTLEdBQUcsQ0FBQyxJQUFhLEVBQVcsRUFBRTtRQUM1QyxNQUFNLFFBQVEsR0FBRyxXQUFXLENBQUMsWUFBWSxDQUFDLElBQUksQ0FBQyxDQUFDO1FBQ2hELElBQUksUUFBUSxLQUFLLFNBQVMsRUFBRTtZQUFFLE9BQU8sSUFBSSxDQUFDO1NBQUU7UUFFNUMsTUFBTSxTQUFTLEdBQUcsSUFBSSxDQUFDLFlBQVksRUFBRSxJQUFJLEVBQUUsQ0FBQztRQUM1QyxPQUFPLENBQUMsQ0FBQyxTQUFTLENBQUMsSUFBSSxDQUFDLFNBQVMsQ0FBQyxDQUFDO0lBQ3BDLENBQUMsQ0FBQztJQUVGLE1BQU0sWUFBWSxHQUFHLElBQUksR0FBRyxFQUFVLENBQUM7SUFFdkMsTUFBTSxZQUFZLEdBQUcsQ0FBQyxJQUFhLEVBQUUsRUFBRTtRQUN0QyxFQUFFLENBQUMsWUFBWSxDQUFDLElBQUksRUFBRSxZQUFZLENBQUMsQ0FBQztRQUVwQyxJQUFJLElBQUksQ0FBQztRQUNULElBQUk7WUFBRSxJQUFJLEdBQUcsV0FBVyxDQUFDLGlCQUFpQixDQUFDLElBQUksQ0FBQyxDQUFDO1NBQUU7UUFDbkQsV0FBTTtZQUFFLE9BQU87U0FBRTtRQUVqQixJQUFJLENBQUMsSUFBSSxFQUFFO1lBQUUsT0FBTztTQUFFO1FBRXRCLE1BQU0sUUFBUSxHQUFHLENBQUMsRUFBRSxDQUFDLFNBQVMsQ0FBQyxJQUFJLENBQUMsS0FBSyxDQUFDLElBQUksRUFBRSxDQUFDLENBQUM7UUFDbEQsTUFBTSxTQUFTLEdBQUcsQ0FBQyxRQUFRLENBQUMsTUFBTSxDQUFDLFNBQVMsQ0FBQyxLQUFLLENBQUMsQ0FBQyxDQUFDLENBQUM7UUFDdEQsTUFBTSxVQUFVLEdBQUcsQ0FBQyxJQUFJLENBQUMsaUJBQWlCLEVBQUUsQ0FBQyxNQUFNLENBQUM7UUFDcEQsTUFBTSxXQUFXLEdBQUcsQ0FBQyxTQUFTLElBQUksVUFBVSxDQUFDO1FBRTdDLElBQUksQ0FBQyxXQUFXLEVBQUU7WUFBRSxPQUFPO1NBQUU7UUFFN0IsTUFBTSxtQkFBbUIsR0FBRyxJQUFJLENBQUMsc0JBQXNCLEVBQUUsQ0FBQztRQUMxRCxJQUFJLG1CQUFtQixDQUFDLE1BQU0sRUFBRTtZQUMvQixJQUFJLEdBQUcsbUJBQW1CLENBQUMsQ0FBQyxDQUFDLENBQUMsYUFBYSxFQUFFLENBQUM7U0FDOUM7UUFFRCxJQUFJLFNBQVMsQ0FBQyxJQUFJLENBQUMsRUFBRTtZQUNwQixNQUFNLFFBQVEsR0FBRyxXQUFXLENBQUMsWUFBWSxDQUFDLElBQUksQ0FBQyxDQUFDO1lBQ2hELFlBQVksQ0FBQyxHQUFHLENBQUMsUUFBUSxDQUFDLENBQUM7U0FDM0I7SUFDRixDQUFDLENBQUM7SUFFRixZQUFZLENBQUMsVUFBVSxDQUFDLENBQUM7SUFFekIsT0FBTyxLQUFLLENBQUMsSUFBSSxDQUFDLFlBQVksQ0FBQyxDQUFDO0FBQ2pDLENBQUM7QUFFRCxTQUFTLGFBQWEsQ0FBQyxRQUEyQjtJQUNqRCxJQUFJLE9BQU8sUUFBUSxLQUFLLFFBQVEsRUFBRTtRQUNqQyxRQUFRLEdBQUcsSUFBSSxDQUFDLFNBQVMsQ0FBQyxRQUFRLEVBQUUsSUFBSSxFQUFFLElBQUksQ0FBQyxDQUFDO0tBQ2hEO0lBRUQsT0FBTyxDQUFDLE1BQU0sQ0FBQyxLQUFLLENBQUMsUUFBUSxHQUFHLElBQUksQ0FBQyxDQUFDO0lBRXRDLE9BQU8sUUFBUSxDQUFDO0FBQ2pCLENBQUM7QUFFRCxTQUFTLGNBQWMsQ0FBQyxVQUFrQjtJQUN6QyxNQUFNLE9BQU8sR0FBRyxJQUFJLENBQUMsS0FBSyxDQUFDLFVBQVUsQ0FBWSxDQUFDO0lBSWxELE1BQU0sY0FBYyxHQUFHLGFBQWEsQ0FBQyxHQUFHLENBQUMsT0FBTyxDQUFDLElBQUksQ0FBQyxDQUFDO0lBQ3ZELElBQUksY0FBYyxFQUFFO1FBQUUsT0FBTyxhQUFhLENBQUMsY0FBYyxDQUFDLENBQUM7S0FBRTtJQUU3RCxNQUFNLFFBQVEsR0FBRyxTQUFTLENBQUMsT0FBTyxDQUFDLElBQUksQ0FBQyxDQUFDO0lBQ3pDLE1BQU0sV0FBVyxHQUFHLGFBQWEsQ0FBQyxRQUFRLENBQUMsQ0FBQztJQUU1QyxhQUFhLENBQUMsR0FBRyxDQUFDLE9BQU8sQ0FBQyxJQUFJLEVBQUUsV0FBVyxDQUFDLENBQUM7SUFDN0MsVUFBVSxDQUFDLEdBQUcsRUFBRTtRQUNmLGFBQWEsQ0FBQyxNQUFNLENBQUMsT0FBTyxDQUFDLElBQUksQ0FBQyxDQUFDO0lBQ3BDLENBQUMsRUFBRSxJQUFJLENBQUMsQ0FBQztJQUVULE9BQU8sV0FBVyxDQUFDO0FBQ3BCLENBQUM7QUFFRCxJQUFJLEtBQUssR0FBRyxFQUFFLENBQUM7QUFFZixPQUFPLENBQUMsS0FBSyxDQUFDLFdBQVcsQ0FBQyxNQUFNLENBQUMsQ0FBQztBQUNsQyxPQUFPLENBQUMsS0FBSyxDQUFDLEVBQUUsQ0FBQyxNQUFNLEVBQUUsQ0FBQyxLQUFhLEVBQUUsRUFBRTtJQUMxQyxNQUFNLEtBQUssR0FBRyxLQUFLLENBQUMsS0FBSyxDQUFDLE9BQU8sQ0FBQyxDQUFDO0lBQ25DLElBQUksS0FBSyxDQUFDLE1BQU0sSUFBSSxDQUFDLEVBQUU7UUFDdEIsS0FBSyxJQUFJLEtBQUssQ0FBQztRQUNmLE9BQU87S0FDUDtJQUVELE1BQU0sUUFBUSxHQUFHLEtBQUssQ0FBQyxNQUFNLENBQUMsQ0FBQyxDQUFDLEVBQUUsQ0FBQyxDQUFDLENBQUMsQ0FBQyxDQUFDLENBQUM7SUFDeEMsTUFBTSxTQUFTLEdBQUcsS0FBSyxDQUFDLE1BQU0sQ0FBQyxDQUFDLEVBQUUsQ0FBQyxDQUFDLENBQUMsQ0FBQyxDQUFDLENBQUM7SUFFeEMsY0FBYyxDQUFDLEtBQUssR0FBRyxTQUFTLENBQUMsQ0FBQztJQUVsQyxLQUFLLE1BQU0sSUFBSSxJQUFJLEtBQUssRUFBRTtRQUN6QixjQUFjLENBQUMsSUFBSSxDQUFDLENBQUM7S0FDckI7SUFFRCxLQUFLLEdBQUcsUUFBUSxDQUFDO0FBQ2xCLENBQUMsQ0FBQyxDQUFDIn0=
\ No newline at end of file
+//# sourceMappingURL=data:application/json;base64,eyJ2ZXJzaW9uIjozLCJmaWxlIjoiaW5kZXguanMiLCJzb3VyY2VSb290IjoiIiwic291cmNlcyI6WyIuLi9zb3VyY2UvaW5kZXgudHMiXSwibmFtZXMiOltdLCJtYXBwaW5ncyI6Ijs7QUFBQSxPQUFBLENBQUEsQ0FBQSxNQUFBLENBQUEsR0FBQSxDQUFBLE9BQUEsQ0FBQSxRQUFBLENBQUEsQ0FBQTtBQUVBLE1BQUEsT0FBQSxFQUFBLE9BQUEsQ0FBQSxDQUFBLE1BQUEsQ0FBQSxDQUFBO0FBQ0EsTUFBQSxHQUFBLEVBQUEsT0FBQSxDQUFBLENBQUEsRUFBQSxDQUFBLENBQUE7QUFDQSxNQUFBLE9BQUEsRUFBQSxPQUFBLENBQUEsQ0FBQSxNQUFBLENBQUEsQ0FBQTtBQUNBLE1BQUEsS0FBQSxFQUFBLE9BQUEsQ0FBQSxDQUFBLElBQUEsQ0FBQSxDQUFBO0FBQ0EsTUFBQSxPQUFBLEVBQUEsT0FBQSxDQUFBLENBQUEsTUFBQSxDQUFBLENBQUE7QUFDQSxNQUFBLFNBQUEsRUFBQSxPQUFBLENBQUEsQ0FBQSxNQUFBLENBQUEsTUFBQSxDQUFBLFFBQUEsQ0FBQSxDQUFBO0FBQ0EsTUFBQSxLQUFBLEVBQUEsT0FBQSxDQUFBLENBQUEsTUFBQSxDQUFBLE1BQUEsQ0FBQSxJQUFBLENBQUEsQ0FBQTtBQUNBLE1BQUEsWUFBQSxFQUFBLE9BQUEsQ0FBQSxDQUFBLE1BQUEsQ0FBQSxNQUFBLENBQUEsSUFBQSxDQUFBLE9BQUEsQ0FBQSxDQUFBO0FBQ0EsTUFBQSxPQUFBLEVBQUEsT0FBQSxDQUFBLENBQUEsTUFBQSxDQUFBLENBQUE7QUFDQSxNQUFBLEdBQUEsRUFBQSxPQUFBLENBQUEsQ0FBQSxVQUFBLENBQUEsQ0FBQTtBQW9KQSxHQUFHLENBQUMsT0FBTyxDQUFDLElBQUksQ0FBQyxPQUFPLEVBQUUsQ0FBQyxFQUFFO0lBQzVCLE1BQU0sSUFBSSxLQUFLLENBQUMsQ0FBQyxHQUFHLFFBQVEsVUFBVSxTQUFTLENBQUMsQ0FBQztBQUNsRDtBQUVBLE1BQU0saUJBQWlCLEVBQUUsSUFBSSxDQUFDLE9BQU8sQ0FBQyxPQUFPLENBQUMsSUFBSSxDQUFDLENBQUMsQ0FBQyxDQUFDO0FBQ3RELE1BQU0sZUFBZSxFQUFFLE9BQU8sQ0FBQyxJQUFJLENBQUMsT0FBTyxFQUFFLEVBQUUsRUFBRSxJQUFJLENBQUMsT0FBTyxDQUFDLE9BQU8sQ0FBQyxJQUFJLENBQUMsQ0FBQyxDQUFDLEVBQUUsRUFBRSxTQUFTO0FBQzFGLE1BQU0sa0JBQWtCLEVBQUUsSUFBSSxHQUFXLENBQUMsQ0FBQztBQUMzQyxNQUFNLGdCQUFnQixFQUFFLElBQUksS0FBYSxDQUFDLENBQUM7QUFDM0MsTUFBTSxlQUFlLEVBQUUsSUFBSSxHQUEwQixDQUFDLENBQUM7QUFDdkQsTUFBTSxVQUFVLEVBQUUsSUFBSSxHQUErQixDQUFDLENBQUM7QUFDdkQsTUFBTSxXQUFXLEVBQUUsSUFBSSxHQUFxQixDQUFDLENBQUM7QUFDOUMsTUFBTSxjQUFjLEVBQUUsSUFBSSxPQUFxQyxDQUFDLENBQUM7QUFDakUsTUFBTSxtQkFBbUIsRUFBRSxJQUFJLE9BQStDLENBQUMsQ0FBQztBQUNoRixNQUFNLFdBQVcsRUFBRSxJQUFJLEdBQXlCLENBQUMsQ0FBQztBQUNsRCxNQUFNLGlCQUFpQixFQUFFLElBQUksR0FBb0IsQ0FBQyxDQUFDO0FBQ25ELE1BQU0sYUFBYSxFQUFFLElBQUksR0FBMEIsQ0FBQyxDQUFDO0FBSXJELE1BQU0sYUFBYSxFQUFFLEdBQUcsRUFBRSxHQUFHLEVBQUUsSUFBSTtBQUNuQyxNQUFNLEVBQUUsZUFBZSxFQUFFLFdBQVcsRUFBRSxFQUFFLFdBQVcsQ0FBQyxDQUFDO0FBQ3JELE1BQU0sWUFBWSxFQUFFLGNBQWMsQ0FBQyxDQUFDO0FBQ3BDLE1BQU0sc0JBQXNCLEVBQUUsRUFBRSxDQUFDLDJCQUEyQixDQUFDLGdCQUFnQixFQUFFLFNBQVMsQ0FBQyxFQUFFLFFBQVEsQ0FBQyxXQUFXLENBQUMsQ0FBQyxDQUFDO0FBR2xILE1BQU0sZUFBZSxFQUFFLGVBQWUsQ0FBQyxPQUFPLENBQUMsQ0FBQyxFQUFFLFVBQVUsQ0FBQyxFQUFFLGVBQWUsQ0FBQyxPQUFPLENBQUMsRUFBRSxFQUFFLENBQUMsVUFBVSxDQUFDLE1BQU07QUFJN0csTUFBTSxnQkFBZ0IsRUFBRSxTQUE0QixDQUFDLENBQUMsV0FBVyxDQUFDLElBQUksQ0FBQyxDQUFDO0FBSXhFLE1BQU0sY0FBYyxFQUFFLFNBQXlCLENBQUMsQ0FBQyxTQUFTLENBQUMsSUFBSSxDQUFDLENBQUM7QUFFakUsTUFBTSxnQkFBZ0IsRUFBRSxxQkFBcUIsQ0FBQyxDQUFDO0FBSS9DLE1BQU0sZUFBZSxFQUFFLElBQUksT0FBMkIsQ0FBQyxDQUFDO0FBRXhELFNBQVMsV0FBVyxDQUFDLEVBQUU7SUFDdEIsTUFBTSxXQUFXLEVBQUUsRUFBRSxDQUFDLGNBQWMsQ0FBQyxnQkFBZ0IsRUFBRSxFQUFFLENBQUMsR0FBRyxDQUFDLFVBQVUsQ0FBQztJQUN6RSxHQUFHLENBQUMsQ0FBQyxVQUFVLEVBQUU7UUFDaEIsTUFBTSxJQUFJLEtBQUssQ0FBQyxDQUFDLE9BQU8sR0FBRyxLQUFLLFNBQVMsRUFBRSxFQUFFLENBQUMsQ0FBQyxnQkFBZ0IsQ0FBQyxDQUFDLENBQUM7SUFDbkU7SUFFQSxNQUFNLFdBQVcsRUFBRSxFQUFFLENBQUMsY0FBYyxDQUFDLFVBQVUsRUFBRSxFQUFFLENBQUMsR0FBRyxDQUFDLFFBQVEsQ0FBQztJQUNqRSxHQUFHLENBQUMsVUFBVSxDQUFDLEtBQUssRUFBRTtRQUNyQixNQUFNLElBQUksS0FBSyxDQUFDLGdCQUFnQixDQUFDLFVBQVUsQ0FBQyxLQUFLLENBQUMsQ0FBQztJQUNwRDtJQUVBLE1BQU0sT0FBTyxFQUFFLEVBQUUsQ0FBQywwQkFBMEI7UUFDM0MsVUFBVSxDQUFDLE1BQU07UUFDakI7WUFDQyxhQUFhLEVBQUUsRUFBRSxDQUFDLEdBQUcsQ0FBQyxhQUFhO1lBQ25DLFVBQVUsRUFBRSxFQUFFLENBQUMsR0FBRyxDQUFDLFVBQVU7WUFDN0IsUUFBUSxFQUFFLEVBQUUsQ0FBQyxHQUFHLENBQUMsUUFBUTtZQUN6Qix5QkFBeUIsRUFBRTtRQUM1QixDQUFDO1FBQ0Q7SUFDRCxDQUFDO0lBRUQsR0FBRyxDQUFDLE1BQU0sQ0FBQyxNQUFNLENBQUMsTUFBTSxFQUFFO1FBQ3pCLE1BQU0sSUFBSSxLQUFLLENBQUMsTUFBTSxDQUFDLE1BQU0sQ0FBQyxHQUFHLENBQUMsTUFBTSxDQUFDLEVBQUU7WUFDMUMsZ0JBQWdCLENBQUMsS0FBSztRQUN2QixDQUFDLENBQUMsQ0FBQyxJQUFJLENBQUMsQ0FBQyxDQUFDLENBQUMsQ0FBQyxDQUFDLENBQUM7SUFDZjtJQUdBLE1BQU0sV0FBdUIsRUFBRSxVQUFVLENBQUMsTUFBTSxDQUFDLElBQUksQ0FBQyxFQUFFLENBQUMsQ0FBQztJQUUxRCxPQUFPLEVBQUUsZUFBZSxFQUFFLE1BQU0sQ0FBQyxPQUFPLEVBQUUsVUFBVSxFQUFFLFdBQVcsQ0FBQztBQUNuRTtBQUVBLFNBQVMsZ0JBQWdCLENBQUMsVUFBeUIsRUFBRTtJQUNwRCxNQUFNLElBQUksRUFBRSxFQUFFLENBQUMsNEJBQTRCLENBQUMsVUFBVSxDQUFDLFdBQVcsRUFBRSxDQUFDLENBQUMsQ0FBQyxDQUFDLENBQUM7SUFFekUsR0FBRyxDQUFDLENBQUMsVUFBVSxDQUFDLElBQUksRUFBRTtRQUNyQixPQUFPLENBQUMsQ0FBQyxFQUFFLENBQUMsRUFBRSxDQUFDLENBQUMsR0FBRyxDQUFDLENBQUM7SUFDdEI7SUFFQSxNQUFNLElBQUksRUFBRSxVQUFVLENBQUMsSUFBSSxDQUFDLDZCQUE2QjtRQUN4RCxVQUFVLENBQUMsTUFBTSxDQUFDLEVBQUU7SUFDckIsQ0FBQztJQUVELE1BQU0sS0FBSyxFQUFFLElBQUksQ0FBQyxRQUFRLENBQUMsVUFBVSxDQUFDLElBQUksQ0FBQyxRQUFRLENBQUM7SUFDcEQsTUFBTSxLQUFLLEVBQUUsR0FBRyxDQUFDLEtBQUssRUFBRSxDQUFDO0lBQ3pCLE1BQU0sS0FBSyxFQUFFLEdBQUcsQ0FBQyxVQUFVLEVBQUUsQ0FBQztJQUM5QixNQUFNLFNBQVMsRUFBRSxVQUFVLENBQUMsUUFBUTtJQUNwQyxNQUFNLEtBQUssRUFBRSxFQUFFLENBQUMsa0JBQWtCLENBQUMsUUFBUSxDQUFDLENBQUMsV0FBVyxDQUFDLENBQUM7SUFDMUQsTUFBTSxLQUFLLEVBQUUsVUFBVSxDQUFDLElBQUk7SUFFNUIsT0FBTyxDQUFDLENBQUMsRUFBRSxDQUFDLEVBQUUsQ0FBQyxDQUFDLElBQUksQ0FBQyxDQUFDLENBQUMsQ0FBQyxJQUFJLENBQUMsQ0FBQyxDQUFDLENBQUMsSUFBSSxDQUFDLENBQUMsRUFBRSxDQUFDLENBQUMsSUFBSSxFQUFFLEdBQUcsQ0FBQyxJQUFJLENBQUMsRUFBRSxDQUFDLENBQUMsR0FBRyxDQUFDLENBQUM7QUFDbkU7QUFFQSxTQUFTLHFCQUFxQixDQUFDLEVBQUU7SUFDaEMsT0FBTyxFQUFFLENBQUMscUJBQXFCLENBQUM7UUFDL0Isa0JBQWtCLEVBQUUsQ0FBQyxFQUFFLENBQUMsRUFBRSxlQUFlO1FBQ3pDLGdCQUFnQixFQUFFLFNBQVMsQ0FBQyxFQUFFO1lBQzdCLE1BQU0sY0FBYyxFQUFFLGNBQWMsQ0FBQyxHQUFHLENBQUMsUUFBUSxDQUFDO1lBQ2xELE9BQU8sY0FBYyxFQUFFLGFBQWEsQ0FBQyxPQUFPLENBQUMsUUFBUSxDQUFDLEVBQUUsRUFBRSxDQUFDLENBQUMsQ0FBQztRQUM5RCxDQUFDO1FBQ0QsaUJBQWlCLEVBQUUsU0FBUyxDQUFDLEVBQUU7WUFDOUIsTUFBTSxlQUFlLEVBQUUsU0FBUyxDQUFDLEdBQUcsQ0FBQyxRQUFRLENBQUM7WUFDOUMsR0FBRyxDQUFDLGNBQWMsRUFBRSxFQUFFLE9BQU8sY0FBYyxFQUFFO1lBRTdDLE1BQU0sWUFBWSxFQUFFLEVBQUUsQ0FBQyxHQUFHLENBQUMsUUFBUSxDQUFDLFFBQVEsQ0FBQztZQUM3QyxHQUFHLENBQUMsWUFBWSxDQUFDLENBQUMsRUFBRSxTQUFTLEVBQUU7Z0JBQzlCLGNBQWMsQ0FBQyxNQUFNLENBQUMsUUFBUSxDQUFDO2dCQUMvQixPQUFPLFNBQVM7WUFDakI7WUFFQSxNQUFNLFNBQVMsRUFBRSxFQUFFLENBQUMsY0FBYyxDQUFDLFVBQVUsQ0FBQyxXQUFXLENBQUM7WUFHMUQsR0FBRyxDQUFDLFFBQVEsQ0FBQyxNQUFNLENBQUMsQ0FBQyxZQUFZLENBQUMsRUFBRSxDQUFDLENBQUMsRUFBRSxDQUFDLENBQUMsRUFBRTtnQkFDM0MsU0FBUyxDQUFDLEdBQUcsQ0FBQyxRQUFRLEVBQUUsUUFBUSxDQUFDO1lBQ2xDO1lBRUEsR0FBRyxDQUFDLENBQUMsY0FBYyxDQUFDLEdBQUcsQ0FBQyxRQUFRLENBQUMsRUFBRTtnQkFDbEMsY0FBYyxDQUFDLEdBQUcsQ0FBQyxRQUFRLEVBQUU7b0JBQzVCLE9BQU8sRUFBRSxDQUFDO29CQUNWLFlBQVksRUFBRSxJQUFJLENBQUMsR0FBRyxDQUFDO2dCQUN4QixDQUFDLENBQUM7WUFDSDtZQUVBLE1BQU0sY0FBYyxFQUFFLGNBQWMsQ0FBQyxHQUFHLENBQUMsUUFBUSxDQUFDO1lBQ2xELEdBQUcsQ0FBQyxDQUFDLGFBQWEsRUFBRSxFQUFFLE9BQU8sU0FBUyxFQUFFO1lBRXhDLE1BQU0sYUFBYSxFQUFFLGVBQWUsQ0FBQyxRQUFRLENBQUM7WUFDOUMsR0FBRyxDQUFDLGFBQWEsRUFBRSxhQUFhLENBQUMsWUFBWSxFQUFFO2dCQUM5QyxhQUFhLENBQUMsYUFBYSxFQUFFLFlBQVk7Z0JBQ3pDLGFBQWEsQ0FBQyxRQUFRLENBQUMsRUFBRSxDQUFDO1lBQzNCO1lBRUEsT0FBTyxRQUFRO1FBQ2hCLENBQUM7UUFDRCxrQkFBa0IsRUFBRSxDQUFDLFdBQVcsRUFBRSxjQUFjLEVBQUUsQ0FBQyxFQUFFO1lBQ3BELFdBQVcsQ0FBQyxHQUFHLENBQUMsV0FBVyxDQUFDLEVBQUUsaUJBQWlCLENBQUMsVUFBVSxFQUFFLGNBQWMsQ0FBQztRQUM1RSxDQUFDO1FBQ0QsbUJBQW1CLEVBQUUsQ0FBQyxFQUFFLENBQUMsRUFBRSxnQkFBZ0I7UUFDM0Msc0JBQXNCLEVBQUUsQ0FBQyxFQUFFLENBQUMsRUFBRSxlQUFlO1FBQzdDLHFCQUFxQixFQUFFLEVBQUUsQ0FBQyxxQkFBcUI7UUFDL0MsVUFBVSxFQUFFLEVBQUUsQ0FBQyxHQUFHLENBQUMsVUFBVTtRQUM3QixRQUFRLEVBQUUsRUFBRSxDQUFDLEdBQUcsQ0FBQyxRQUFRO1FBQ3pCLGFBQWEsRUFBRSxFQUFFLENBQUMsR0FBRyxDQUFDO0lBQ3ZCLENBQUMsRUFBRSxFQUFFLENBQUMsc0JBQXNCLENBQUMsQ0FBQyxDQUFDO0FBQ2hDO0FBRUEsU0FBUyxjQUFjLENBQUMsRUFBRTtJQUN6QixPQUFPLE1BQU0sQ0FBQyxVQUFVLENBQUMsQ0FBQyxJQUFJLENBQUMsQ0FBQyxDQUFDLE1BQU0sQ0FBQyxJQUFJLENBQUMsU0FBUyxDQUFDLGVBQWUsQ0FBQyxDQUFDLENBQUMsTUFBTSxDQUFDLENBQUMsR0FBRyxDQUFDLENBQUM7QUFDdkY7QUFFQSxTQUFTLFNBQVksQ0FBQyxRQUFnQixFQUFnQjtJQUNyRCxNQUFNLFdBQXlCLEVBQUUsRUFBRSxXQUFXLEVBQUUsV0FBVyxFQUFFLE9BQU8sRUFBRSxDQUFDLEVBQUUsQ0FBQztJQUMxRSxHQUFHLENBQUMsQ0FBQyxjQUFjLEVBQUUsRUFBRSxPQUFPLFVBQVUsRUFBRTtJQUUxQyxJQUFJO1FBQ0gsTUFBTSxVQUFVLEVBQUUsSUFBSSxDQUFDLEtBQUs7WUFDM0IsRUFBRSxDQUFDLFlBQVksQ0FBQyxJQUFJLENBQUMsSUFBSSxDQUFDLGNBQWMsRUFBRSxRQUFRLENBQUMsRUFBRSxDQUFDLElBQUksQ0FBQztRQUM1RCxDQUFpQjtRQUdqQixPQUFPLENBQUMsU0FBUyxDQUFDLFlBQVksQ0FBQyxDQUFDLEVBQUUsWUFBWSxDQUFDLEVBQUUsU0FBUyxDQUFDLE9BQU8sRUFBRSxFQUFFLFVBQVUsRUFBRSxVQUFVO0lBQzdGO0lBQ0EsTUFBTTtRQUNMLE9BQU8sVUFBVTtJQUNsQjtBQUNEO0FBRUEsU0FBUyxTQUFZLENBQUMsUUFBZ0IsRUFBRSxLQUFtQixFQUFFLE9BQTRDLEVBQUU7SUFDMUcsR0FBRyxDQUFDLENBQUMsZUFBZSxDQUFDLEVBQUUsVUFBVSxDQUFDLEdBQUcsQ0FBQyxRQUFRLENBQUMsRUFBRSxFQUFFLE1BQU0sRUFBRTtJQUczRCxNQUFNLFVBQVUsRUFBRSxVQUFVLENBQUMsQ0FBQyxFQUFFLENBQUMsRUFBRTtRQUNsQyxVQUFVLENBQUMsTUFBTSxDQUFDLFFBQVEsQ0FBQztRQUUzQixJQUFJO1lBRUgsTUFBTSxXQUFXLEVBQUUsU0FBWSxDQUFDLFFBQVEsQ0FBQztZQUN6QyxNQUFNLFlBQTBCLEVBQUU7Z0JBQ2pDLFdBQVcsRUFBRSxXQUFXO2dCQUN4QixPQUFPLEVBQUUsRUFBRSxDQUFDLENBQUMsQ0FBQyxVQUFVLENBQUMsT0FBTyxFQUFFLENBQUMsQ0FBQyxDQUFDLEtBQUssQ0FBQyxRQUFRO1lBQ3BELENBQUM7WUFFRCxFQUFFLENBQUMsU0FBUyxDQUFDLGNBQWMsRUFBRSxFQUFFLFNBQVMsRUFBRSxLQUFLLENBQUMsQ0FBQztZQUdqRCxNQUFNLFVBQVUsRUFBRSxJQUFJLENBQUMsSUFBSSxDQUFDLGNBQWMsRUFBRSxRQUFRLENBQUM7WUFDckQsTUFBTSxTQUFTLEVBQUUsQ0FBQyxDQUFDLENBQUMsU0FBUyxDQUFDLENBQUMsQ0FBQyxDQUFDLE9BQU8sQ0FBQyxHQUFHLENBQUMsQ0FBQyxHQUFHLENBQUM7WUFDbEQsRUFBRSxDQUFDLGFBQWEsQ0FBQyxRQUFRLEVBQUUsSUFBSSxDQUFDLFNBQVMsQ0FBQyxXQUFXLENBQUMsQ0FBQztZQUN2RCxFQUFFLENBQUMsVUFBVSxDQUFDLFFBQVEsRUFBRSxTQUFTLENBQUM7WUFFbEMsR0FBRyxDQUFDLE9BQU8sRUFBRSxFQUFFLE9BQU8sQ0FBQyxXQUFXLENBQUMsRUFBRTtRQUN0QztRQUNBLE1BQU0sQ0FBQyxLQUFLLEVBQUU7WUFDYixPQUFPLENBQUMsTUFBTSxDQUFDLEtBQUssQ0FBQyxDQUFDLE9BQU8sR0FBRyxLQUFLLENBQUMsQ0FBQyxRQUFRLENBQUMsRUFBRSxDQUFDLENBQUMsS0FBSyxDQUFDLENBQUMsQ0FBQyxDQUFDLENBQUM7UUFDL0Q7SUFDRCxDQUFDLEVBQUUsSUFBSSxDQUFDO0lBRVIsU0FBUyxDQUFDLEtBQUssQ0FBQyxDQUFDO0lBQ2pCLFVBQVUsQ0FBQyxHQUFHLENBQUMsUUFBUSxFQUFFLFNBQVMsQ0FBQztBQUNwQztBQUVBLFNBQVMsUUFBUSxDQUFDLElBQVksRUFBRTtJQUMvQixPQUFPLE1BQU0sQ0FBQyxVQUFVLENBQUMsQ0FBQyxJQUFJLENBQUMsQ0FBQyxDQUFDLE1BQU0sQ0FBQyxJQUFJLENBQUMsQ0FBQyxNQUFNLENBQUMsQ0FBQyxHQUFHLENBQUMsQ0FBQztBQUM1RDtBQUdBLFNBQVMsV0FBVyxDQUFDLFFBQWdCLEVBQUU7SUFDdEMsTUFBTSxhQUFhLEVBQUUsRUFBRSxDQUFDLEdBQUcsQ0FBQyxlQUFnQixDQUFDLFFBQVEsQ0FBQztJQUN0RCxHQUFHLENBQUMsQ0FBQyxZQUFZLEVBQUUsRUFBRSxPQUFPLFNBQVMsRUFBRTtJQUd2QyxNQUFNLFdBQVcsRUFBRSxVQUFVLENBQUMsR0FBRyxDQUFDLFFBQVEsQ0FBQztJQUMzQyxHQUFHLENBQUMsV0FBVyxDQUFDLEVBQUUsVUFBVSxDQUFDLGFBQWEsQ0FBQyxDQUFDLEVBQUUsWUFBWSxDQUFDLE9BQU8sQ0FBQyxDQUFDLEVBQUU7UUFDckUsT0FBTyxVQUFVLENBQUMsSUFBSTtJQUN2QjtJQUVBLE1BQU0sUUFBUSxFQUFFLEVBQUUsQ0FBQyxHQUFHLENBQUMsUUFBUSxDQUFDLFFBQVEsQ0FBQztJQUN6QyxHQUFHLENBQUMsUUFBUSxDQUFDLENBQUMsRUFBRSxTQUFTLEVBQUUsRUFBRSxPQUFPLFNBQVMsRUFBRTtJQUUvQyxNQUFNLEtBQUssRUFBRSxRQUFRLENBQUMsT0FBTyxDQUFDO0lBQzlCLFVBQVUsQ0FBQyxHQUFHLENBQUMsUUFBUSxFQUFFLEVBQUUsWUFBWSxFQUFFLFlBQVksQ0FBQyxPQUFPLENBQUMsQ0FBQyxFQUFFLElBQUksRUFBRSxLQUFLLENBQUMsQ0FBQztJQUU5RSxPQUFPLElBQUk7QUFDWjtBQUVBLFNBQVMsaUJBQWlCLENBQUMsVUFBa0IsRUFBRSxjQUFzQixFQUFxQztJQUN6RyxNQUFNLGFBQWEsRUFBRSxFQUFFLENBQUMsR0FBRyxDQUFDLGVBQWdCLENBQUMsY0FBYyxDQUFDO0lBQzVELE1BQU0sU0FBUyxFQUFFLGFBQWEsRUFBRSxZQUFZLENBQUMsT0FBTyxDQUFDLEVBQUUsRUFBRSxDQUFDO0lBRTFELElBQUksV0FBVyxFQUFFLGVBQWUsQ0FBQyxPQUFPLENBQUMsY0FBYyxDQUFDO0lBQ3hELEdBQUcsQ0FBQyxXQUFXLENBQUMsRUFBRSxVQUFVLENBQUMsYUFBYSxDQUFDLENBQUMsRUFBRSxRQUFRLEVBQUU7UUFDdkQsTUFBTSxhQUFhLEVBQUUsVUFBVSxDQUFDLE9BQU8sQ0FBQyxVQUFVLENBQUM7UUFDbkQsR0FBRyxDQUFDLGFBQWEsQ0FBQyxFQUFFLEVBQUUsQ0FBQyxHQUFHLENBQUMsVUFBVSxDQUFDLFlBQVksQ0FBQyxnQkFBZ0IsQ0FBQyxFQUFFO1lBQ3JFLE9BQU8sWUFBWTtRQUNwQjtJQUNEO0lBQ0EsS0FBSztRQUNKLFdBQVcsRUFBRSxFQUFFLFlBQVksRUFBRSxRQUFRLEVBQUUsT0FBTyxFQUFFLENBQUMsRUFBRSxDQUFDO1FBQ3BELGVBQWUsQ0FBQyxPQUFPLENBQUMsY0FBYyxFQUFFLEVBQUUsVUFBVTtJQUNyRDtJQUVBLE1BQU0sZUFBZSxFQUFFLEVBQUUsQ0FBQyxpQkFBaUI7UUFDMUMsVUFBVTtRQUNWLGNBQWM7UUFDZCxlQUFlO1FBQ2YsRUFBRSxDQUFDLEdBQUc7UUFDTjtJQUNELENBQUMsQ0FBQyxjQUFjO0lBR2hCLEdBQUcsQ0FBQyxjQUFjLEVBQUU7UUFDbkIsVUFBVSxDQUFDLE9BQU8sQ0FBQyxVQUFVLEVBQUUsRUFBRSxjQUFjO1FBQy9DLFNBQVMsQ0FBQyxDQUFDLFdBQVcsQ0FBQyxJQUFJLENBQUMsRUFBRSxlQUFlLENBQUM7SUFDL0M7SUFFQSxPQUFPLGNBQWM7QUFDdEI7QUFFQSxTQUFTLGVBQWUsQ0FBQyxRQUFnQixFQUFFO0lBQzFDLE1BQU0sYUFBYSxFQUFFLEVBQUUsQ0FBQyxHQUFHLENBQUMsZUFBZ0IsQ0FBQyxRQUFRLENBQUM7SUFDdEQsR0FBRyxDQUFDLENBQUMsWUFBWSxFQUFFO1FBQ2xCLE1BQU0sSUFBSSxLQUFLLENBQUMsQ0FBQyxPQUFPLEdBQUcsSUFBSSxLQUFLLFNBQVMsS0FBSyxHQUFHLEVBQUUsQ0FBQyxDQUFDLENBQUMsUUFBUSxDQUFDLENBQUMsQ0FBQyxDQUFDO0lBQ3ZFO0lBRUEsT0FBTyxZQUFZLENBQUMsT0FBTyxDQUFDLENBQUM7QUFDOUI7QUFFQSxTQUFTLG1CQUFtQixDQUFDLFFBQWdCLEVBQUU7SUFDOUMsTUFBTSxhQUFhLEVBQUUsZUFBZSxDQUFDLFFBQVEsQ0FBQztJQUU5QyxJQUFJLGNBQWMsRUFBRSxjQUFjLENBQUMsR0FBRyxDQUFDLFFBQVEsQ0FBQztJQUNoRCxHQUFHLENBQUMsQ0FBQyxhQUFhLEVBQUU7UUFDbkIsY0FBYyxFQUFFO1lBQ2YsT0FBTyxFQUFFLENBQUM7WUFDVixZQUFZLEVBQUU7UUFDZixDQUFDO1FBRUQsZUFBZSxDQUFDLElBQUksQ0FBQyxRQUFRLENBQUM7UUFDOUIsY0FBYyxDQUFDLEdBQUcsQ0FBQyxRQUFRLEVBQUUsYUFBYSxDQUFDO0lBQzVDO0lBQ0EsS0FBSztRQUNKLGFBQWEsQ0FBQyxRQUFRLENBQUMsRUFBRSxDQUFDO0lBQzNCO0lBRUEsT0FBTyxFQUFFLGFBQWEsRUFBRSxhQUFhLENBQUM7QUFDdkM7QUFJQSxTQUFTLFVBQVU7SUFDbEIsU0FBbUI7SUFDbkI7QUFDRCxFQUFFO0lBQ0QsTUFBTSxTQUFTLEVBQUUsU0FBUyxDQUFDLEdBQUcsQ0FBQyxtQkFBbUIsQ0FBQztJQUVuRCxNQUFNLFFBQVEsRUFBRSxlQUFlLENBQUMsVUFBVSxDQUFDLENBQUM7SUFDNUMsR0FBRyxDQUFDLFFBQVEsQ0FBQyxDQUFDLEVBQUUsU0FBUyxFQUFFO1FBQzFCLE1BQU0sSUFBSSxLQUFLLENBQUMsQ0FBQyxPQUFPLEdBQUcsSUFBSSxPQUFPLENBQUMsQ0FBQztJQUN6QztJQUVBLFNBQVMsQ0FBQyxPQUFPLENBQUMsQ0FBQyxRQUFRLEVBQUUsS0FBSyxFQUFFLENBQUMsRUFBRTtRQUN0QyxNQUFNLEVBQUUsYUFBYSxFQUFFLGFBQWEsRUFBRSxFQUFFLFFBQVEsQ0FBQyxLQUFLLENBQUM7UUFFdkQsSUFBSSxRQUFrQjtRQUN0QixJQUFJO1lBQ0gsU0FBUyxFQUFFLFNBQVMsQ0FBQyxPQUFPLEVBQUUsUUFBUSxFQUFFLGFBQWEsRUFBRSxZQUFZLENBQUM7UUFDckU7UUFDQSxNQUFNLENBQUMsS0FBSyxFQUFFO1lBRWIsVUFBVSxDQUFDLFFBQVEsRUFBRSxFQUFFLE1BQU0sRUFBRSxDQUFDLENBQUMsQ0FBQyxHQUFHLENBQUMsRUFBRSxDQUFDLENBQUMsS0FBSyxDQUFDLE1BQU0sQ0FBQyxFQUFFLEtBQUssQ0FBQyxDQUFDLEVBQUUsQ0FBQyxDQUFDO1lBQ3BFLE1BQU07UUFDUDtRQUVBLFVBQVUsQ0FBQyxRQUFRLEVBQUUsUUFBUSxFQUFFLE9BQU8sQ0FBQztJQUN4QyxDQUFDLENBQUM7QUFDSDtBQUVBLFNBQVMsU0FBUztJQUNqQixPQUFtQjtJQUNuQixRQUFnQjtJQUNoQixhQUE0QjtJQUM1QjtBQUNELEVBQVk7SUFDWCxNQUFNLFdBQVcsRUFBRSxPQUFPLENBQUMsYUFBYSxDQUFDLFFBQVEsQ0FBQztJQUNsRCxHQUFHLENBQUMsV0FBVyxDQUFDLENBQUMsRUFBRSxTQUFTLEVBQUU7UUFDN0IsTUFBTSxJQUFJLEtBQUssQ0FBQyxDQUFDLE9BQU8sR0FBRyxJQUFJLE9BQU8sSUFBSSxFQUFFLENBQUMsQ0FBQyxRQUFRLENBQUMsQ0FBQyxDQUFDO0lBQzFEO0lBRUEsTUFBTSxZQUFZLEVBQUUsRUFBRSxDQUFDLHFCQUFxQixDQUFDLE9BQU8sRUFBRSxVQUFVLENBQUM7SUFDakUsTUFBTSxPQUFPLEVBQUUsV0FBVyxDQUFDLEdBQUcsQ0FBQyxnQkFBZ0IsQ0FBQztJQUNoRCxHQUFHLENBQUMsTUFBTSxDQUFDLE9BQU8sRUFBRSxDQUFDLEVBQUU7UUFDdEIsT0FBTyxFQUFFLE1BQU0sRUFBRSxPQUFPLENBQUM7SUFDMUI7SUFFQSxNQUFNLE9BQU8sRUFBRSxRQUFRLENBQUMsUUFBUSxDQUFDO0lBQ2pDLEdBQUcsQ0FBQyxPQUFPLENBQUMsQ0FBQyxFQUFFLFNBQVMsRUFBRTtRQUN6QixNQUFNLElBQUksS0FBSyxDQUFDLENBQUMsS0FBSyxPQUFPLENBQUMsQ0FBQztJQUNoQztJQUVBLGFBQWEsQ0FBQyxhQUFhLEVBQUUsWUFBWTtJQUV6QyxNQUFNLGNBQWMsRUFBRSxJQUFJLENBQUMsS0FBSyxDQUFDLFFBQVEsQ0FBQyxDQUFDLEdBQUc7SUFDOUMsTUFBTSxTQUFTLEVBQUUsSUFBSSxDQUFDLFFBQVEsQ0FBQyxRQUFRLENBQUM7SUFDeEMsTUFBTSxVQUFVLEVBQUUsUUFBUSxDQUFDLE9BQU8sQ0FBQyxhQUFhLEVBQUUsQ0FBQyxDQUFDLENBQUM7SUFFckQsTUFBTSxVQUFVLEVBQUU7UUFDakIsVUFBVSxDQUFDO1lBQ1YsQ0FBQyxNQUFNLENBQUMsRUFBRSxDQUFDLHFCQUFxQjtZQUNoQyxDQUFDLE1BQU0sQ0FBQyxFQUFFLENBQUMsRUFBRSxDQUFDLENBQUMsS0FBSyxDQUFDLENBQUMsRUFBRSxTQUFTO1lBQ2pDLENBQUMsTUFBTSxDQUFDLFVBQVU7WUFDbEIsQ0FBQyxHQUFHLENBQUMsWUFBWSxDQUFDO2dCQUNqQixhQUFhO29CQUNaLFdBQVc7b0JBQ1gsUUFBUTtvQkFDUixPQUFPO29CQUNQLFVBQVU7b0JBQ1YsTUFBTSxDQUFDO1lBQ1QsQ0FBQyxNQUFNLENBQUMsVUFBVTtJQUNwQixDQUFDO0lBRUQsTUFBTSxhQUFhLEVBQUUsZ0JBQWdCLENBQUMsT0FBTyxFQUFFLFVBQVUsQ0FBQztJQUUxRCxPQUFPO1FBQ04sTUFBTSxFQUFFLE1BQU07UUFDZCxRQUFRLEVBQUUsUUFBUTtRQUNsQixJQUFJLEVBQUUsU0FBUztRQUNmLElBQUksRUFBRSxRQUFRO1FBQ2QsTUFBTSxFQUFFLE1BQU07UUFDZCxPQUFPLEVBQUUsU0FBUztRQUNsQixZQUFZLEVBQUU7SUFDZixDQUFDO0FBQ0Y7QUFHQSxTQUFTLFFBQVEsQ0FBQyxRQUFnQixFQUFFO0lBQ25DLE1BQU0sV0FBVyxFQUFFLGVBQWUsQ0FBQyxhQUFhLENBQUMsUUFBUSxDQUFDO0lBQzFELEdBQUcsQ0FBQyxVQUFVLENBQUMsV0FBVyxFQUFFLEVBQUUsT0FBTyxTQUFTLEVBQUU7SUFFaEQsTUFBTSxVQUFVLEVBQUUsVUFBVSxDQUFDLFdBQVcsQ0FBQyxNQUFNO0lBQy9DLEdBQUcsQ0FBQyxVQUFVLENBQUMsQ0FBQyxFQUFFLENBQUMsRUFBRTtRQUNwQixNQUFNLElBQUksS0FBSyxDQUFDLENBQUMsV0FBVyxPQUFPLEdBQUcsT0FBTyxLQUFLLEVBQUUsQ0FBQyxDQUFDLFNBQVMsQ0FBQyxDQUFDLENBQUM7SUFDbkU7SUFFQSxPQUFPLFVBQVUsQ0FBQyxXQUFXLENBQUMsQ0FBQyxDQUFDLENBQUMsSUFBSTtBQUN0QztBQUdBLFNBQVMsYUFBYSxDQUFDLFdBQStCLEVBQTBCO0lBQy9FLE1BQU0sT0FBbUIsRUFBRSxJQUFJLEdBQUcsQ0FBQyxDQUFDO0lBRXBDLElBQUksVUFBVSxFQUFFLENBQUM7SUFDakIsSUFBSSxDQUFDLE1BQU0sT0FBTyxHQUFHLFdBQVcsQ0FBQyxPQUFPLEVBQUU7UUFDekMsR0FBRyxDQUFDLENBQUMsRUFBRSxDQUFDLFlBQVksQ0FBQyxNQUFNLENBQUMsSUFBSSxFQUFFLENBQUMsRUFBRSxDQUFDLEVBQUUsQ0FBQyxlQUFlLENBQUMsTUFBTSxDQUFDLElBQUksQ0FBQyxFQUFFLEVBQUUsT0FBTyxTQUFTLEVBQUU7UUFFM0YsTUFBTSxZQUFZLEVBQUUsTUFBTSxDQUFDLFdBQVc7UUFFdEMsSUFBSSxLQUFrQztRQUN0QyxHQUFHLENBQUMsWUFBWSxDQUFDLENBQUMsRUFBRSxTQUFTLEVBQUU7WUFDOUIsTUFBTSxFQUFFLFNBQVM7UUFDbEI7UUFDQSxLQUFLLEdBQUcsQ0FBQyxFQUFFLENBQUMsZ0JBQWdCLENBQUMsV0FBVyxDQUFDLEVBQUU7WUFDMUMsTUFBTSxFQUFFLE1BQU0sQ0FBQyxXQUFXLENBQUMsSUFBSSxDQUFDO1FBQ2pDO1FBQ0EsS0FBSyxHQUFHLENBQUMsRUFBRSxDQUFDLGVBQWUsQ0FBQyxXQUFXLENBQUMsRUFBRTtZQUN6QyxNQUFNLEVBQUUsV0FBVyxDQUFDLElBQUk7UUFDekI7UUFDQSxLQUFLLEdBQUc7WUFDUCxFQUFFLENBQUMsdUJBQXVCLENBQUMsV0FBVyxFQUFFLENBQUM7WUFDekMsV0FBVyxDQUFDLFNBQVMsQ0FBQyxDQUFDLEVBQUUsRUFBRSxDQUFDLFVBQVUsQ0FBQyxXQUFXLENBQUM7WUFDbkQsRUFBRSxDQUFDLGdCQUFnQixDQUFDLFdBQVcsQ0FBQyxPQUFPO1FBQ3hDLEVBQUU7WUFDRCxNQUFNLEVBQUUsQ0FBQyxNQUFNLENBQUMsV0FBVyxDQUFDLE9BQU8sQ0FBQyxJQUFJLENBQUM7UUFDMUM7UUFFQSxHQUFHLENBQUMsTUFBTSxDQUFDLENBQUMsRUFBRSxTQUFTLEVBQUUsRUFBRSxPQUFPLFNBQVMsRUFBRTtRQUU3QyxNQUFNLENBQUMsR0FBRyxDQUFDLE1BQU0sQ0FBQyxJQUFJLENBQUMsSUFBSSxFQUFFLEtBQUssQ0FBQztRQUVuQyxHQUFHLENBQUMsT0FBTyxNQUFNLENBQUMsQ0FBQyxFQUFFLENBQUMsTUFBTSxDQUFDLEVBQUUsRUFBRSxVQUFVLEVBQUUsTUFBTSxFQUFFLENBQUMsRUFBRTtJQUN6RDtJQUVBLE9BQU8sTUFBTTtBQUNkO0FBSUEsU0FBUyxxQkFBcUIsQ0FBQyxVQUF5QixFQUFFO0lBQ3pELE1BQU0sWUFBWSxFQUFFLGtCQUFrQixDQUFDLEdBQUcsQ0FBQyxVQUFVLENBQUM7SUFDdEQsR0FBRyxDQUFDLFdBQVcsRUFBRSxFQUFFLE9BQU8sV0FBVyxFQUFFO0lBRXZDLE1BQU0sUUFBUSxFQUFFLElBQUksR0FBdUIsQ0FBQyxDQUFDO0lBRTdDLE1BQU0sVUFBVSxFQUFFLENBQUMsVUFBa0IsRUFBRSxVQUF1QyxFQUFFLENBQUMsRUFBRTtRQUNsRixNQUFNLE1BQWtCLEVBQUUsSUFBSSxHQUFHLENBQUMsQ0FBQztRQUVuQyxJQUFJLENBQUMsTUFBTSxVQUFVLEdBQUcsVUFBVSxFQUFFO1lBQ25DLEdBQUcsQ0FBQyxDQUFDLEVBQUUsQ0FBQyxpQkFBaUIsQ0FBQyxTQUFTLEVBQUUsQ0FBQyxFQUFFLENBQUMsQ0FBQyxFQUFFLENBQUMsd0JBQXdCLENBQUMsU0FBUyxFQUFFLEVBQUUsRUFBRSxDQUFDLGFBQWEsQ0FBQyxLQUFLLENBQUMsRUFBRTtnQkFDM0csUUFBUTtZQUNUO1lBRUEsTUFBTSxPQUFPLEVBQUUsYUFBYSxDQUFDLFNBQVMsQ0FBQztZQUN2QyxHQUFHLENBQUMsTUFBTSxFQUFFLEVBQUUsS0FBSyxDQUFDLEdBQUcsQ0FBQyxTQUFTLENBQUMsSUFBSSxDQUFDLElBQUksRUFBRSxNQUFNLENBQUMsRUFBRTtRQUN2RDtRQUVBLEdBQUcsQ0FBQyxLQUFLLENBQUMsS0FBSyxFQUFFLENBQUMsRUFBRSxFQUFFLE9BQU8sQ0FBQyxHQUFHLENBQUMsVUFBVSxFQUFFLEtBQUssQ0FBQyxFQUFFO0lBQ3ZELENBQUM7SUFFRCxHQUFHLENBQUMsRUFBRSxDQUFDLGdCQUFnQixDQUFDLFVBQVUsQ0FBQyxFQUFFO1FBQ3BDLFNBQVMsQ0FBQyxVQUFVLENBQUMsUUFBUSxFQUFFLFVBQVUsQ0FBQyxVQUFVLENBQUM7SUFDdEQ7SUFFQSxJQUFJLENBQUMsTUFBTSxVQUFVLEdBQUcsVUFBVSxDQUFDLFVBQVUsRUFBRTtRQUM5QyxHQUFHLENBQUMsRUFBRSxDQUFDLG1CQUFtQixDQUFDLFNBQVMsRUFBRSxDQUFDLEVBQUUsRUFBRSxDQUFDLGVBQWUsQ0FBQyxTQUFTLENBQUMsSUFBSSxFQUFFLENBQUM7WUFDNUUsU0FBUyxDQUFDLEtBQUssQ0FBQyxFQUFFLEVBQUUsQ0FBQyxhQUFhLENBQUMsU0FBUyxDQUFDLElBQUksQ0FBQyxFQUFFO1lBQ3BELFNBQVMsQ0FBQyxTQUFTLENBQUMsSUFBSSxDQUFDLElBQUksRUFBRSxTQUFTLENBQUMsSUFBSSxDQUFDLFVBQVUsQ0FBQztRQUMxRDtJQUNEO0lBR0Esa0JBQWtCLENBQUMsR0FBRyxDQUFDLFVBQVUsRUFBRSxPQUFPLENBQUM7SUFFM0MsT0FBTyxPQUFPO0FBQ2Y7QUFHQSxTQUFTLHNCQUFzQixDQUFDLE9BQW1CLEVBQUUsVUFBeUIsRUFBRSxRQUFnQixFQUFFO0lBQ2pHLE1BQU0sUUFBUSxFQUFFLElBQUksR0FBdUIsQ0FBQyxDQUFDO0lBQzdDLElBQUksQ0FBQyxNQUFNLEtBQUssR0FBRyxPQUFPLENBQUMsY0FBYyxDQUFDLENBQUMsRUFBRTtRQUM1QyxxQkFBcUIsQ0FBQyxJQUFJLENBQUMsQ0FBQyxPQUFPLENBQUMsQ0FBQyxLQUFLLEVBQUUsVUFBVSxFQUFFLENBQUMsRUFBRSxPQUFPLENBQUMsR0FBRyxDQUFDLFVBQVUsRUFBRSxLQUFLLENBQUMsQ0FBQztJQUMzRjtJQUVBLE1BQU0sY0FBYyxFQUFFLElBQUksR0FBdUIsQ0FBQyxDQUFDO0lBRW5ELElBQUksQ0FBQyxNQUFNLFVBQVUsR0FBRyxVQUFVLENBQUMsVUFBVSxFQUFFO1FBQzlDLEdBQUcsQ0FBQyxDQUFDLEVBQUUsQ0FBQyxtQkFBbUIsQ0FBQyxTQUFTLEVBQUUsQ0FBQyxFQUFFLENBQUMsRUFBRSxDQUFDLGVBQWUsQ0FBQyxTQUFTLENBQUMsZUFBZSxDQUFDLEVBQUUsRUFBRSxRQUFRLEVBQUU7UUFFdEcsTUFBTSxhQUFhLEVBQUUsU0FBUyxDQUFDLFlBQVk7UUFDM0MsTUFBTSxjQUFjLEVBQUUsYUFBYSxDQUFDLEVBQUUsWUFBWSxDQUFDLGFBQWE7UUFDaEUsR0FBRyxDQUFDLENBQUMsY0FBYyxDQUFDLEVBQUUsQ0FBQyxFQUFFLENBQUMsY0FBYyxDQUFDLGFBQWEsQ0FBQyxFQUFFLEVBQUUsUUFBUSxFQUFFO1FBR3JFLE1BQU0sV0FBVyxFQUFFLFNBQVMsQ0FBQyxlQUFlLENBQUMsSUFBSTtRQUNqRCxNQUFNLGVBQWUsRUFBRSxpQkFBaUIsQ0FBQyxVQUFVLEVBQUUsUUFBUSxDQUFDO1FBQzlELE1BQU0sTUFBTSxFQUFFLE9BQU8sQ0FBQyxHQUFHLENBQUMsZUFBZSxFQUFFLGNBQWMsQ0FBQyxpQkFBaUIsRUFBRSxVQUFVLENBQUM7UUFDeEYsR0FBRyxDQUFDLENBQUMsS0FBSyxFQUFFLEVBQUUsUUFBUSxFQUFFO1FBRXhCLElBQUksQ0FBQyxNQUFNLFFBQVEsR0FBRyxhQUFhLENBQUMsUUFBUSxFQUFFO1lBQzdDLE1BQU0sT0FBTyxFQUFFLEtBQUssQ0FBQyxHQUFHLENBQUMsQ0FBQyxPQUFPLENBQUMsYUFBYSxDQUFDLEVBQUUsT0FBTyxDQUFDLElBQUksQ0FBQyxDQUFDLElBQUksQ0FBQztZQUNyRSxHQUFHLENBQUMsTUFBTSxFQUFFLEVBQUUsYUFBYSxDQUFDLEdBQUcsQ0FBQyxPQUFPLENBQUMsSUFBSSxDQUFDLElBQUksRUFBRSxNQUFNLENBQUMsRUFBRTtRQUM3RDtJQUNEO0lBRUEsT0FBTyxhQUFhO0FBQ3JCO0FBSUEsU0FBUyxnQkFBZ0IsQ0FBQyxPQUFtQixFQUFFLFFBQWdCLEVBQXdDO0lBQ3RHLE9BQU8sUUFBUSxDQUFDLEVBQUUsV0FBVyxDQUFDLEVBQUU7UUFDL0IsTUFBTSxjQUFjLEVBQUUsc0JBQXNCLENBQUMsT0FBTyxFQUFFLFVBQVUsRUFBRSxRQUFRLENBQUM7UUFDM0UsR0FBRyxDQUFDLGFBQWEsQ0FBQyxLQUFLLENBQUMsQ0FBQyxFQUFFLENBQUMsRUFBRSxFQUFFLE9BQU8sVUFBVSxFQUFFO1FBRW5ELE1BQU0sWUFBWSxFQUFFLENBQUMsSUFBMEIsRUFBRSxDQUFDLEVBQUU7WUFDbkQsTUFBTSxhQUFhLEVBQUUsSUFBSSxDQUFDLFlBQVk7WUFDdEMsTUFBTSxjQUFjLEVBQUUsYUFBYSxDQUFDLEVBQUUsWUFBWSxDQUFDLGFBQWE7WUFDaEUsR0FBRyxDQUFDLENBQUMsYUFBYSxDQUFDLEVBQUUsQ0FBQyxjQUFjLENBQUMsRUFBRSxDQUFDLEVBQUUsQ0FBQyxjQUFjLENBQUMsYUFBYSxDQUFDLEVBQUUsRUFBRSxPQUFPLElBQUksRUFBRTtZQUV6RixNQUFNLFNBQVMsRUFBRSxhQUFhLENBQUMsUUFBUSxDQUFDLE1BQU0sQ0FBQyxRQUFRLENBQUMsRUFBRSxDQUFDLGFBQWEsQ0FBQyxHQUFHLENBQUMsT0FBTyxDQUFDLElBQUksQ0FBQyxJQUFJLENBQUMsQ0FBQztZQUNoRyxHQUFHLENBQUMsUUFBUSxDQUFDLE9BQU8sQ0FBQyxDQUFDLEVBQUUsYUFBYSxDQUFDLFFBQVEsQ0FBQyxNQUFNLEVBQUUsRUFBRSxPQUFPLElBQUksRUFBRTtZQUN0RSxHQUFHLENBQUMsUUFBUSxDQUFDLE9BQU8sQ0FBQyxDQUFDLEVBQUUsRUFBRSxDQUFDLEVBQUUsQ0FBQyxZQUFZLENBQUMsSUFBSSxFQUFFLEVBQUUsT0FBTyxTQUFTLEVBQUU7WUFFckUsT0FBTyxFQUFFLENBQUMsdUJBQXVCO2dCQUNoQyxJQUFJO2dCQUNKLElBQUksQ0FBQyxVQUFVO2dCQUNmLElBQUksQ0FBQyxTQUFTO2dCQUNkLEVBQUUsQ0FBQyxrQkFBa0I7b0JBQ3BCLFlBQVk7b0JBQ1osWUFBWSxDQUFDLElBQUk7b0JBQ2pCLFFBQVEsQ0FBQyxPQUFPLEVBQUUsRUFBRSxFQUFFLEVBQUUsQ0FBQyxrQkFBa0IsQ0FBQyxhQUFhLEVBQUUsUUFBUSxFQUFFLEVBQUU7Z0JBQ3hFLENBQUM7Z0JBQ0QsSUFBSSxDQUFDO1lBQ04sQ0FBQztRQUNGLENBQUM7UUFFRCxNQUFNLFVBQVUsRUFBRSxDQUFDLElBQWEsRUFBRSxDQUFDLEVBQUU7WUFDcEMsSUFBSSxRQUF1QjtZQUMzQixJQUFJLFVBQWtCO1lBRXRCLEdBQUcsQ0FBQyxFQUFFLENBQUMsMEJBQTBCLENBQUMsSUFBSSxDQUFDLEVBQUU7Z0JBQ3hDLFNBQVMsRUFBRSxJQUFJLENBQUMsVUFBVTtnQkFDMUIsV0FBVyxFQUFFLElBQUksQ0FBQyxJQUFJLENBQUMsSUFBSTtZQUM1QjtZQUNBLEtBQUssR0FBRyxDQUFDLEVBQUUsQ0FBQyx5QkFBeUIsQ0FBQyxJQUFJLEVBQUUsQ0FBQyxFQUFFLEVBQUUsQ0FBQyxlQUFlLENBQUMsSUFBSSxDQUFDLGtCQUFrQixDQUFDLEVBQUU7Z0JBQzNGLFNBQVMsRUFBRSxJQUFJLENBQUMsVUFBVTtnQkFDMUIsV0FBVyxFQUFFLElBQUksQ0FBQyxrQkFBa0IsQ0FBQyxJQUFJO1lBQzFDO1lBQ0EsS0FBSztnQkFDSixPQUFPLFNBQVM7WUFDakI7WUFFQSxNQUFNLE9BQU8sRUFBRSxFQUFFLENBQUMsWUFBWSxDQUFDLFFBQVEsRUFBRSxFQUFFLGFBQWEsQ0FBQyxHQUFHLENBQUMsUUFBUSxDQUFDLElBQUksRUFBRSxFQUFFLFNBQVM7WUFDdkYsT0FBTyxPQUFPLENBQUMsRUFBRSxNQUFNLENBQUMsR0FBRyxDQUFDLFVBQVUsQ0FBQztRQUN4QyxDQUFDO1FBRUQsTUFBTSxNQUFNLEVBQUUsQ0FBQyxJQUFhLEVBQTJCLENBQUMsRUFBRTtZQUN6RCxHQUFHLENBQUMsRUFBRSxDQUFDLG1CQUFtQixDQUFDLElBQUksQ0FBQyxFQUFFLEVBQUUsT0FBTyxXQUFXLENBQUMsSUFBSSxDQUFDLEVBQUU7WUFFOUQsTUFBTSxNQUFNLEVBQUUsU0FBUyxDQUFDLElBQUksQ0FBQztZQUM3QixHQUFHLENBQUMsT0FBTyxNQUFNLENBQUMsQ0FBQyxFQUFFLENBQUMsTUFBTSxFQUFFLENBQUMsRUFBRSxNQUFNLEVBQUUsQ0FBQyxFQUFFO2dCQUMzQyxPQUFPLEVBQUUsQ0FBQyxZQUFZLENBQUMsRUFBRSxDQUFDLFVBQVUsQ0FBQyxVQUFVLEVBQUUsRUFBRSxDQUFDLGFBQWEsQ0FBQyxDQUFDLEtBQUssQ0FBQyxDQUFDO1lBQzNFO1lBQ0EsS0FBSyxHQUFHLENBQUMsTUFBTSxDQUFDLENBQUMsRUFBRSxTQUFTLEVBQUU7Z0JBQzdCLE9BQU8sRUFBRSxDQUFDLGFBQWEsQ0FBQyxLQUFLLENBQUM7WUFDL0I7WUFFQSxPQUFPLEVBQUUsQ0FBQyxjQUFjLENBQUMsSUFBSSxFQUFFLEtBQUssRUFBRSxPQUFPLENBQUM7UUFDL0MsQ0FBQztRQUVELE9BQU8sRUFBRSxDQUFDLGNBQWMsQ0FBQyxVQUFVLEVBQUUsS0FBSyxFQUFFLE9BQU8sQ0FBQztJQUNyRCxDQUFDO0FBQ0Y7QUFNQSxTQUFTLGFBQWEsQ0FBQyxRQUFnQixFQUFZO0lBQ2xELG1CQUFtQixDQUFDLFFBQVEsQ0FBQztJQUU3QixNQUFNLFFBQVEsRUFBRSxlQUFlLENBQUMsVUFBVSxDQUFDLENBQUM7SUFDNUMsR0FBRyxDQUFDLFFBQVEsQ0FBQyxDQUFDLEVBQUUsU0FBUyxFQUFFO1FBQzFCLE1BQU0sSUFBSSxLQUFLLENBQUMsQ0FBQyxPQUFPLEdBQUcsSUFBSSxPQUFPLENBQUMsQ0FBQztJQUN6QztJQUVBLE1BQU0sV0FBVyxFQUFFLE9BQU8sQ0FBQyxhQUFhLENBQUMsUUFBUSxDQUFDO0lBQ2xELEdBQUcsQ0FBQyxXQUFXLENBQUMsQ0FBQyxFQUFFLFNBQVMsRUFBRTtRQUM3QixNQUFNLElBQUksS0FBSyxDQUFDLENBQUMsT0FBTyxHQUFHLElBQUksT0FBTyxJQUFJLEVBQUUsQ0FBQyxDQUFDLFFBQVEsQ0FBQyxDQUFDLENBQUM7SUFDMUQ7SUFFQSxNQUFNLE9BQU8sRUFBRSxFQUFFLENBQUMsZUFBZSxDQUFDLFVBQVUsQ0FBQyxJQUFJLEVBQUU7UUFDbEQsZUFBZSxFQUFFLGVBQWU7UUFDaEMsUUFBUSxFQUFFLFFBQVE7UUFDbEIsaUJBQWlCLEVBQUUsSUFBSTtRQUN2QixZQUFZLEVBQUUsRUFBRSxNQUFNLEVBQUUsQ0FBQyxnQkFBZ0IsQ0FBQyxPQUFPLEVBQUUsUUFBUSxDQUFDLEVBQUU7SUFDL0QsQ0FBQyxDQUFDO0lBRUYsTUFBTSxPQUFPLEVBQUUsQ0FBQyxNQUFNLENBQUMsWUFBWSxDQUFDLEVBQUUsQ0FBQyxDQUFDLENBQUMsQ0FBQyxHQUFHLENBQUMsZ0JBQWdCLENBQUM7SUFDL0QsR0FBRyxDQUFDLE1BQU0sQ0FBQyxPQUFPLEVBQUUsQ0FBQyxFQUFFO1FBQ3RCLE9BQU8sRUFBRSxNQUFNLEVBQUUsT0FBTyxDQUFDO0lBQzFCO0lBRUEsTUFBTSxPQUFPLEVBQUUsTUFBTSxDQUFDLFVBQVU7SUFFaEMsaUJBQWlCLENBQUMsR0FBRyxDQUFDLFFBQVEsQ0FBQztJQUMvQixpQkFBaUIsQ0FBQyxDQUFDO0lBRW5CLE1BQU0sY0FBYyxFQUFFLElBQUksQ0FBQyxLQUFLLENBQUMsUUFBUSxDQUFDLENBQUMsR0FBRztJQUM5QyxNQUFNLFNBQVMsRUFBRSxJQUFJLENBQUMsUUFBUSxDQUFDLFFBQVEsQ0FBQztJQUN4QyxNQUFNLFVBQVUsRUFBRSxRQUFRLENBQUMsT0FBTyxDQUFDLGFBQWEsRUFBRSxDQUFDLENBQUMsQ0FBQztJQUVyRCxPQUFPO1FBQ04sTUFBTSxFQUFFLE1BQU07UUFDZCxRQUFRLEVBQUUsUUFBUTtRQUNsQixJQUFJLEVBQUUsU0FBUztRQUNmLElBQUksRUFBRSxRQUFRO1FBQ2QsTUFBTSxFQUFFLE1BQU07UUFDZCxPQUFPLEVBQUUsQ0FBQyxDQUFDO1FBQ1gsWUFBWSxFQUFFLENBQUM7SUFDaEIsQ0FBQztBQUNGO0FBRUEsU0FBUyxhQUFhLENBQUMsUUFBZ0IsRUFBeUI7SUFDL0QsbUJBQW1CLENBQUMsUUFBUSxDQUFDO0lBRTdCLE1BQU0sUUFBUSxFQUFFLGVBQWUsQ0FBQyxVQUFVLENBQUMsQ0FBQztJQUM1QyxHQUFHLENBQUMsUUFBUSxDQUFDLENBQUMsRUFBRSxTQUFTLEVBQUU7UUFDMUIsTUFBTSxJQUFJLEtBQUssQ0FBQyxDQUFDLE9BQU8sR0FBRyxJQUFJLE9BQU8sQ0FBQyxDQUFDO0lBQ3pDO0lBRUEsTUFBTSxXQUFXLEVBQUUsT0FBTyxDQUFDLGFBQWEsQ0FBQyxRQUFRLENBQUM7SUFDbEQsR0FBRyxDQUFDLFdBQVcsQ0FBQyxDQUFDLEVBQUUsU0FBUyxFQUFFO1FBQzdCLE1BQU0sSUFBSSxLQUFLLENBQUMsQ0FBQyxPQUFPLEdBQUcsSUFBSSxPQUFPLElBQUksRUFBRSxDQUFDLENBQUMsUUFBUSxDQUFDLENBQUMsQ0FBQztJQUMxRDtJQUVBLE1BQU0sWUFBWSxFQUFFLEVBQUUsQ0FBQyxxQkFBcUIsQ0FBQyxPQUFPLEVBQUUsVUFBVSxDQUFDO0lBRWpFLE9BQU87UUFDTixJQUFJLEVBQUUsQ0FBQyxTQUFTLENBQUM7UUFDakIsSUFBSSxFQUFFLFFBQVE7UUFDZCxNQUFNLEVBQUUsV0FBVyxDQUFDLEdBQUcsQ0FBQyxnQkFBZ0I7SUFDekMsQ0FBQztBQUNGO0FBRUEsSUFBSSxtQkFBbUIsRUFBRSxLQUFLO0FBRzlCLFNBQVMsaUJBQWlCLENBQUMsRUFBRTtJQUM1QixHQUFHLENBQUMsbUJBQW1CLENBQUMsRUFBRSxpQkFBaUIsQ0FBQyxLQUFLLENBQUMsQ0FBQyxFQUFFLENBQUMsRUFBRSxFQUFFLE1BQU0sRUFBRTtJQUNsRSxtQkFBbUIsRUFBRSxJQUFJO0lBRXpCLFlBQVksQ0FBQyxDQUFDLEVBQUUsQ0FBQyxFQUFFO1FBQ2xCLG1CQUFtQixFQUFFLEtBQUs7UUFFMUIsTUFBTSxTQUFpQixFQUFFLGlCQUFpQixDQUFDLE1BQU0sQ0FBQyxDQUFDLENBQUMsSUFBSSxDQUFDLENBQUMsQ0FBQyxLQUFLO1FBQ2hFLGlCQUFpQixDQUFDLE1BQU0sQ0FBQyxRQUFRLENBQUM7UUFFbEMsSUFBSSxNQUE2QjtRQUNqQyxJQUFJO1lBQ0gsT0FBTyxFQUFFLGFBQWEsQ0FBQyxRQUFRLENBQUM7UUFDakM7UUFDQSxNQUFNLENBQUMsS0FBSyxFQUFFO1lBQ2IsT0FBTyxFQUFFLEVBQUUsSUFBSSxFQUFFLENBQUMsU0FBUyxDQUFDLEVBQUUsSUFBSSxFQUFFLFFBQVEsRUFBRSxNQUFNLEVBQUUsQ0FBQyxDQUFDLENBQUMsR0FBRyxDQUFDLEVBQUUsQ0FBQyxDQUFDLEtBQUssQ0FBQyxNQUFNLENBQUMsRUFBRSxLQUFLLENBQUMsQ0FBQyxFQUFFLENBQUM7UUFDM0Y7UUFFQSxpQkFBaUIsQ0FBQyxNQUFNLENBQUM7UUFFekIsaUJBQWlCLENBQUMsQ0FBQztJQUNwQixDQUFDLENBQUM7QUFDSDtBQUtBLFNBQVMsTUFBTSxDQUFDLFNBQW1CLEVBQUU7SUFDcEMsVUFBVSxFQUFFLFNBQVMsQ0FBQyxNQUFNLENBQUMsU0FBUyxDQUFDLEVBQUU7UUFDeEMsSUFBSTtZQUNILEdBQUcsQ0FBQyxDQUFDLGNBQWMsQ0FBQyxHQUFHLENBQUMsUUFBUSxDQUFDLEVBQUUsRUFBRSxtQkFBbUIsQ0FBQyxRQUFRLENBQUMsRUFBRTtZQUNwRSxPQUFPLElBQUk7UUFDWjtRQUNBLE1BQU07WUFDTCxPQUFPLEtBQUs7UUFDYjtJQUNELENBQUMsQ0FBQztJQUVGLElBQUksT0FBTyxFQUFFLENBQUM7SUFDZCxNQUFNLE1BQU0sRUFBRSxTQUFTLENBQUMsTUFBTTtJQUU5QixNQUFNLFdBQVcsRUFBRSxDQUFDLEVBQUUsQ0FBQyxFQUFFO1FBQ3hCLElBQUk7WUFDSCxNQUFNLFFBQVEsRUFBRSxlQUFlLENBQUMsVUFBVSxDQUFDLENBQUM7WUFDNUMsTUFBTSxXQUFXLEVBQUUsUUFBUSxDQUFDLEVBQUUsT0FBTyxDQUFDLGFBQWEsQ0FBQyxTQUFTLENBQUMsTUFBTSxDQUFDLENBQUM7WUFDdEUsR0FBRyxDQUFDLFFBQVEsQ0FBQyxFQUFFLFVBQVUsRUFBRSxFQUFFLE9BQU8sQ0FBQyxzQkFBc0IsQ0FBQyxVQUFVLENBQUMsRUFBRTtRQUMxRTtRQUNBLE1BQU07UUFFTjtRQUVBLE9BQU8sQ0FBQyxFQUFFLENBQUM7UUFDWCxpQkFBaUIsQ0FBQyxFQUFFLElBQUksRUFBRSxDQUFDLE1BQU0sQ0FBQyxFQUFFLE1BQU0sRUFBRSxNQUFNLEVBQUUsS0FBSyxFQUFFLE1BQU0sQ0FBQyxDQUFDO1FBRW5FLEdBQUcsQ0FBQyxPQUFPLEVBQUUsS0FBSyxFQUFFLEVBQUUsWUFBWSxDQUFDLFVBQVUsQ0FBQyxFQUFFO0lBQ2pELENBQUM7SUFFRCxpQkFBaUIsQ0FBQyxFQUFFLElBQUksRUFBRSxDQUFDLE1BQU0sQ0FBQyxFQUFFLE1BQU0sRUFBRSxNQUFNLEVBQUUsS0FBSyxFQUFFLE1BQU0sQ0FBQyxDQUFDO0lBRW5FLEdBQUcsQ0FBQyxNQUFNLEVBQUUsQ0FBQyxFQUFFLEVBQUUsWUFBWSxDQUFDLFVBQVUsQ0FBQyxFQUFFO0FBQzVDO0FBR0EsU0FBUyxTQUFTLENBQUMsUUFBZ0IsRUFBRTtJQUNwQyxNQUFNLElBQUksRUFBRSxJQUFJLElBQUksQ0FBQyxDQUFDO0lBQ3RCLElBQUksRUFBRSxFQUFFLENBQUMsVUFBVSxDQUFDLFFBQVEsRUFBRSxHQUFHLEVBQUUsR0FBRyxDQUFDLEVBQUU7SUFDekMsTUFBTSxFQUFpQztBQUN4QztBQUlBLFNBQVMsV0FBVyxDQUFDLE1BQWMsRUFBRSxTQUFrQixFQUFpQjtJQUN2RSxHQUFHLENBQUMsQ0FBQyxjQUFjLEVBQUUsRUFBRSxPQUFPLEVBQUUsTUFBTSxFQUFFLE9BQU8sQ0FBQyxFQUFFO0lBRWxELE1BQU0sV0FBVyxFQUFFLE1BQU0sQ0FBQyxVQUFVLENBQUMsQ0FBQyxJQUFJLENBQUMsQ0FBQyxDQUFDLE1BQU0sQ0FBQyxNQUFNLENBQUMsQ0FBQyxNQUFNLENBQUMsQ0FBQyxHQUFHLENBQUMsQ0FBQztJQUN6RSxNQUFNLGNBQWMsRUFBRSxJQUFJLENBQUMsSUFBSSxDQUFDLGNBQWMsRUFBRSxDQUFDLElBQUksQ0FBQyxDQUFDO0lBQ3ZELE1BQU0sV0FBVyxFQUFFLElBQUksQ0FBQyxJQUFJLENBQUMsYUFBYSxFQUFFLENBQUMsQ0FBQyxDQUFDLFVBQVUsQ0FBQyxDQUFDLEVBQUUsQ0FBQyxDQUFDO0lBRS9ELEdBQUcsQ0FBQyxDQUFDLEVBQUUsQ0FBQyxVQUFVLENBQUMsVUFBVSxDQUFDLEVBQUU7UUFDL0IsRUFBRSxDQUFDLFNBQVMsQ0FBQyxhQUFhLEVBQUUsRUFBRSxTQUFTLEVBQUUsS0FBSyxDQUFDLENBQUM7UUFHaEQsTUFBTSxTQUFTLEVBQUUsQ0FBQyxDQUFDLENBQUMsVUFBVSxDQUFDLENBQUMsQ0FBQyxDQUFDLE9BQU8sQ0FBQyxHQUFHLENBQUMsQ0FBQyxHQUFHLENBQUM7UUFDbkQsRUFBRSxDQUFDLGFBQWEsQ0FBQyxRQUFRLEVBQUUsTUFBTSxFQUFFLENBQUMsSUFBSSxDQUFDLENBQUM7UUFDMUMsRUFBRSxDQUFDLFVBQVUsQ0FBQyxRQUFRLEVBQUUsVUFBVSxDQUFDO0lBQ3BDO0lBQ0EsS0FBSztRQUNKLFNBQVMsQ0FBQyxVQUFVLENBQUM7SUFDdEI7SUFFQSxNQUFNLGNBQWMsRUFBRSxVQUFVLENBQUMsQ0FBQyxFQUFFLFVBQVUsRUFBRSxDQUFDLENBQUMsQ0FBQyxVQUFVLENBQUMsQ0FBQyxHQUFHLEVBQUUsRUFBRSxTQUFTO0lBQy9FLEdBQUcsQ0FBQyxjQUFjLENBQUMsRUFBRSxDQUFDLEVBQUUsQ0FBQyxVQUFVLENBQUMsYUFBYSxDQUFDLEVBQUU7UUFDbkQsTUFBTSxTQUFTLEVBQUUsQ0FBQyxDQUFDLENBQUMsYUFBYSxDQUFDLENBQUMsQ0FBQyxDQUFDLE9BQU8sQ0FBQyxHQUFHLENBQUMsQ0FBQyxHQUFHLENBQUM7UUFDdEQsRUFBRSxDQUFDLGFBQWEsQ0FBQyxRQUFRLEVBQUUsU0FBUyxFQUFFLENBQUMsSUFBSSxDQUFDLENBQUM7UUFDN0MsRUFBRSxDQUFDLFVBQVUsQ0FBQyxRQUFRLEVBQUUsYUFBYSxDQUFDO0lBQ3ZDO0lBQ0EsS0FBSyxHQUFHLENBQUMsYUFBYSxFQUFFO1FBQ3ZCLFNBQVMsQ0FBQyxhQUFhLENBQUM7SUFDekI7SUFFQSxPQUFPO1FBQ04sVUFBVSxFQUFFLFVBQVU7UUFDdEIsVUFBVSxFQUFFLFVBQVU7UUFDdEIsYUFBYSxFQUFFO0lBQ2hCLENBQUM7QUFDRjtBQUdBLFNBQVMsY0FBYyxDQUFDLE1BQWMsRUFBZTtJQUNwRCxNQUFNLGlCQUFpQixFQUFFLENBQUMsQ0FBQyxDQUFDLENBQUMsQ0FBQyxDQUFDLENBQUMsRUFBRSxnQkFBZ0IsQ0FBQyxJQUFJLENBQUMsV0FBVyxDQUFDLENBQUMsSUFBSSxDQUFDLE1BQU0sQ0FBQyxDQUFDLENBQUMsQ0FBQyxDQUFDLENBQUMsQ0FBQyxDQUFDLENBQUMsQ0FBQyxDQUFDO0lBQzNGLE1BQU0sTUFBTSxFQUFFLGdCQUFnQixDQUFDLElBQUksQ0FBQyxNQUFNLENBQUM7SUFDM0MsR0FBRyxDQUFDLENBQUMsS0FBSyxFQUFFLEVBQUUsT0FBTyxFQUFFLElBQUksRUFBRSxPQUFPLENBQUMsRUFBRTtJQUV2QyxPQUFPO1FBQ04sSUFBSSxFQUFFLE1BQU0sQ0FBQyxLQUFLLENBQUMsQ0FBQyxFQUFFLEtBQUssQ0FBQyxLQUFLLENBQUM7UUFDbEMsR0FBRyxFQUFFLE1BQU0sQ0FBQyxJQUFJLENBQUMsS0FBSyxDQUFDLENBQUMsQ0FBQyxFQUFFLENBQUMsTUFBTSxDQUFDLENBQUMsQ0FBQyxRQUFRLENBQUMsQ0FBQyxJQUFJLENBQUM7SUFDckQsQ0FBQztBQUNGO0FBSUEsU0FBUyxZQUFZLENBQUMsUUFBZ0IsRUFBRSxNQUFjLEVBQWU7SUFDcEUsTUFBTSxFQUFFLElBQUksRUFBRSxJQUFJLEVBQUUsRUFBRSxjQUFjLENBQUMsTUFBTSxDQUFDO0lBRTVDLE1BQU0sT0FBTyxFQUFFLE1BQU0sQ0FBQyxNQUFNLENBQUMsSUFBSSxFQUFFO1FBQ2xDLFFBQVEsRUFBRTtZQUNULFdBQVcsRUFBRSxFQUFFLE9BQU8sRUFBRSxNQUFNLENBQUM7WUFDL0IsWUFBWSxFQUFFLElBQUk7WUFDbEIsTUFBTSxFQUFFO1FBQ1QsQ0FBQztRQUNELE1BQU0sRUFBRSxJQUFJO1FBQ1osU0FBUyxFQUFFLElBQUksQ0FBQyxDQUFDLEVBQUUsVUFBVSxFQUFFLEVBQUUsT0FBTyxFQUFFLElBQUksQ0FBQyxLQUFLLENBQUMsR0FBRyxFQUFFLEVBQUUsRUFBRTtJQUMvRCxDQUFDLENBQUM7SUFFRixHQUFHLENBQUMsTUFBTSxDQUFDLEtBQUssRUFBRTtRQUNqQixNQUFNLElBQUksS0FBSyxDQUFDLENBQUMsT0FBTyxHQUFHLE9BQU8sQ0FBQyxDQUFDLElBQUksQ0FBQyxRQUFRLENBQUMsUUFBUSxDQUFDLENBQUMsRUFBRSxDQUFDLENBQUMsTUFBTSxDQUFDLEtBQUssQ0FBQyxPQUFPLENBQUMsQ0FBQyxDQUFDO0lBQ3hGO0lBRUEsT0FBTztRQUNOLElBQUksRUFBRSxNQUFNLENBQUMsS0FBSyxDQUFDLEVBQUUsQ0FBQyxDQUFDO1FBQ3ZCLEdBQUcsRUFBRSxPQUFPLE1BQU0sQ0FBQyxJQUFJLENBQUMsQ0FBQyxFQUFFLENBQUMsTUFBTSxFQUFFLEVBQUUsTUFBTSxDQUFDLElBQUksRUFBRTtJQUNwRCxDQUFDO0FBQ0Y7QUFHQSxTQUFTLFdBQVcsQ0FBQyxVQUFrQixFQUFFLFFBQWdCLEVBQWdDO0lBQ3hGLE1BQU0sU0FBUyxFQUFFLFVBQVUsQ0FBQyxLQUFLLENBQUMsQ0FBQyxDQUFDLENBQUMsQ0FBQztJQUN0QyxNQUFNLFlBQVksRUFBRSxVQUFVLENBQUMsVUFBVSxDQUFDLENBQUMsQ0FBQyxDQUFDLEVBQUUsRUFBRSxRQUFRLENBQUMsS0FBSyxDQUFDLENBQUMsRUFBRSxDQUFDLENBQUMsQ0FBQyxJQUFJLENBQUMsQ0FBQyxDQUFDLENBQUMsRUFBRSxFQUFFLFFBQVEsQ0FBQyxDQUFDLENBQUM7SUFFN0YsSUFBSSxDQUFDLElBQUksVUFBVSxFQUFFLElBQUksQ0FBQyxPQUFPLENBQUMsUUFBUSxDQUFDLEVBQUUsRUFBRSxVQUFVLEVBQUUsSUFBSSxDQUFDLE9BQU8sQ0FBQyxTQUFTLENBQUMsRUFBRTtRQUNuRixNQUFNLGdCQUFnQixFQUFFLElBQUksQ0FBQyxJQUFJLENBQUMsU0FBUyxFQUFFLENBQUMsWUFBWSxDQUFDLENBQUM7UUFDNUQsTUFBTSxZQUFZLEVBQUUsSUFBSSxDQUFDLElBQUksQ0FBQyxlQUFlLEVBQUUsV0FBVyxFQUFFLENBQUMsT0FBTyxDQUFDLElBQUksQ0FBQyxDQUFDO1FBQzNFLEdBQUcsQ0FBQyxFQUFFLENBQUMsVUFBVSxDQUFDLFdBQVcsQ0FBQyxFQUFFLEVBQUUsT0FBTyxFQUFFLGVBQWUsRUFBRSxlQUFlLEVBQUUsV0FBVyxFQUFFLFlBQVksQ0FBQyxFQUFFO1FBRXpHLEdBQUcsQ0FBQyxJQUFJLENBQUMsT0FBTyxDQUFDLFNBQVMsRUFBRSxDQUFDLENBQUMsRUFBRSxTQUFTLEVBQUUsRUFBRSxPQUFPLFNBQVMsRUFBRTtJQUNoRTtBQUNEO0FBR0EsU0FBUyxpQkFBaUIsQ0FBQyxVQUFrQixFQUFFLFFBQWdCLEVBQUU7SUFDaEUsTUFBTSxpQkFBaUIsRUFBRSxXQUFXLENBQUMsVUFBVSxFQUFFLFFBQVEsQ0FBQztJQUMxRCxHQUFHLENBQUMsQ0FBQyxnQkFBZ0IsRUFBRSxFQUFFLE9BQU8sS0FBSyxFQUFFO0lBRXZDLE1BQU0sRUFBRSxZQUFZLEVBQUUsRUFBRSxnQkFBZ0I7SUFFeEMsTUFBTSxhQUFhLEVBQUUsZ0JBQWdCLENBQUMsR0FBRyxDQUFDLFdBQVcsQ0FBQztJQUN0RCxHQUFHLENBQUMsYUFBYSxDQUFDLENBQUMsRUFBRSxTQUFTLEVBQUUsRUFBRSxPQUFPLFlBQVksRUFBRTtJQUV2RCxJQUFJLE9BQU8sRUFBRSxLQUFLO0lBQ2xCLElBQUk7UUFDSCxNQUFNLFlBQVksRUFBRSxJQUFJLENBQUMsS0FBSyxDQUFDLEVBQUUsQ0FBQyxZQUFZLENBQUMsV0FBVyxFQUFFLENBQUMsSUFBSSxDQUFDLENBQUMsQ0FBQztRQUNwRSxPQUFPLEVBQUUsQ0FBQyxXQUFXLENBQUMsT0FBTyxDQUFDLEVBQUUsQ0FBQyxXQUFXLENBQUMsQ0FBQyxNQUFNLENBQUMsSUFBSSxDQUFDLENBQUM7SUFDNUQ7SUFDQSxNQUFNO0lBRU47SUFFQSxnQkFBZ0IsQ0FBQyxHQUFHLENBQUMsV0FBVyxFQUFFLE1BQU0sQ0FBQztJQUN6QyxPQUFPLE1BQU07QUFDZDtBQU1BLE1BQU0sU0FBUyxhQUFhLENBQUMsVUFBa0IsRUFBRSxRQUFnQixFQUF3QztJQUN4RyxNQUFNLGlCQUFpQixFQUFFLFdBQVcsQ0FBQyxVQUFVLEVBQUUsUUFBUSxDQUFDO0lBQzFELEdBQUcsQ0FBQyxDQUFDLGdCQUFnQixFQUFFLEVBQUUsT0FBTyxTQUFTLEVBQUU7SUFFM0MsTUFBTSxFQUFFLGVBQWUsRUFBRSxZQUFZLEVBQUUsRUFBRSxnQkFBZ0I7SUFFekQsSUFBSSxXQUFtQjtJQUN2QixJQUFJLEVBQUUsWUFBWSxFQUFFLEVBQUUsQ0FBQyxZQUFZLENBQUMsV0FBVyxFQUFFLENBQUMsSUFBSSxDQUFDLENBQUMsRUFBRTtJQUMxRCxNQUFNLEVBQUUsT0FBTyxTQUFTLEVBQUU7SUFFMUIsTUFBTSxXQUFXLEVBQUUsUUFBUSxDQUFDLENBQUMsQ0FBQyxDQUFDLFVBQVUsQ0FBQyxDQUFDLEVBQUUsQ0FBQyxXQUFXLENBQUMsQ0FBQyxFQUFFLENBQUMsV0FBVyxDQUFDLENBQUMsQ0FBQztJQUM1RSxNQUFNLGdCQUFnQixFQUFFLElBQUksQ0FBQyxJQUFJLENBQUMsZUFBZSxFQUFFLENBQUMsQ0FBQyxLQUFLLENBQUMsRUFBRSxDQUFDLEdBQUcsQ0FBQyxDQUFDO0lBQ25FLE1BQU0sV0FBVyxFQUFFLElBQUksQ0FBQyxJQUFJLENBQUMsZUFBZSxFQUFFLENBQUMsQ0FBQyxDQUFDLFVBQVUsQ0FBQyxDQUFDLEVBQUUsQ0FBQyxDQUFDO0lBRWpFLElBQUksWUFBWSxFQUFFLFlBQVksQ0FBQyxHQUFHLENBQUMsVUFBVSxDQUFDO0lBQzlDLEdBQUcsQ0FBQyxDQUFDLFdBQVcsRUFBRTtRQUNqQixZQUFZLEVBQUUsb0JBQW9CLENBQUMsVUFBVSxFQUFFLFFBQVEsRUFBRSxVQUFVLENBQUM7UUFDcEUsWUFBWSxDQUFDLEdBQUcsQ0FBQyxVQUFVLEVBQUUsV0FBVyxDQUFDO1FBQ3pDLFdBQVcsQ0FBQyxLQUFLLENBQUMsQ0FBQyxFQUFFLENBQUMsRUFBRSxZQUFZLENBQUMsTUFBTSxDQUFDLFVBQVUsQ0FBQyxDQUFDO0lBQ3pEO0lBRUEsSUFBSTtRQUNILE1BQU0sV0FBVztJQUNsQjtJQUNBLE1BQU07UUFFTCxPQUFPLFNBQVM7SUFDakI7SUFFQSxPQUFPO1FBRU4sU0FBUyxFQUFFLENBQUMsQ0FBQyxLQUFLLENBQUMsR0FBRyxDQUFDLENBQUMsQ0FBQyxVQUFVLENBQUMsQ0FBQztRQUNyQyxLQUFLLEVBQUUsQ0FBQyxXQUFXLEVBQUUsVUFBVTtJQUNoQyxDQUFDO0FBQ0Y7QUFFQSxNQUFNLFNBQVMsb0JBQW9CLENBQUMsVUFBa0IsRUFBRSxRQUFnQixFQUFFLFVBQWtCLEVBQUU7SUFDN0YsR0FBRyxDQUFDLEVBQUUsQ0FBQyxVQUFVLENBQUMsVUFBVSxDQUFDLEVBQUUsRUFBRSxNQUFNLEVBQUU7SUFHekMsTUFBTSxRQUFRLEVBQUUsSUFBSSxDQUFDLElBQUksQ0FBQyxJQUFJLENBQUMsT0FBTyxDQUFDLFFBQVEsQ0FBQyxFQUFFLENBQUMsV0FBVyxDQUFDLEVBQUUsQ0FBQyxDQUFDO0lBQ25FLE1BQU0sVUFBVSxFQUFFLENBQUMsT0FBTyxTQUFTLEtBQUssQ0FBQyxDQUFDLElBQUksQ0FBQyxTQUFTLENBQUMsVUFBVSxDQUFDLENBQUMsQ0FBQyxDQUFDLFFBQVEsUUFBUSxRQUFRLENBQUMsQ0FBQyxDQUFDLENBQUM7SUFFbkcsTUFBTSxPQUFPLEVBQUUsTUFBTSxNQUFNLENBQUMsTUFBTSxDQUFDO1FBQ2xDLEtBQUssRUFBRSxPQUFPO1FBQ2QsUUFBUSxFQUFFLEdBQUcsQ0FBQyxFQUFFLE1BQU0sQ0FBQyxjQUFjLENBQUMsUUFBUSxDQUFDLEVBQUUsQ0FBQztRQUNsRCxPQUFPLEVBQUU7WUFDUjtnQkFDQyxJQUFJLEVBQUUsQ0FBQyxHQUFHLENBQUMsTUFBTSxDQUFDO2dCQUNsQixTQUFTLEVBQUUsR0FBRyxDQUFDLEVBQUUsQ0FBQyxHQUFHLENBQUMsQ0FBQyxFQUFFLFFBQVEsRUFBRSxHQUFHLEVBQUUsSUFBSSxDQUFDO2dCQUM3QyxJQUFJLEVBQUUsR0FBRyxDQUFDLEVBQUUsQ0FBQyxHQUFHLENBQUMsQ0FBQyxFQUFFLFFBQVEsRUFBRSxVQUFVLEVBQUUsSUFBSTtZQUMvQyxDQUFDO1lBQ0QsV0FBVyxDQUFDLENBQUM7WUFDYixRQUFRLENBQUMsQ0FBQztZQUNWLElBQUksQ0FBQztRQUNOLENBQUM7UUFDRCxNQUFNLEVBQUUsQ0FBQyxFQUFFLENBQUMsRUFBRTtJQUNmLENBQUMsQ0FBQztJQUdGLE1BQU0sRUFBRSxPQUFPLEVBQUUsRUFBRSxNQUFNLE1BQU0sQ0FBQyxRQUFRLENBQUM7UUFDeEMsTUFBTSxFQUFFLENBQUMsR0FBRyxDQUFDO1FBQ2IsT0FBTyxFQUFFLENBQUMsT0FBTyxDQUFDO1FBQ2xCLE9BQU8sRUFBRTtJQUNWLENBQUMsQ0FBQztJQUVGLE1BQU0sTUFBTSxFQUFFLE1BQU0sQ0FBQyxDQUFDLENBQXVCO0lBRTdDLEVBQUUsQ0FBQyxTQUFTLENBQUMsSUFBSSxDQUFDLE9BQU8sQ0FBQyxVQUFVLENBQUMsRUFBRSxFQUFFLFNBQVMsRUFBRSxLQUFLLENBQUMsQ0FBQztJQUczRCxNQUFNLFNBQVMsRUFBRSxDQUFDLENBQUMsQ0FBQyxVQUFVLENBQUMsQ0FBQyxDQUFDLENBQUMsT0FBTyxDQUFDLEdBQUcsQ0FBQyxDQUFDLEdBQUcsQ0FBQztJQUNuRCxFQUFFLENBQUMsYUFBYSxDQUFDLFFBQVEsRUFBRSxLQUFLLENBQUMsSUFBSSxFQUFFLENBQUMsSUFBSSxDQUFDLENBQUM7SUFDOUMsRUFBRSxDQUFDLFVBQVUsQ0FBQyxRQUFRLEVBQUUsVUFBVSxDQUFDO0FBQ3BDO0FBR0EsU0FBUyxnQkFBZ0IsQ0FBQyxNQUFjLEVBQUU7SUFDekMsTUFBTSxlQUFlLEVBQUUsQ0FBQyxDQUFDLENBQUMsQ0FBQyxDQUFDLFFBQVEsQ0FBQyxDQUFDLENBQUMsQ0FBQyxPQUFPLENBQUMsQ0FBQyxDQUFDLENBQUMsS0FBSyxDQUFDLENBQUMsQ0FBQyxDQUFDLENBQUMsQ0FBQyxDQUFDLENBQUMsQ0FBQyxDQUFDLENBQUMsQ0FBQyxDQUFDLENBQUMsQ0FBQyxDQUFDLENBQUMsQ0FBQyxDQUFDLENBQUMsQ0FBQyxDQUFDLENBQUMsQ0FBQyxDQUFDLENBQUMsQ0FBQyxDQUFDLENBQUMsQ0FBQztJQUN0RixNQUFNLGFBQXVCLEVBQUUsQ0FBQyxDQUFDO0lBQ2pDLElBQUksQ0FBQyxJQUFJLE1BQU0sRUFBRSxjQUFjLENBQUMsSUFBSSxDQUFDLE1BQU0sQ0FBQyxFQUFFLEtBQUssRUFBRSxNQUFNLEVBQUUsY0FBYyxDQUFDLElBQUksQ0FBQyxNQUFNLENBQUMsRUFBRTtRQUN6RixHQUFHLENBQUMsQ0FBQyxLQUFLLENBQUMsQ0FBQyxDQUFDLENBQUMsVUFBVSxDQUFDLENBQUMsRUFBRSxDQUFDLENBQUMsQ0FBQyxFQUFFLEVBQUUsWUFBWSxDQUFDLElBQUksQ0FBQyxLQUFLLENBQUMsQ0FBQyxDQUFDLENBQUMsRUFBRTtJQUNqRTtJQUVBLE9BQU8sWUFBWTtBQUNwQjtBQU9BLE1BQU0sU0FBUyxZQUFZLENBQUMsUUFBZ0IsRUFBRSxNQUFjLEVBQTBCO0lBR3JGLE1BQU0sUUFBUSxFQUFFLFFBQVEsQ0FBQyxPQUFPLENBQUMsQ0FBQyxDQUFDLENBQUMsR0FBRyxDQUFDLENBQUMsQ0FBQyxFQUFFLENBQUMsQ0FBQyxFQUFFLENBQUMsQ0FBQztJQUdsRCxNQUFNLEVBQUUsSUFBSSxFQUFFLFNBQVMsRUFBRSxHQUFHLEVBQUUsU0FBUyxFQUFFLEVBQUUsY0FBYyxDQUFDLE1BQU0sQ0FBQztJQUVqRSxNQUFNLGFBQWEsRUFBRSxDQUFDLEVBQVUsRUFBRSxDQUFDLEVBQUUsQ0FBQyxFQUFFLENBQUMsVUFBVSxDQUFDLENBQUMsQ0FBQyxDQUFDLEVBQUUsQ0FBQyxFQUFFLENBQUMsSUFBSSxDQUFDLFVBQVUsQ0FBQyxFQUFFLENBQUM7SUFHaEYsTUFBTSxnQkFBZ0IsRUFBRSxJQUFJLEdBQW1CLENBQUMsQ0FBQztJQUVqRCxNQUFNLGlCQUFpQixFQUFFLENBQUMsRUFBVSxFQUFFLFFBQWdCLEVBQUUsQ0FBQyxFQUFFO1FBQzFELEdBQUcsQ0FBQyxDQUFDLFlBQVksQ0FBQyxFQUFFLEVBQUUsQ0FBQyxFQUFFLENBQUMsaUJBQWlCLENBQUMsRUFBRSxFQUFFLFFBQVEsQ0FBQyxFQUFFLEVBQUUsT0FBTyxLQUFLLEVBQUU7UUFFM0UsR0FBRyxDQUFDLENBQUMsZUFBZSxDQUFDLEdBQUcsQ0FBQyxFQUFFLENBQUMsRUFBRSxFQUFFLGVBQWUsQ0FBQyxHQUFHLENBQUMsRUFBRSxFQUFFLFFBQVEsQ0FBQyxFQUFFO1FBQ25FLE9BQU8sSUFBSTtJQUNaLENBQUM7SUFFRCxNQUFNLE9BQU8sRUFBRSxNQUFNLE1BQU0sQ0FBQyxNQUFNLENBQUM7UUFDbEMsS0FBSyxFQUFFLE9BQU87UUFDZCxRQUFRLEVBQUUsQ0FBQyxFQUFFLEVBQUUsUUFBUSxFQUFFLENBQUMsRUFBRTtZQUMzQixFQUFFLENBQUMsVUFBVSxDQUFDLENBQUMsRUFBRSxDQUFDLENBQUMsRUFBRSxDQUFDO1lBQ3RCLE1BQU0sQ0FBQyxjQUFjLENBQUMsUUFBUSxDQUFDLEVBQUUsRUFBRSxDQUFDO1lBQ3BDLENBQUMsU0FBUyxDQUFDLENBQUMsRUFBRSxRQUFRLENBQUMsRUFBRSxDQUFDLFlBQVksQ0FBQyxFQUFFLENBQUMsRUFBRSxDQUFDO1lBQzdDLGdCQUFnQixDQUFDLEVBQUUsRUFBRSxTQUFTLENBQUMsRUFBRSxPQUFPO1FBQ3pDLENBQUM7UUFDRCxPQUFPLEVBQUU7WUFDUjtnQkFDQyxJQUFJLEVBQUUsQ0FBQyxHQUFHLENBQUMsS0FBSyxDQUFDO2dCQUNqQixTQUFTLEVBQUUsR0FBRyxDQUFDLEVBQUUsQ0FBQyxHQUFHLENBQUMsQ0FBQyxFQUFFLFFBQVEsRUFBRSxHQUFHLEVBQUUsSUFBSSxDQUFDO2dCQUM3QyxJQUFJLEVBQUUsR0FBRyxDQUFDLEVBQUUsQ0FBQyxHQUFHLENBQUMsQ0FBQyxFQUFFLFFBQVEsRUFBRSxFQUFFLElBQUksRUFBRSxTQUFTLEVBQUUsR0FBRyxFQUFFLFNBQVMsRUFBRSxFQUFFLElBQUk7WUFDeEUsQ0FBQztZQUNELFdBQVcsQ0FBQyxDQUFDO1lBQ2IsUUFBUSxDQUFDLENBQUM7WUFDVixJQUFJLENBQUM7UUFDTixDQUFDO1FBRUQsTUFBTSxFQUFFLENBQUMsRUFBRSxDQUFDLEVBQUU7SUFDZixDQUFDLENBQUM7SUFHRixNQUFNLGFBQWEsRUFBRSxNQUFNLENBQUMsVUFBVSxDQUFDLE1BQU0sQ0FBQyxLQUFLLENBQUMsRUFBRSxLQUFLLENBQUMsQ0FBQyxFQUFFLFFBQVEsQ0FBQyxFQUFFLElBQUksQ0FBQyxVQUFVLENBQUMsSUFBSSxDQUFDLENBQUM7SUFDaEcsTUFBTSxtQkFBbUIsRUFBRSxJQUFJLEdBQW1CLENBQUMsQ0FBQztJQUVwRCxJQUFJLENBQUMsTUFBTSxDQUFDLEVBQUUsRUFBRSxRQUFRLEVBQUUsR0FBRyxlQUFlLEVBQUU7UUFDN0MsTUFBTSxnQkFBZ0IsRUFBRSxNQUFNLGFBQWEsQ0FBQyxFQUFFLEVBQUUsUUFBUSxDQUFDO1FBQ3pELEdBQUcsQ0FBQyxlQUFlLEVBQUU7WUFDcEIsa0JBQWtCLENBQUMsR0FBRyxDQUFDLEVBQUUsRUFBRSxlQUFlLENBQUMsU0FBUyxDQUFDO1lBQ3JELFlBQVksQ0FBQyxJQUFJLENBQUMsQ0FBQyxDQUFDLENBQUMsZUFBZSxDQUFDLEtBQUssQ0FBQztRQUM1QztJQUNEO0lBRUEsTUFBTSxFQUFFLE9BQU8sRUFBRSxFQUFFLE1BQU0sTUFBTSxDQUFDLFFBQVEsQ0FBQztRQUN4QyxNQUFNLEVBQUUsZUFBZSxFQUFFLENBQUMsR0FBRyxFQUFFLEVBQUUsQ0FBQyxHQUFHLENBQUM7UUFDdEMsT0FBTyxFQUFFLEtBQUs7UUFDZCxLQUFLLEVBQUUsR0FBRyxDQUFDLEVBQUUsa0JBQWtCLENBQUMsR0FBRyxDQUFDLEVBQUUsRUFBRSxDQUFDLEVBQUUsRUFBRTtRQUM3QyxTQUFTLEVBQUUsU0FBUyxDQUFDLENBQUMsRUFBRSxTQUFTO1FBQ2pDLGFBQWEsRUFBRTtJQUNoQixDQUFDLENBQUM7SUFFRixNQUFNLE1BQU0sRUFBRSxNQUFNLENBQUMsQ0FBQyxDQUF1QjtJQUM3QyxNQUFNLGNBQWMsRUFBRSxLQUFLLENBQUMsSUFBSSxFQUFFLENBQUMsQ0FBQyxDQUFDLEtBQUssQ0FBQyxJQUFJLENBQUMsQ0FBQyxDQUFDLENBQUMsQ0FBQyxFQUFFLGdCQUFnQixDQUFDLENBQUMsQ0FBQyxLQUFLLENBQUMsR0FBRyxDQUFDLEtBQUssQ0FBQyxDQUFDLENBQUMsRUFBRSxFQUFFLEtBQUssQ0FBQyxJQUFJO0lBRXpHLE9BQU87UUFDTixNQUFNLEVBQUUsYUFBYTtRQUNyQixZQUFZLEVBQUU7SUFDZixDQUFDO0FBQ0Y7QUFJQSxTQUFTLGNBQWMsQ0FBQyxRQUFrQixFQUFFLE9BQXVCLEVBQUUsV0FBVyxFQUFFLEtBQUssRUFBb0I7SUFDMUcsTUFBTSxFQUFFLE1BQU0sRUFBRSxDQUFDLENBQUMsQ0FBQyxLQUFLLEVBQUUsRUFBRSxRQUEyQjtJQUN2RCxHQUFHLENBQUMsT0FBTyxDQUFDLENBQUMsRUFBRSxTQUFTLEVBQUUsRUFBRSxPQUFPLEVBQUUsUUFBUSxFQUFFLFFBQVEsRUFBRSxZQUFZLEVBQUUsQ0FBQyxFQUFFLENBQUMsRUFBRTtJQUU3RSxHQUFHLENBQUMsUUFBUSxDQUFDLENBQUMsRUFBRSxTQUFTLEVBQUU7UUFDMUIsUUFBUSxFQUFFLEVBQUUsTUFBTSxFQUFFLE1BQU0sRUFBRSxZQUFZLEVBQUUsQ0FBQyxFQUFFLENBQUM7SUFDL0M7SUFFQSxNQUFNLFFBQVEsRUFBRTtRQUNmLEVBQUUsWUFBWSxDQUFDLElBQUksQ0FBQyxJQUFJLEVBQUUsT0FBTyxDQUFDLE1BQU07UUFDeEMsRUFBRSxFQUFFLElBQUksRUFBRSxPQUFPLENBQUMsTUFBTSxFQUFFLEdBQUcsRUFBRSxVQUFVLENBQUM7SUFFM0MsT0FBTztRQUNOLFFBQVEsRUFBRSxFQUFFLENBQUMsQ0FBQyxDQUFDLElBQUksRUFBRSxDQUFDLENBQUMsQ0FBQyxXQUFXLENBQUMsT0FBTyxDQUFDLElBQUksRUFBRSxPQUFPLENBQUMsR0FBRyxFQUFFLENBQUM7UUFDaEUsWUFBWSxFQUFFLE9BQU8sQ0FBQztJQUN2QixDQUFDO0FBQ0Y7QUFFQSxTQUFTLFVBQVUsQ0FBQyxJQUFhLEVBQUU7SUFDbEMsTUFBTSxVQUFVLEVBQUUsSUFBSSxDQUFDLFNBQVM7SUFDaEMsT0FBTyxVQUFVLENBQUMsRUFBRSxTQUFTLENBQUMsSUFBSSxDQUFDLElBQUksQ0FBQztRQUN2QyxHQUFHLENBQUMsS0FBSyxDQUFDLENBQUMsRUFBRSxFQUFFLENBQUMsVUFBVSxDQUFDO0lBQzVCLENBQUM7QUFDRjtBQUVBLFNBQVMsVUFBYSxDQUFDLEtBQTJCLEVBQWM7SUFDL0QsT0FBTyxNQUFNLENBQUMsRUFBRSxTQUFTO0FBQzFCO0FBRUEsU0FBUyxhQUFhO0lBQ3JCLFdBQW1DO0lBQ25DLFFBQWdCO0lBQ2hCLE9BQW1CO0lBQ25CLFVBQXlCO0lBQ3pCO0FBQ0QsRUFBeUI7SUFDeEIsTUFBTSxZQUFZLEVBQUUsT0FBTyxDQUFDLGNBQWMsQ0FBQyxDQUFDO0lBRTVDLE1BQU0sVUFBVSxFQUFFLFdBQVcsQ0FBQywyQkFBMkIsQ0FBQyxXQUFXLENBQUU7SUFHdkUsSUFBSSxXQUFnQyxFQUFFLFdBQVcsQ0FBQyx3QkFBd0IsQ0FBQyxTQUFTLENBQUM7SUFDckYsTUFBTSxPQUFPLEVBQUUsYUFBYSxDQUFDLFVBQVUsQ0FBQztJQUN4QyxHQUFHLENBQUMsTUFBTSxFQUFFO1FBQ1gsTUFBTSxjQUFjLEVBQUUsQ0FBQyxVQUE4QixDQUFDLENBQUMsYUFBYTtRQUNwRSxXQUFXLEVBQUUsY0FBYyxFQUFFLGFBQWEsQ0FBQyxDQUFDLEVBQUUsRUFBRSxTQUFTO0lBQzFEO0lBRUEsTUFBTSxjQUFjLEVBQUUsV0FBVyxFQUFFLFdBQVcsQ0FBQyxZQUFZLENBQUMsVUFBVSxFQUFFLEVBQUUsQ0FBQyxJQUFJLENBQUM7SUFDaEYsTUFBTSxZQUFZLEVBQUUsU0FBUyxDQUFDLGFBQWEsQ0FBQztJQUU1QyxNQUFNLFNBQVMsRUFBRSxXQUFXLENBQUMsV0FBVyxFQUFFLFVBQVUsQ0FBQztJQUdyRCxHQUFHLENBQUMsV0FBVyxDQUFDLE9BQU8sRUFBRSxDQUFDLEVBQUU7UUFDM0IsTUFBTSxLQUFLLEVBQUUsSUFBSSxDQUFDLFFBQVEsQ0FBQyxRQUFRLENBQUM7UUFDcEMsTUFBTSxLQUFLLEVBQUUsUUFBUSxDQUFDLElBQUk7UUFDMUIsTUFBTSxLQUFLLEVBQUUsUUFBUSxDQUFDLFNBQVM7UUFFL0IsTUFBTSxDQUFDLElBQUk7WUFDVixDQUFDLENBQUMsR0FBRyxFQUFFLENBQUMsQ0FBQyxJQUFJLENBQUMsQ0FBQyxDQUFDLENBQUMsSUFBSSxDQUFDLENBQUMsQ0FBQyxDQUFDLElBQUksQ0FBQyxDQUFDLEVBQUUsRUFBRTtZQUNuQyxDQUFDLFdBQVcsTUFBTSxPQUFPLEtBQUssQ0FBQyxDQUFDLENBQUMsYUFBYSxDQUFDLENBQUM7UUFDakQsQ0FBQztRQUVELE9BQU8sSUFBSTtJQUNaO0lBRUEsTUFBTSxXQUFXLEVBQUUsV0FBVyxDQUFDLFVBQVUsQ0FBQyxHQUFHLENBQUMsTUFBTSxDQUFDLEVBQUU7UUFDdEQsT0FBTyxjQUFjLENBQUMsS0FBSyxFQUFFLFdBQVcsQ0FBQztJQUMxQyxDQUFDLENBQUM7SUFFRixPQUFPO1FBQ04sSUFBSSxFQUFFLFdBQVcsQ0FBQyxJQUFLLENBQUMsT0FBTyxDQUFDLENBQUM7UUFDakMsVUFBVSxFQUFFLFVBQVU7UUFDdEIsV0FBVyxFQUFFLFdBQVc7UUFDeEIsTUFBTSxFQUFFLE1BQU07UUFDZCxJQUFJLEVBQUUsUUFBUSxDQUFDLElBQUk7UUFDbkIsU0FBUyxFQUFFLFFBQVEsQ0FBQztJQUNyQixDQUFDO0FBQ0Y7QUFFQSxTQUFTLGFBQWEsQ0FBQyxJQUFhLEVBQUU7SUFDckMsTUFBTSxPQUFPLEVBQUUsSUFBSSxDQUFDLFNBQVMsQ0FBQyxDQUFDO0lBQy9CLE9BQU8sT0FBTyxDQUFDLENBQUMsRUFBRSxVQUFVLENBQUMsRUFBRSxNQUFNLENBQUMsT0FBTyxDQUFDLEVBQUUsQ0FBQyxDQUFDLEVBQUUsQ0FBQyxPQUFPLENBQUM7QUFDOUQ7QUFFQSxTQUFTLGNBQWM7SUFDdEIsS0FBOEI7SUFDOUI7QUFDRCxFQUFFO0lBQ0QsTUFBTSxLQUFLLEVBQUUsV0FBVyxDQUFDLGlCQUFpQixDQUFDLEtBQUssQ0FBQyxJQUFLLENBQUM7SUFDdkQsTUFBTSxNQUFNLEVBQUUsU0FBUyxDQUFDLFdBQVcsQ0FBQyxZQUFZLENBQUMsSUFBSSxDQUFDLENBQUM7SUFDdkQsTUFBTSxTQUFTLEVBQUU7UUFDaEIsS0FBSyxDQUFDLFlBQVksQ0FBQyxDQUFDLEVBQUU7WUFDckIsRUFBRSxXQUFXLENBQUMsbUJBQW1CLENBQUMsS0FBSztZQUN2QyxFQUFFO0lBQ0osQ0FBQztJQUVELE9BQU87UUFDTixJQUFJLEVBQUUsS0FBSyxDQUFDLElBQUksQ0FBQyxPQUFPLENBQUMsQ0FBQztRQUMxQixLQUFLLEVBQUUsS0FBSztRQUNaLFFBQVEsRUFBRTtJQUNYLENBQUM7QUFDRjtBQUVBLFNBQVMsU0FBUyxDQUFDLE9BQWUsRUFBZ0I7SUFDakQsT0FBTyxPQUFPLENBQUMsS0FBSyxDQUFDLEVBQUUsRUFBRSxDQUFDLENBQUMsQ0FBQyxHQUFHLENBQUMsSUFBSSxDQUFDLEVBQUU7UUFDdEMsTUFBTSxLQUFLLEVBQUUsR0FBRyxDQUFDLE9BQU8sQ0FBQyxDQUFDLENBQUMsQ0FBQyxDQUFDLENBQUMsQ0FBQyxDQUFDLEVBQUUsQ0FBQyxDQUFDLENBQUM7UUFDckMsTUFBTSxXQUFXLEVBQUUsQ0FBQyxHQUFHLENBQUMsS0FBSyxDQUFDLENBQUMsQ0FBQyxDQUFDLENBQUMsQ0FBQyxDQUFDLENBQUMsRUFBRSxDQUFDLEVBQUUsQ0FBQyxDQUFDLENBQUMsQ0FBQyxNQUFNO1FBQ3BELE9BQU87WUFDTixJQUFJLEVBQUUsSUFBSTtZQUNWLFVBQVUsRUFBRTtRQUNiLENBQUM7SUFDRixDQUFDLENBQUM7QUFDSDtBQUVBLFNBQVMsV0FBVyxDQUFDLElBQWEsRUFBRSxVQUF5QixFQUFFO0lBQzlELE1BQU0sSUFBSSxFQUFFLFVBQVUsQ0FBQyw2QkFBNkI7UUFDbkQsSUFBSSxDQUFDLFFBQVEsQ0FBQyxVQUFVLEVBQUUsSUFBSTtJQUMvQixDQUFDO0lBRUQsR0FBRyxDQUFDLEtBQUssQ0FBQyxFQUFFLENBQUM7SUFDYixHQUFHLENBQUMsVUFBVSxDQUFDLEVBQUUsQ0FBQztJQUVsQixPQUFPLEdBQUc7QUFDWDtBQUVBLFNBQVMsU0FBUyxDQUFDLE1BQWlCLEVBQUUsV0FBMkIsRUFBVztJQUMzRSxNQUFNLGFBQWEsRUFBRSxjQUFjLENBQUMsR0FBRyxDQUFDLE1BQU0sQ0FBQztJQUMvQyxHQUFHLENBQUMsYUFBYSxDQUFDLENBQUMsRUFBRSxTQUFTLEVBQUUsRUFBRSxPQUFPLFlBQVksRUFBRTtJQUd2RCxjQUFjLENBQUMsR0FBRyxDQUFDLE1BQU0sRUFBRSxLQUFLLENBQUM7SUFFakMsSUFBSSxPQUFPLEVBQUUsQ0FBQyxNQUFNLENBQUMsT0FBTyxDQUFDLEVBQUUsQ0FBQyxDQUFDLEVBQUUsQ0FBQyxPQUFPLENBQUMsQ0FBQztJQUM3QyxHQUFHLENBQUMsQ0FBQyxPQUFPLENBQUMsRUFBRSxDQUFDLE1BQU0sQ0FBQyxNQUFNLEVBQUUsRUFBRSxDQUFDLFdBQVcsQ0FBQyxLQUFLLENBQUMsRUFBRTtRQUNyRCxNQUFNLFVBQVUsRUFBRSxXQUFXLENBQUMsdUJBQXVCLENBQUMsTUFBTSxDQUFDLENBQUMsWUFBWSxDQUFDLEVBQUUsQ0FBQyxFQUFFLENBQUMsQ0FBQztRQUNsRixPQUFPLEVBQUUsU0FBUyxDQUFDLElBQUksQ0FBQyxTQUFTLENBQUMsRUFBRTtZQUNuQyxNQUFNLFdBQVcsRUFBRSxRQUFRLENBQUMsU0FBUyxDQUFDLENBQUM7WUFDdkMsT0FBTyxXQUFXLENBQUMsQ0FBQyxFQUFFLFVBQVUsQ0FBQyxFQUFFLFNBQVMsQ0FBQyxVQUFVLEVBQUUsV0FBVyxDQUFDO1FBQ3RFLENBQUMsQ0FBQztJQUNIO0lBRUEsY0FBYyxDQUFDLEdBQUcsQ0FBQyxNQUFNLEVBQUUsTUFBTSxDQUFDO0lBRWxDLE9BQU8sTUFBTTtBQUNkO0FBSUEsU0FBUyxnQkFBZ0I7SUFDeEIsT0FBbUI7SUFDbkI7QUFDRCxFQUFFO0lBQ0QsTUFBTSxZQUFZLEVBQUUsT0FBTyxDQUFDLGNBQWMsQ0FBQyxDQUFDO0lBRTVDLE1BQU0sYUFBYSxFQUFFLElBQUksR0FBVyxDQUFDLENBQUM7SUFFdEMsTUFBTSxVQUFVLEVBQUUsQ0FBQyxNQUE2QixFQUFFLENBQUMsRUFBRTtRQUNwRCxHQUFHLENBQUMsT0FBTyxDQUFDLENBQUMsRUFBRSxTQUFTLEVBQUUsRUFBRSxNQUFNLEVBQUU7UUFFcEMsR0FBRyxDQUFDLE1BQU0sQ0FBQyxNQUFNLEVBQUUsRUFBRSxDQUFDLFdBQVcsQ0FBQyxLQUFLLEVBQUU7WUFDeEMsT0FBTyxFQUFFLFdBQVcsQ0FBQyxnQkFBZ0IsQ0FBQyxNQUFNLENBQUM7UUFDOUM7UUFFQSxHQUFHLENBQUMsU0FBUyxDQUFDLE1BQU0sRUFBRSxXQUFXLENBQUMsRUFBRTtZQUNuQyxZQUFZLENBQUMsR0FBRyxDQUFDLE1BQU0sQ0FBQyxPQUFPLENBQUMsQ0FBQyxDQUFDO1FBQ25DO0lBQ0QsQ0FBQztJQUVELE1BQU0sVUFBVSxFQUFFLENBQUMsV0FBaUMsRUFBRSxDQUFDLEVBQUU7UUFDeEQsTUFBTSxXQUFXLEVBQUUsQ0FBQyxXQUFXLENBQUMsZUFBbUMsQ0FBQyxDQUFDLElBQUk7UUFDekUsTUFBTSxhQUFhLEVBQUUsV0FBVyxDQUFDLFlBQVk7UUFDN0MsR0FBRyxDQUFDLENBQUMsVUFBVSxDQUFDLFVBQVUsQ0FBQyxDQUFDLEVBQUUsQ0FBQyxDQUFDLEVBQUUsQ0FBQyxFQUFFLENBQUMsWUFBWSxFQUFFLEVBQUUsTUFBTSxFQUFFO1FBRTlELEdBQUcsQ0FBQyxZQUFZLENBQUMsSUFBSSxFQUFFO1lBQ3RCLFNBQVMsQ0FBQyxXQUFXLENBQUMsbUJBQW1CLENBQUMsWUFBWSxDQUFDLElBQUksQ0FBQyxDQUFDO1FBQzlEO1FBRUEsTUFBTSxjQUFjLEVBQUUsWUFBWSxDQUFDLGFBQWE7UUFDaEQsR0FBRyxDQUFDLENBQUMsYUFBYSxFQUFFLEVBQUUsTUFBTSxFQUFFO1FBRTlCLEdBQUcsQ0FBQyxFQUFFLENBQUMsaUJBQWlCLENBQUMsYUFBYSxDQUFDLEVBQUU7WUFDeEMsTUFBTSxhQUFhLEVBQUUsV0FBVyxDQUFDLG1CQUFtQixDQUFDLFdBQVcsQ0FBQyxlQUFlLENBQUM7WUFDakYsR0FBRyxDQUFDLFlBQVksRUFBRTtnQkFDakIsV0FBVyxDQUFDLGtCQUFrQixDQUFDLFlBQVksQ0FBQyxDQUFDLE9BQU8sQ0FBQyxTQUFTLENBQUM7WUFDaEU7UUFDRDtRQUNBLEtBQUs7WUFDSixJQUFJLENBQUMsTUFBTSxRQUFRLEdBQUcsYUFBYSxDQUFDLFFBQVEsRUFBRTtnQkFDN0MsU0FBUyxDQUFDLFdBQVcsQ0FBQyxtQkFBbUIsQ0FBQyxPQUFPLENBQUMsSUFBSSxDQUFDLENBQUM7WUFDekQ7UUFDRDtJQUNELENBQUM7SUFFRCxNQUFNLGFBQWEsRUFBRSxDQUFDLElBQWEsRUFBRSxDQUFDLEVBQUU7UUFDdkMsR0FBRyxDQUFDLEVBQUUsQ0FBQyxtQkFBbUIsQ0FBQyxJQUFJLENBQUMsRUFBRTtZQUNqQyxTQUFTLENBQUMsSUFBSSxDQUFDO1lBQ2YsTUFBTTtRQUNQO1FBRUEsR0FBRyxDQUFDLEVBQUUsQ0FBQyxtQkFBbUIsQ0FBQyxJQUFJLENBQUMsRUFBRTtZQUNqQyxTQUFTLENBQUMsV0FBVyxDQUFDLG1CQUFtQixDQUFDLElBQUksQ0FBQyxRQUFRLENBQUMsQ0FBQztRQUMxRDtRQUVBLEVBQUUsQ0FBQyxZQUFZLENBQUMsSUFBSSxFQUFFLFlBQVksQ0FBQztJQUNwQyxDQUFDO0lBRUQsWUFBWSxDQUFDLFVBQVUsQ0FBQztJQUV4QixPQUFPLEtBQUssQ0FBQyxJQUFJLENBQUMsWUFBWSxDQUFDO0FBQ2hDO0FBSUEsU0FBUyxZQUFZLENBQUMsRUFBVSxFQUFFLE9BQWUsRUFBRTtJQUNsRCxNQUFNLEtBQUssRUFBRSxNQUFNLENBQUMsSUFBSSxDQUFDLE9BQU8sRUFBRSxDQUFDLElBQUksQ0FBQyxDQUFDO0lBQ3pDLE9BQU8sQ0FBQyxNQUFNLENBQUMsS0FBSyxDQUFDLENBQUMsQ0FBQyxDQUFDLEVBQUUsRUFBRSxDQUFDLENBQUMsSUFBSSxDQUFDLE1BQU0sQ0FBQyxDQUFDLENBQUMsQ0FBQyxDQUFDO0lBQzlDLE9BQU8sQ0FBQyxNQUFNLENBQUMsS0FBSyxDQUFDLElBQUksQ0FBQztBQUMzQjtBQUdBLFNBQVMsaUJBQWlCLENBQUMsWUFBMEIsRUFBRTtJQUN0RCxZQUFZLENBQUMsQ0FBQyxFQUFFLElBQUksQ0FBQyxTQUFTLENBQUMsWUFBWSxDQUFDLENBQUM7QUFDOUM7QUFFQSxTQUFTLGFBQWEsQ0FBQyxHQUFzQixFQUFFLFFBQTJCLEVBQUU7SUFDM0UsR0FBRyxDQUFDLE9BQU8sU0FBUyxDQUFDLENBQUMsRUFBRSxDQUFDLE1BQU0sQ0FBQyxFQUFFO1FBQ2pDLFNBQVMsRUFBRSxJQUFJLENBQUMsU0FBUyxDQUFDLFFBQVEsQ0FBQztJQUNwQztJQUVBLElBQUksQ0FBQyxNQUFNLEdBQUcsR0FBRyxLQUFLLENBQUMsT0FBTyxDQUFDLEdBQUcsRUFBRSxFQUFFLElBQUksRUFBRSxDQUFDLEdBQUcsQ0FBQyxFQUFFO1FBQ2xELFlBQVksQ0FBQyxFQUFFLEVBQUUsUUFBUSxDQUFDO0lBQzNCO0lBRUEsT0FBTyxRQUFRO0FBQ2hCO0FBRUEsU0FBUyxnQkFBZ0IsQ0FBQyxVQUF5QixFQUFpQjtJQUNuRSxNQUFNLFlBQVksRUFBRSxhQUFhLENBQUMsR0FBRyxDQUFDLFVBQVUsQ0FBQztJQUNqRCxHQUFHLENBQUMsV0FBVyxFQUFFLEVBQUUsT0FBTyxXQUFXLEVBQUU7SUFFdkMsTUFBTSxTQUFTLEVBQUUsRUFBRSxDQUFDLGNBQWMsQ0FBQyxVQUFVLENBQUMsSUFBSSxFQUFFLElBQUksRUFBRSxJQUFJLENBQUM7SUFDL0QsTUFBTSxVQUFVLEVBQUUsSUFBSSxDQUFDLE9BQU8sQ0FBQyxVQUFVLENBQUMsUUFBUSxDQUFDO0lBRW5ELE1BQU0sVUFBb0IsRUFBRSxDQUFDLENBQUM7SUFDOUIsTUFBTSxXQUFxQixFQUFFLENBQUMsQ0FBQztJQUUvQixJQUFJLENBQUMsTUFBTSxJQUFJLEdBQUcsUUFBUSxDQUFDLGFBQWEsRUFBRTtRQUN6QyxNQUFNLGVBQWUsRUFBRSxpQkFBaUIsQ0FBQyxHQUFHLENBQUMsUUFBUSxFQUFFLFVBQVUsQ0FBQyxRQUFRLENBQUM7UUFDM0UsR0FBRyxDQUFDLGNBQWMsRUFBRTtZQUNuQixTQUFTLENBQUMsSUFBSSxDQUFDLGNBQWMsQ0FBQyxnQkFBZ0IsQ0FBQztRQUNoRDtRQUNBLEtBQUs7WUFDSixVQUFVLENBQUMsSUFBSSxDQUFDLEdBQUcsQ0FBQyxRQUFRLENBQUM7UUFDOUI7SUFDRDtJQUVBLElBQUksQ0FBQyxNQUFNLElBQUksR0FBRyxRQUFRLENBQUMsZUFBZSxFQUFFO1FBQzNDLFNBQVMsQ0FBQyxJQUFJLENBQUMsSUFBSSxDQUFDLE9BQU8sQ0FBQyxTQUFTLEVBQUUsR0FBRyxDQUFDLFFBQVEsQ0FBQyxDQUFDO0lBQ3REO0lBRUEsTUFBTSxNQUFNLEVBQUUsRUFBRSxTQUFTLEVBQUUsU0FBUyxFQUFFLFVBQVUsRUFBRSxXQUFXLENBQUM7SUFJOUQsR0FBRyxDQUFDLFVBQVUsQ0FBQyxPQUFPLENBQUMsQ0FBQyxFQUFFLENBQUMsRUFBRTtRQUM1QixhQUFhLENBQUMsR0FBRyxDQUFDLFVBQVUsRUFBRSxLQUFLLENBQUM7SUFDckM7SUFFQSxPQUFPLEtBQUs7QUFDYjtBQUtBLFNBQVMsbUJBQW1CLENBQUMsT0FBbUIsRUFBRSxVQUF5QixFQUFtQjtJQUM3RixNQUFNLGFBQWEsRUFBRSxJQUFJLEdBQVcsQ0FBQyxDQUFDO0lBQ3RDLE1BQU0sV0FBNkMsRUFBRSxDQUFDLENBQUM7SUFFdkQsTUFBTSxNQUFNLEVBQUUsQ0FBQyxJQUFtQixFQUFFLENBQUMsRUFBRTtRQUN0QyxNQUFNLE1BQU0sRUFBRSxnQkFBZ0IsQ0FBQyxJQUFJLENBQUM7UUFDcEMsR0FBRyxDQUFDLEtBQUssQ0FBQyxVQUFVLENBQUMsT0FBTyxFQUFFLENBQUMsRUFBRTtZQUNoQyxVQUFVLENBQUMsSUFBSSxDQUFDLFFBQVEsRUFBRSxFQUFFLEtBQUssQ0FBQyxVQUFVO1FBQzdDO1FBRUEsSUFBSSxDQUFDLE1BQU0sU0FBUyxHQUFHLEtBQUssQ0FBQyxTQUFTLEVBQUU7WUFDdkMsR0FBRyxDQUFDLFlBQVksQ0FBQyxHQUFHLENBQUMsUUFBUSxDQUFDLEVBQUUsRUFBRSxRQUFRLEVBQUU7WUFDNUMsWUFBWSxDQUFDLEdBQUcsQ0FBQyxRQUFRLENBQUM7WUFFMUIsTUFBTSxlQUFlLEVBQUUsT0FBTyxDQUFDLGFBQWEsQ0FBQyxRQUFRLENBQUM7WUFDdEQsR0FBRyxDQUFDLGNBQWMsRUFBRSxFQUFFLEtBQUssQ0FBQyxjQUFjLENBQUMsRUFBRTtRQUM5QztJQUNELENBQUM7SUFFRCxLQUFLLENBQUMsVUFBVSxDQUFDO0lBRWpCLElBQUksQ0FBQyxNQUFNLEtBQUssR0FBRyxPQUFPLENBQUMsY0FBYyxDQUFDLENBQUMsRUFBRTtRQUM1QyxHQUFHLENBQUMsQ0FBQyxFQUFFLENBQUMsZ0JBQWdCLENBQUMsSUFBSSxFQUFFLENBQUMsRUFBRSxDQUFDLE9BQU8sQ0FBQywwQkFBMEIsQ0FBQyxJQUFJLENBQUMsRUFBRTtZQUM1RSxZQUFZLENBQUMsR0FBRyxDQUFDLElBQUksQ0FBQyxRQUFRLENBQUM7UUFDaEM7SUFDRDtJQUVBLFlBQVksQ0FBQyxNQUFNLENBQUMsVUFBVSxDQUFDLFFBQVEsQ0FBQztJQUV4QyxPQUFPLEVBQUUsU0FBUyxFQUFFLEtBQUssQ0FBQyxJQUFJLENBQUMsWUFBWSxDQUFDLEVBQUUsVUFBVSxFQUFFLFdBQVcsQ0FBQztBQUN2RTtBQUVBLFNBQVMsYUFBYTtJQUNyQixRQUFnQjtJQUNoQixRQUFrQjtJQUNsQixXQUFtQjtJQUNuQixPQUFtQjtJQUNuQjtBQUNELEVBQUU7SUFDRCxNQUFNLFdBQVcsRUFBRSxPQUFPLENBQUMsYUFBYSxDQUFDLFFBQVEsQ0FBQztJQUNsRCxHQUFHLENBQUMsQ0FBQyxVQUFVLEVBQUUsRUFBRSxNQUFNLEVBQUU7SUFJM0IsTUFBTSxTQUFTLEVBQUUsUUFBUSxDQUFDLFVBQVUsQ0FBQyxJQUFJLENBQUM7SUFDMUMsTUFBTSxnQkFBZ0IsRUFBRSxtQkFBbUIsQ0FBQyxPQUFPLEVBQUUsVUFBVSxDQUFDO0lBR2hFLE1BQU0sYUFBNkMsRUFBRSxDQUFDLENBQUM7SUFDdkQsSUFBSSxDQUFDLE1BQU0sV0FBVyxHQUFHLENBQUMsQ0FBQyxDQUFDLENBQUMsZUFBZSxDQUFDLFNBQVMsRUFBRSxDQUFDLENBQUMsQ0FBQyxZQUFZLENBQUMsRUFBRTtRQUN6RSxNQUFNLGVBQWUsRUFBRSxPQUFPLENBQUMsYUFBYSxDQUFDLFVBQVUsQ0FBQztRQUN4RCxNQUFNLGVBQWUsRUFBRSxlQUFlLEVBQUUsUUFBUSxDQUFDLGNBQWMsQ0FBQyxJQUFJLEVBQUUsRUFBRSxXQUFXLENBQUMsVUFBVSxDQUFDO1FBQy9GLEdBQUcsQ0FBQyxDQUFDLGNBQWMsRUFBRSxFQUFFLE1BQU0sRUFBRTtRQUMvQixZQUFZLENBQUMsVUFBVSxFQUFFLEVBQUUsY0FBYztJQUMxQztJQUVBLGFBQWEsQ0FBQyxPQUFPLENBQUMsUUFBUSxFQUFFLEVBQUU7UUFDakMsUUFBUSxFQUFFLFdBQVc7UUFDckIsVUFBVSxFQUFFLENBQUMsUUFBMkIsQ0FBQyxDQUFDLFVBQVU7UUFDcEQsT0FBTyxFQUFFLFVBQVUsQ0FBQyxpQkFBaUI7UUFDckMsUUFBUSxFQUFFLFFBQVE7UUFDbEIsWUFBWSxFQUFFLFlBQVk7UUFDMUIsVUFBVSxFQUFFLGVBQWUsQ0FBQztJQUM3QixDQUFDO0lBRUQsU0FBUyxDQUFDLENBQUMsU0FBUyxDQUFDLElBQUksQ0FBQyxFQUFFLGFBQWEsRUFBRSxtQkFBbUIsQ0FBQztBQUNoRTtBQUlBLFNBQVMsbUJBQW1CLENBQUMsS0FBZ0MsRUFBRTtJQUM5RCxHQUFHLENBQUMsQ0FBQyxjQUFjLEVBQUUsRUFBRSxNQUFNLEVBQUU7SUFFL0IsTUFBTSxrQkFBa0IsRUFBRSxJQUFJLEdBQVcsQ0FBQyxDQUFDO0lBQzNDLElBQUksQ0FBQyxNQUFNLFNBQVMsR0FBRyxNQUFNLENBQUMsSUFBSSxDQUFDLEtBQUssQ0FBQyxPQUFPLENBQUMsRUFBRTtRQUNsRCxNQUFNLFdBQVcsRUFBRSxLQUFLLENBQUMsT0FBTyxDQUFDLFFBQVEsQ0FBQyxDQUFDLFVBQVU7UUFDckQsR0FBRyxDQUFDLFVBQVUsRUFBRSxFQUFFLGlCQUFpQixDQUFDLEdBQUcsQ0FBQyxJQUFJLENBQUMsUUFBUSxDQUFDLFVBQVUsQ0FBQyxDQUFDLEVBQUU7SUFDckU7SUFFQSxNQUFNLGNBQWMsRUFBRSxJQUFJLENBQUMsSUFBSSxDQUFDLGNBQWMsRUFBRSxDQUFDLElBQUksQ0FBQyxDQUFDO0lBRXZELElBQUksU0FBbUI7SUFDdkIsSUFBSSxFQUFFLFVBQVUsRUFBRSxFQUFFLENBQUMsV0FBVyxDQUFDLGFBQWEsQ0FBQyxFQUFFO0lBQ2pELE1BQU0sRUFBRSxNQUFNLEVBQUU7SUFFaEIsTUFBTSxXQUFXLEVBQUUsSUFBSSxDQUFDLEdBQUcsQ0FBQyxFQUFFLEVBQUUsWUFBWTtJQUU1QyxJQUFJLENBQUMsTUFBTSxTQUFTLEdBQUcsU0FBUyxFQUFFO1FBRWpDLE1BQU0sYUFBYSxFQUFFLFFBQVEsQ0FBQyxPQUFPLENBQUMsQ0FBQyxDQUFDLEVBQUUsQ0FBQyxDQUFDO1FBQzVDLE1BQU0sV0FBVyxFQUFFLGFBQWEsQ0FBQyxDQUFDLEVBQUUsQ0FBQyxFQUFFLEVBQUUsUUFBUSxDQUFDLEtBQUssQ0FBQyxDQUFDLEVBQUUsYUFBYSxFQUFFLENBQUMsRUFBRSxFQUFFLFFBQVE7UUFDdkYsR0FBRyxDQUFDLGlCQUFpQixDQUFDLEdBQUcsQ0FBQyxVQUFVLENBQUMsRUFBRSxFQUFFLFFBQVEsRUFBRTtRQUVuRCxNQUFNLFNBQVMsRUFBRSxJQUFJLENBQUMsSUFBSSxDQUFDLGFBQWEsRUFBRSxRQUFRLENBQUM7UUFDbkQsSUFBSTtZQUNILEdBQUcsQ0FBQyxFQUFFLENBQUMsUUFBUSxDQUFDLFFBQVEsQ0FBQyxDQUFDLFFBQVEsRUFBRSxVQUFVLEVBQUUsRUFBRSxFQUFFLENBQUMsVUFBVSxDQUFDLFFBQVEsQ0FBQyxFQUFFO1FBQzVFO1FBQ0EsTUFBTTtRQUVOO0lBQ0Q7QUFDRDtBQUVBLFNBQVMsa0JBQWtCLENBQUMsUUFBZ0IsRUFBRTtJQUM3QyxNQUFNLGVBQWUsRUFBRSxhQUFhLENBQUMsT0FBTyxDQUFDLFFBQVEsQ0FBQztJQUN0RCxHQUFHLENBQUMsQ0FBQyxlQUFlLENBQUMsRUFBRSxXQUFXLENBQUMsUUFBUSxFQUFFLENBQUMsQ0FBQyxFQUFFLGNBQWMsQ0FBQyxRQUFRLEVBQUUsRUFBRSxPQUFPLFNBQVMsRUFBRTtJQUM5RixHQUFHLENBQUMsQ0FBQyxDQUFDLGNBQWMsQ0FBQyxRQUFRLENBQUMsQ0FBQyxFQUFFLENBQUMsQ0FBQyxVQUFVLENBQUMsaUJBQWlCLEVBQUUsRUFBRSxPQUFPLFNBQVMsRUFBRTtJQUVyRixJQUFJLENBQUMsTUFBTSxXQUFXLEdBQUcsTUFBTSxDQUFDLElBQUksQ0FBQyxjQUFjLENBQUMsWUFBWSxDQUFDLEVBQUU7UUFDbEUsR0FBRyxDQUFDLFdBQVcsQ0FBQyxVQUFVLEVBQUUsQ0FBQyxDQUFDLEVBQUUsY0FBYyxDQUFDLFlBQVksQ0FBQyxVQUFVLENBQUMsRUFBRSxFQUFFLE9BQU8sU0FBUyxFQUFFO0lBQzlGO0lBSUEsTUFBTSxXQUFXLEVBQUUsY0FBYyxDQUFDLFdBQVcsQ0FBQyxFQUFFLENBQUMsQ0FBQztJQUNsRCxJQUFJLENBQUMsTUFBTSxlQUFlLEdBQUcsTUFBTSxDQUFDLElBQUksQ0FBQyxVQUFVLENBQUMsRUFBRTtRQUNyRCxHQUFHLENBQUMsVUFBVSxDQUFDLGNBQWMsQ0FBQyxDQUFDLElBQUksQ0FBQyxXQUFXLENBQUMsRUFBRSxpQkFBaUIsQ0FBQyxVQUFVLEVBQUUsY0FBYyxFQUFFLENBQUMsQ0FBQyxFQUFFLFNBQVMsQ0FBQyxFQUFFO1lBQy9HLE9BQU8sU0FBUztRQUNqQjtJQUNEO0lBR0EsR0FBRyxDQUFDLGNBQWMsQ0FBQyxXQUFXLENBQUMsRUFBRSxDQUFDLEVBQUUsQ0FBQyxVQUFVLENBQUMsY0FBYyxDQUFDLFVBQVUsQ0FBQyxFQUFFLEVBQUUsT0FBTyxTQUFTLEVBQUU7SUFFaEcsT0FBTyxjQUFjLENBQUMsUUFBUTtBQUMvQjtBQU1BLFNBQVMsT0FBTztJQUNmLEdBQXNCO0lBQ3RCLFFBQWdCO0lBQ2hCLFFBQWtCO0lBQ2xCLE9BQW9CO0lBQ3BCLFdBQVcsRUFBRTtBQUNkLEVBQUU7SUFDRCxNQUFNLE9BQU8sRUFBRSxDQUFDLE9BQXVCLEVBQUUsQ0FBQyxFQUFFO1FBQzNDLE1BQU0sRUFBRSxRQUFRLEVBQUUsZ0JBQWdCLEVBQUUsYUFBYSxFQUFFLEVBQUUsY0FBYyxDQUFDLFFBQVEsRUFBRSxPQUFPLEVBQUUsVUFBVSxDQUFDO1FBQ2xHLE1BQU0sWUFBWSxFQUFFLGFBQWEsQ0FBQyxHQUFHLEVBQUUsZ0JBQWdCLENBQUM7UUFFeEQsR0FBRyxDQUFDLFFBQVEsQ0FBQyxFQUFFLENBQUMsT0FBTyxFQUFFLEdBQUcsZ0JBQWdCLEVBQUU7WUFDN0MsYUFBYSxDQUFDLFFBQVEsRUFBRSxnQkFBZ0IsRUFBRSxXQUFXLEVBQUUsT0FBTyxFQUFFLFlBQVksQ0FBQztRQUM5RTtJQUNELENBQUM7SUFFRCxNQUFNLEtBQUssRUFBRSxDQUFDLEtBQVUsRUFBRSxDQUFDLEVBQUU7UUFDNUIsYUFBYSxDQUFDLEdBQUcsRUFBRSxFQUFFLE1BQU0sRUFBRSxDQUFDLENBQUMsQ0FBQyxHQUFHLENBQUMsRUFBRSxDQUFDLENBQUMsS0FBSyxDQUFDLE1BQU0sQ0FBQyxFQUFFLEtBQUssQ0FBQyxDQUFDLEVBQUUsQ0FBQyxDQUFDO0lBQ25FLENBQUM7SUFFRCxNQUFNLEVBQUUsT0FBTyxFQUFFLEVBQUUsUUFBMkI7SUFDOUMsR0FBRyxDQUFDLE9BQU8sQ0FBQyxDQUFDLEVBQUUsVUFBVSxDQUFDLEVBQUUsQ0FBQyxVQUFVLENBQUMsa0JBQWtCLENBQUMsRUFBRSxnQkFBZ0IsQ0FBQyxNQUFNLENBQUMsQ0FBQyxPQUFPLENBQUMsQ0FBQyxFQUFFLENBQUMsRUFBRTtRQUNuRyxJQUFJLEVBQUUsTUFBTSxDQUFDLENBQUMsRUFBRTtRQUNoQixNQUFNLENBQUMsS0FBSyxFQUFFLEVBQUUsSUFBSSxDQUFDLEtBQUssQ0FBQyxFQUFFO1FBQzdCLE1BQU07SUFDUDtJQUdBLGlCQUFpQixDQUFDLEVBQUUsSUFBSSxFQUFFLENBQUMsUUFBUSxDQUFDLEVBQUUsSUFBSSxFQUFFLFNBQVMsQ0FBQyxDQUFDO0lBRXZELFlBQVksQ0FBQyxRQUFRLEVBQUUsTUFBTTtRQUM1QixDQUFDLElBQUksQ0FBQyxNQUFNO1FBQ1osQ0FBQyxLQUFLLENBQUMsSUFBSSxDQUFDO0FBQ2Q7QUFFQSxTQUFTLFlBQVksQ0FBQyxTQUFnQyxFQUFFLFFBQWdCLEVBQUUsRUFBVSxFQUFFO0lBQ3JGLE1BQU0sSUFBSSxFQUFFLFNBQVMsQ0FBQyxHQUFHLENBQUMsUUFBUSxDQUFDO0lBQ25DLEdBQUcsQ0FBQyxHQUFHLEVBQUU7UUFDUixHQUFHLENBQUMsSUFBSSxDQUFDLEVBQUUsQ0FBQztJQUNiO0lBQ0EsS0FBSztRQUNKLFNBQVMsQ0FBQyxHQUFHLENBQUMsUUFBUSxFQUFFLENBQUMsRUFBRSxDQUFDLENBQUM7SUFDOUI7QUFDRDtBQUlBLFNBQVMsbUJBQW1CLENBQUMsU0FBZ0MsRUFBRSxXQUFXLEVBQUUsS0FBSyxFQUFFO0lBQ2xGLEdBQUcsQ0FBQyxTQUFTLENBQUMsS0FBSyxDQUFDLENBQUMsRUFBRSxDQUFDLEVBQUUsRUFBRSxNQUFNLEVBQUU7SUFFcEMsSUFBSSxVQUFVLEVBQUUsS0FBSyxDQUFDLElBQUksQ0FBQyxTQUFTLENBQUMsSUFBSSxDQUFDLENBQUMsQ0FBQztJQUU1QyxJQUFJO1FBQ0gsVUFBVSxDQUFDLFNBQVMsRUFBRSxDQUFDLFFBQVEsRUFBRSxRQUFRLEVBQUUsT0FBTyxFQUFFLENBQUMsRUFBRTtZQUN0RCxPQUFPLENBQUMsU0FBUyxDQUFDLEdBQUcsQ0FBQyxRQUFRLENBQUUsRUFBRSxRQUFRLEVBQUUsUUFBUSxFQUFFLFdBQVcsRUFBRSxVQUFVLEVBQUUsT0FBTyxFQUFFLFVBQVUsQ0FBQztZQUVuRyxVQUFVLEVBQUUsU0FBUyxDQUFDLE1BQU0sQ0FBQyxNQUFNLENBQUMsRUFBRSxNQUFNLENBQUMsQ0FBQyxFQUFFLFFBQVEsQ0FBQztRQUMxRCxDQUFDLENBQUM7SUFDSDtJQUNBLE1BQU0sQ0FBQyxLQUFLLEVBQUU7UUFFYixNQUFNLFNBQW1CLEVBQUUsRUFBRSxNQUFNLEVBQUUsQ0FBQyxDQUFDLENBQUMsR0FBRyxDQUFDLEVBQUUsQ0FBQyxDQUFDLEtBQUssQ0FBQyxNQUFNLENBQUMsRUFBRSxLQUFLLENBQUMsQ0FBQyxFQUFFLENBQUM7UUFDekUsSUFBSSxDQUFDLE1BQU0sU0FBUyxHQUFHLFNBQVMsRUFBRTtZQUNqQyxhQUFhLENBQUMsU0FBUyxDQUFDLEdBQUcsQ0FBQyxRQUFRLENBQUUsRUFBRSxRQUFRLENBQUM7UUFDbEQ7SUFDRDtBQUNEO0FBRUEsU0FBUyxjQUFjLENBQUMsVUFBa0IsRUFBRTtJQUMzQyxNQUFNLFFBQVEsRUFBRSxJQUFJLENBQUMsS0FBSyxDQUFDLFVBQVUsQ0FBWTtJQUNqRCxNQUFNLFVBQVUsRUFBRSxJQUFJLEdBQXFCLENBQUMsQ0FBQztJQUM3QyxNQUFNLG9CQUFvQixFQUFFLElBQUksR0FBcUIsQ0FBQyxDQUFDO0lBRXZELEdBQUcsQ0FBQyxPQUFPLENBQUMsTUFBTSxFQUFFO1FBQ25CLE1BQU0sQ0FBQyxPQUFPLENBQUMsTUFBTSxDQUFDO0lBQ3ZCO0lBRUEsSUFBSSxDQUFDLE1BQU0sRUFBRSxFQUFFLEVBQUUsSUFBSSxFQUFFLGFBQWEsRUFBRSxXQUFXLEVBQUUsR0FBRyxPQUFPLENBQUMsS0FBSyxFQUFFO1FBSXBFLEdBQUcsQ0FBQyxVQUFVLEVBQUU7WUFDZixZQUFZLENBQUMsbUJBQW1CLEVBQUUsSUFBSSxFQUFFLEVBQUUsQ0FBQztZQUMzQyxRQUFRO1FBQ1Q7UUFFQSxHQUFHLENBQUMsYUFBYSxFQUFFO1lBQ2xCLElBQUksUUFBa0I7WUFDdEIsSUFBSTtnQkFDSCxTQUFTLEVBQUUsYUFBYSxDQUFDLElBQUksQ0FBQztZQUMvQjtZQUNBLE1BQU0sQ0FBQyxLQUFLLEVBQUU7Z0JBQ2IsU0FBUyxFQUFFLEVBQUUsTUFBTSxFQUFFLENBQUMsQ0FBQyxDQUFDLEdBQUcsQ0FBQyxFQUFFLENBQUMsQ0FBQyxLQUFLLENBQUMsTUFBTSxDQUFDLEVBQUUsS0FBSyxDQUFDLENBQUMsRUFBRSxDQUFDO1lBQzFEO1lBRUEsT0FBTyxDQUFDLEVBQUUsRUFBRSxJQUFJLEVBQUUsUUFBUSxDQUFDO1lBQzNCLFFBQVE7UUFDVDtRQUdBLGlCQUFpQixDQUFDLE1BQU0sQ0FBQyxJQUFJLENBQUM7UUFJOUIsTUFBTSxlQUFlLEVBQUUsa0JBQWtCLENBQUMsSUFBSSxDQUFDO1FBQy9DLEdBQUcsQ0FBQyxjQUFjLEVBQUU7WUFDbkIsYUFBYSxDQUFDLEVBQUUsRUFBRSxjQUFjLENBQUM7WUFDakMsUUFBUTtRQUNUO1FBRUEsWUFBWSxDQUFDLFNBQVMsRUFBRSxJQUFJLEVBQUUsRUFBRSxDQUFDO0lBQ2xDO0lBRUEsbUJBQW1CLENBQUMsU0FBUyxDQUFDO0lBQzlCLG1CQUFtQixDQUFDLG1CQUFtQixFQUFFLElBQUksQ0FBQztBQUMvQztBQUVBLElBQUksTUFBTSxFQUFFLE1BQU0sQ0FBQyxLQUFLLENBQUMsQ0FBQyxDQUFDO0FBRTNCLE9BQU8sQ0FBQyxLQUFLLENBQUMsRUFBRSxDQUFDLENBQUMsSUFBSSxDQUFDLEVBQUUsQ0FBQyxLQUFhLEVBQUUsQ0FBQyxFQUFFO0lBQzNDLE1BQU0sRUFBRSxNQUFNLENBQUMsTUFBTSxDQUFDLENBQUMsS0FBSyxFQUFFLEtBQUssQ0FBQyxDQUFDO0lBRXJDLElBQUksQ0FBQyxDQUFDLENBQUMsRUFBRTtRQUNSLE1BQU0sVUFBVSxFQUFFLEtBQUssQ0FBQyxPQUFPLENBQUMsQ0FBQyxDQUFDLENBQUMsQ0FBQyxDQUFDO1FBQ3JDLEdBQUcsQ0FBQyxVQUFVLENBQUMsQ0FBQyxFQUFFLENBQUMsQ0FBQyxFQUFFLEVBQUUsTUFBTSxFQUFFO1FBRWhDLE1BQU0sQ0FBQyxFQUFFLE1BQU0sRUFBRSxFQUFFLEtBQUssQ0FBQyxRQUFRLENBQUMsQ0FBQyxLQUFLLENBQUMsRUFBRSxDQUFDLEVBQUUsU0FBUyxDQUFDLENBQUMsSUFBSSxDQUFDLENBQUMsQ0FBQyxLQUFLLENBQUMsRUFBRSxDQUFDLENBQUMsQ0FBQyxHQUFHLENBQUMsTUFBTSxDQUFDO1FBQ3RGLE1BQU0sVUFBVSxFQUFFLFVBQVUsRUFBRSxDQUFDO1FBQy9CLE1BQU0sUUFBUSxFQUFFLFVBQVUsRUFBRSxNQUFNO1FBQ2xDLEdBQUcsQ0FBQyxLQUFLLENBQUMsT0FBTyxFQUFFLE9BQU8sRUFBRSxFQUFFLE1BQU0sRUFBRTtRQUV0QyxNQUFNLEtBQUssRUFBRSxLQUFLLENBQUMsUUFBUSxDQUFDLENBQUMsSUFBSSxDQUFDLEVBQUUsU0FBUyxFQUFFLE9BQU8sQ0FBQztRQUN2RCxNQUFNLEVBQUUsS0FBSyxDQUFDLEtBQUssQ0FBQyxPQUFPLENBQUM7UUFJNUIsY0FBYyxDQUFDLElBQUksQ0FBQztJQUNyQjtBQUNELENBQUMsQ0FBQyJ9
\ No newline at end of file
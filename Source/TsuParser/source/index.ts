@@ -1,6 +1,14 @@
 import 'source-map-support/register';
 
+import * as crypto from 'crypto';
+import * as fs from 'fs';
+import Module = require('module');
 import * as path from 'path';
+import * as rollup from 'rollup';
+import commonjs = require('rollup-plugin-commonjs');
+import json = require('rollup-plugin-json');
+import nodeResolve = require('rollup-plugin-node-resolve');
+import * as terser from 'terser';
 import * as ts from 'typescript';
 
 interface ParsedType {
@@ -18,19 +26,34 @@ interface ParsedFunction {
 	name: string;
 	parameters: ParsedParameter[];
 	returnTypes?: ParsedType[];
+	latent: boolean;
 	character: number;
 	line: number;
 }
 
-interface Request {
+interface RequestFile {
+	id: number;
 	file: string;
+	transpileOnly?: boolean;
+	production?: boolean;
+}
+
+interface Request {
+	files: RequestFile[];
+	warmUp?: string[];
 }
 
-interface ResponseSuccess {
+interface EmittedSource {
+	source?: string;
+	sourcePath?: string;
+	sourceHash?: string;
+	sourceMapPath?: string;
+}
+
+interface ResponseSuccess extends EmittedSource {
 	fileName: string;
 	name: string;
 	path: string;
-	source: string;
 	errors: string[];
 	exports: ParsedFunction[];
 	dependencies: string[];
@@ -42,24 +65,140 @@ interface ResponseFailure {
 
 type Response = ResponseSuccess | ResponseFailure;
 
+interface TypeCheckNotification {
+	kind: 'typeCheck';
+	file: string;
+	errors: string[];
+}
+
+interface WarmUpNotification {
+	kind: 'warmUp';
+	loaded: number;
+	total: number;
+}
+
+interface ProgressNotification {
+	kind: 'progress';
+	file: string;
+}
+
+type Notification = TypeCheckNotification | WarmUpNotification | ProgressNotification;
+
 interface ScriptVersion {
 	version: number;
 	modifiedTime: number;
 }
 
+interface CacheFile<T> {
+	optionsHash: string;
+	entries: { [filePath: string]: T };
+}
+
+interface CachedResolutions {
+	modifiedTime: number;
+	modules: { [moduleName: string]: ts.ResolvedModuleFull };
+}
+
+interface CachedResponse {
+	response: string;
+	sourcePath?: string;
+	bundled?: boolean;
+	fileHash: string;
+	dependencies: { [filePath: string]: string };
+	unresolved?: { [filePath: string]: string[] };
+}
+
+interface ImportedFiles {
+	fileNames: string[];
+	unresolved: string[];
+}
+
+interface DependencyFiles {
+	fileNames: string[];
+	unresolved: { [filePath: string]: string[] };
+}
+
+type EnumValues = Map<string, number | string>;
+
+// The const enums declared by a module, keyed by their name
+type ConstEnums = Map<string, EnumValues>;
+
+interface FileHash {
+	modifiedTime: number;
+	hash: string;
+}
+
+interface TsuOptions {
+	bundleNodeModules?: boolean;
+}
+
+interface InstalledPackage {
+	nodeModulesPath: string;
+	packagePath: string;
+}
+
+interface VendoredPackage {
+	specifier: string;
+	files: string[];
+}
+
+interface BundledSource {
+	source: string;
+	bundledFiles: string[];
+}
+
+interface FinishedResponse {
+	response: Response;
+	bundledFiles: string[];
+}
+
+interface SplitSource {
+	code: string;
+	map?: string;
+}
+
 if (process.argv.length < 3) {
 	throw new Error('No project directory specified');
 }
 
 const projectDirectory = path.resolve(process.argv[2]);
-const responseCache = new Map<string, string>();
+const cacheDirectory = process.argv.length > 3 ? path.resolve(process.argv[3]) : undefined;
+const pendingTypeChecks = new Set<string>();
 const scriptFileNames = new Array<string>();
 const scriptVersions = new Map<string, ScriptVersion>();
 const fileCache = new Map<string, ts.IScriptSnapshot>();
-const compilerOptions = findCompilerOptions();
+const fileHashes = new Map<string, FileHash>();
+const importedFiles = new WeakMap<ts.SourceFile, ImportedFiles>();
+const declaredConstEnums = new WeakMap<ts.SourceFile, Map<string, ConstEnums>>();
+const saveTimers = new Map<string, NodeJS.Timer>();
+const commonJSPackages = new Map<string, boolean>();
+const vendorWrites = new Map<string, Promise<void>>();
+
+// How long emitted sources that no cached response refers to are kept around, which leaves plenty of time for the
+// editor to load the sources of responses that aren't cached, like those of transpile-only and production requests
+const emitExpiryMs = 10 * 60 * 1000;
+const { compilerOptions, tsuOptions } = findOptions();
+const optionsHash = getOptionsHash();
+const moduleResolutionCache = ts.createModuleResolutionCache(projectDirectory, fileName => fileName.toLowerCase());
+
+// Whether scripts are emitted as ES modules, which the runtime loads natively when `bUseESModules` is enabled
+const emitsESModules = compilerOptions.module !== undefined && compilerOptions.module >= ts.ModuleKind.ES2015;
+
+// Module resolutions are kept on disk between sessions, since resolving the imports of all the typings and
+// node_modules involves probing the file system for every candidate path of every import
+const resolutionCache = loadCache<CachedResolutions>('resolutions.json');
+
+// Responses are kept on disk between sessions, keyed by the file they're for, and are reused for as long as the
+// contents of that file and every file it depends on stay the same
+const responseCache = loadCache<CachedResponse>('responses.json');
+
 const languageService = createLanguageService();
 
-function findCompilerOptions() {
+// Whether a class is, or derives from, UObject. Kept across requests, which works out since symbols are owned by the
+// source file that declares them, which in turn gets reused for as long as the file doesn't change.
+const uobjectSymbols = new WeakMap<ts.Symbol, boolean>();
+
+function findOptions() {
 	const configPath = ts.findConfigFile(projectDirectory, ts.sys.fileExists);
 	if (!configPath) {
 		throw new Error(`Failed to find tsconfig in: ${projectDirectory}`);
@@ -87,7 +226,10 @@ function findCompilerOptions() {
 		)).join('\n'));
 	}
 
-	return config.options;
+	// TSU's own options live next to the compiler options, under `tsu`
+	const tsuOptions: TsuOptions = configJson.config.tsu || {};
+
+	return { compilerOptions: config.options, tsuOptions: tsuOptions };
 }
 
 function formatDiagnostic(diagnostic: ts.Diagnostic) {
@@ -153,6 +295,9 @@ function createLanguageService() {
 
 			return snapshot;
 		},
+		resolveModuleNames: (moduleNames, containingFile) => (
+			moduleNames.map(moduleName => resolveModuleName(moduleName, containingFile))
+		),
 		getCurrentDirectory: () => projectDirectory,
 		getCompilationSettings: () => compilerOptions,
 		getDefaultLibFileName: ts.getDefaultLibFilePath,
@@ -162,6 +307,118 @@ function createLanguageService() {
 	}, ts.createDocumentRegistry());
 }
 
+function getOptionsHash() {
+	return crypto.createHash('sha1').update(JSON.stringify(compilerOptions)).digest('hex');
+}
+
+function loadCache<T>(fileName: string): CacheFile<T> {
+	const emptyCache: CacheFile<T> = { optionsHash: optionsHash, entries: {} };
+	if (!cacheDirectory) { return emptyCache; }
+
+	try {
+		const cacheFile = JSON.parse(
+			fs.readFileSync(path.join(cacheDirectory, fileName), 'utf8')
+		) as CacheFile<T>;
+
+		// Entries depend on things like `baseUrl` and `paths`, so start over if the options have changed
+		return (cacheFile.optionsHash === optionsHash && cacheFile.entries) ? cacheFile : emptyCache;
+	}
+	catch {
+		return emptyCache;
+	}
+}
+
+function saveCache<T>(fileName: string, cache: CacheFile<T>, onSaved?: (savedCache: CacheFile<T>) => void) {
+	if (!cacheDirectory || saveTimers.has(fileName)) { return; }
+
+	// Saved a little while after the last change, since changes tend to come in bursts
+	const saveTimer = setTimeout(() => {
+		saveTimers.delete(fileName);
+
+		try {
+			// Other parser processes share the same cache files, so keep whatever they've saved in the meantime
+			const savedCache = loadCache<T>(fileName);
+			const mergedCache: CacheFile<T> = {
+				optionsHash: optionsHash,
+				entries: { ...savedCache.entries, ...cache.entries }
+			};
+
+			fs.mkdirSync(cacheDirectory, { recursive: true });
+
+			// Written to a temporary file first, since other parser processes might be reading the cache
+			const cachePath = path.join(cacheDirectory, fileName);
+			const tempPath = `${cachePath}.${process.pid}.tmp`;
+			fs.writeFileSync(tempPath, JSON.stringify(mergedCache));
+			fs.renameSync(tempPath, cachePath);
+
+			if (onSaved) { onSaved(mergedCache); }
+		}
+		catch (error) {
+			process.stderr.write(`Failed to save ${fileName}: ${error}\n`);
+		}
+	}, 1000);
+
+	saveTimer.unref();
+	saveTimers.set(fileName, saveTimer);
+}
+
+function hashText(text: string) {
+	return crypto.createHash('sha1').update(text).digest('hex');
+}
+
+// Hashes the text of a file as the compiler reads it, so that it can be compared to the hash of a parsed source file
+function getFileHash(filePath: string) {
+	const modifiedTime = ts.sys.getModifiedTime!(filePath);
+	if (!modifiedTime) { return undefined; }
+
+	// Only rehash files whose modified time has changed
+	const cachedHash = fileHashes.get(filePath);
+	if (cachedHash && cachedHash.modifiedTime === modifiedTime.getTime()) {
+		return cachedHash.hash;
+	}
+
+	const content = ts.sys.readFile(filePath);
+	if (content === undefined) { return undefined; }
+
+	const hash = hashText(content);
+	fileHashes.set(filePath, { modifiedTime: modifiedTime.getTime(), hash: hash });
+
+	return hash;
+}
+
+function resolveModuleName(moduleName: string, containingFile: string): ts.ResolvedModuleFull | undefined {
+	const modifiedTime = ts.sys.getModifiedTime!(containingFile);
+	const fileTime = modifiedTime ? modifiedTime.getTime() : 0;
+
+	let cachedFile = resolutionCache.entries[containingFile];
+	if (cachedFile && cachedFile.modifiedTime === fileTime) {
+		const cachedModule = cachedFile.modules[moduleName];
+		if (cachedModule && ts.sys.fileExists(cachedModule.resolvedFileName)) {
+			return cachedModule;
+		}
+	}
+	else {
+		cachedFile = { modifiedTime: fileTime, modules: {} };
+		resolutionCache.entries[containingFile] = cachedFile;
+	}
+
+	const resolvedModule = ts.resolveModuleName(
+		moduleName,
+		containingFile,
+		compilerOptions,
+		ts.sys,
+		moduleResolutionCache
+	).resolvedModule;
+
+	// Failed resolutions aren't cached, since they can start succeeding without the containing file changing
+	if (resolvedModule) {
+		cachedFile.modules[moduleName] = resolvedModule;
+		saveCache('resolutions.json', resolutionCache);
+	}
+
+	return resolvedModule;
+}
+
 function getModifiedTime(filePath: string) {
 	const modifiedTime = ts.sys.getModifiedTime!(filePath);
 	if (!modifiedTime) {
@@ -171,7 +428,7 @@ function getModifiedTime(filePath: string) {
 	return modifiedTime.getTime();
 }
 
-function parseFile(filePath: string): Response {
+function updateScriptVersion(filePath: string) {
 	const modifiedTime = getModifiedTime(filePath);
 
 	let scriptVersion = scriptVersions.get(filePath);
@@ -188,11 +445,45 @@ function parseFile(filePath: string): Response {
 		scriptVersion.version += 1;
 	}
 
+	return { scriptVersion, modifiedTime };
+}
+
+// Parses multiple files out of the same program, so that the files they have in common only get checked once. The
+// program is passed along with the responses that came out of it, but not with those of files that failed to parse.
+function parseFiles(
+	filePaths: string[],
+	onResponse: (filePath: string, response: Response, program?: ts.Program) => void
+) {
+	const versions = filePaths.map(updateScriptVersion);
+
 	const program = languageService.getProgram();
 	if (program === undefined) {
 		throw new Error('Failed to get program');
 	}
 
+	filePaths.forEach((filePath, index) => {
+		const { scriptVersion, modifiedTime } = versions[index];
+
+		let response: Response;
+		try {
+			response = parseFile(program, filePath, scriptVersion, modifiedTime);
+		}
+		catch (error) {
+			// Respond rather than crash, so that the request doesn't have to time out
+			onResponse(filePath, { errors: [`[TSU]: ${error.stack || error}`] });
+			return;
+		}
+
+		onResponse(filePath, response, program);
+	});
+}
+
+function parseFile(
+	program: ts.Program,
+	filePath: string,
+	scriptVersion: ScriptVersion,
+	modifiedTime: number
+): Response {
 	const sourceFile = program.getSourceFile(filePath);
 	if (sourceFile === undefined) {
 		throw new Error(`Failed to get source file: ${filePath}`);
@@ -204,22 +495,13 @@ function parseFile(filePath: string): Response {
 		return { errors: errors };
 	}
 
-	const emitOutput = languageService.getEmitOutput(filePath);
-	if (emitOutput.emitSkipped) {
+	const source = emitFile(filePath);
+	if (source === undefined) {
 		throw new Error('Emit skipped');
 	}
 
-	const numOutput = emitOutput.outputFiles.length;
-	if (numOutput !== 1) {
-		throw new Error(`Unexpected number of output files: ${numOutput}`);
-	}
-
 	scriptVersion.modifiedTime = modifiedTime;
 
-	const output = emitOutput.outputFiles[0];
-	const sources = new Map<string, string>();
-	sources.set(filePath, output.text);
-
 	const fileExtension = path.parse(filePath).ext;
 	const fileName = path.basename(filePath);
 	const plainName = fileName.replace(fileExtension, '');
@@ -242,16 +524,647 @@ function parseFile(filePath: string): Response {
 	const dependencies = findDependencies(program, sourceFile);
 
 	return {
+		source: source,
 		fileName: fileName,
 		name: plainName,
 		path: filePath,
-		source: sources.get(filePath) || '',
 		errors: errors,
 		exports: functions,
 		dependencies: dependencies
 	};
 }
 
+// Emits a file out of the program of the language service, or returns undefined if the emit was skipped
+function emitFile(filePath: string) {
+	const emitOutput = languageService.getEmitOutput(filePath);
+	if (emitOutput.emitSkipped) { return undefined; }
+
+	const numOutput = emitOutput.outputFiles.length;
+	if (numOutput !== 1) {
+		throw new Error(`Unexpected number of output files: ${numOutput}`);
+	}
+
+	return emitOutput.outputFiles[0].text;
+}
+
+// The values of the members of an enum, as long as they're all literals, which is how the UE typings declare them
+function getEnumValues(declaration: ts.EnumDeclaration): EnumValues | undefined {
+	const values: EnumValues = new Map();
+
+	let nextValue = 0;
+	for (const member of declaration.members) {
+		if (!ts.isIdentifier(member.name) && !ts.isStringLiteral(member.name)) { return undefined; }
+
+		const initializer = member.initializer;
+
+		let value: number | string | undefined;
+		if (initializer === undefined) {
+			value = nextValue;
+		}
+		else if (ts.isNumericLiteral(initializer)) {
+			value = Number(initializer.text);
+		}
+		else if (ts.isStringLiteral(initializer)) {
+			value = initializer.text;
+		}
+		else if (
+			ts.isPrefixUnaryExpression(initializer) &&
+			initializer.operator === ts.SyntaxKind.MinusToken &&
+			ts.isNumericLiteral(initializer.operand)
+		) {
+			value = -Number(initializer.operand.text);
+		}
+
+		if (value === undefined) { return undefined; }
+
+		values.set(member.name.text, value);
+
+		if (typeof value === 'number') { nextValue = value + 1; }
+	}
+
+	return values;
+}
+
+// The const enums that a file declares, keyed by the module that declares them, which is either the file itself or
+// any ambient module declared within it, like those of bundled typings. Only needs the file to be parsed.
+function getDeclaredConstEnums(sourceFile: ts.SourceFile) {
+	const cachedEnums = declaredConstEnums.get(sourceFile);
+	if (cachedEnums) { return cachedEnums; }
+
+	const modules = new Map<string, ConstEnums>();
+
+	const addModule = (moduleName: string, statements: ReadonlyArray<ts.Statement>) => {
+		const enums: ConstEnums = new Map();
+
+		for (const statement of statements) {
+			if (!ts.isEnumDeclaration(statement) || !(ts.getCombinedModifierFlags(statement) & ts.ModifierFlags.Const)) {
+				continue;
+			}
+
+			const values = getEnumValues(statement);
+			if (values) { enums.set(statement.name.text, values); }
+		}
+
+		if (enums.size > 0) { modules.set(moduleName, enums); }
+	};
+
+	if (ts.isExternalModule(sourceFile)) {
+		addModule(sourceFile.fileName, sourceFile.statements);
+	}
+
+	for (const statement of sourceFile.statements) {
+		if (ts.isModuleDeclaration(statement) && ts.isStringLiteral(statement.name) &&
+			statement.body && ts.isModuleBlock(statement.body)) {
+			addModule(statement.name.text, statement.body.statements);
+		}
+	}
+
+	// Source files are reused for as long as they don't change, so this only needs doing once per version
+	declaredConstEnums.set(sourceFile, modules);
+
+	return modules;
+}
+
+// The values of the const enums that a file imports, keyed by the name they're imported as
+function findImportedConstEnums(program: ts.Program, sourceFile: ts.SourceFile, filePath: string) {
+	const modules = new Map<string, ConstEnums>();
+	for (const file of program.getSourceFiles()) {
+		getDeclaredConstEnums(file).forEach((enums, moduleName) => modules.set(moduleName, enums));
+	}
+
+	const importedEnums = new Map<string, EnumValues>();
+
+	for (const statement of sourceFile.statements) {
+		if (!ts.isImportDeclaration(statement) || !ts.isStringLiteral(statement.moduleSpecifier)) { continue; }
+
+		const importClause = statement.importClause;
+		const namedBindings = importClause && importClause.namedBindings;
+		if (!namedBindings || !ts.isNamedImports(namedBindings)) { continue; }
+
+		// Ambient modules don't resolve to a file, so they're looked up by their name instead
+		const moduleName = statement.moduleSpecifier.text;
+		const resolvedModule = resolveModuleName(moduleName, filePath);
+		const enums = modules.get(resolvedModule ? resolvedModule.resolvedFileName : moduleName);
+		if (!enums) { continue; }
+
+		for (const element of namedBindings.elements) {
+			const values = enums.get((element.propertyName || element.name).text);
+			if (values) { importedEnums.set(element.name.text, values); }
+		}
+	}
+
+	return importedEnums;
+}
+
+// Inlines the members of the const enums that a file imports, and removes the imports of them, like emitting out of
+// the program would, but without needing the type checker
+function inlineConstEnums(program: ts.Program, filePath: string): ts.TransformerFactory<ts.SourceFile> {
+	return context => sourceFile => {
+		const importedEnums = findImportedConstEnums(program, sourceFile, filePath);
+		if (importedEnums.size === 0) { return sourceFile; }
+
+		const visitImport = (node: ts.ImportDeclaration) => {
+			const importClause = node.importClause;
+			const namedBindings = importClause && importClause.namedBindings;
+			if (!importClause || !namedBindings || !ts.isNamedImports(namedBindings)) { return node; }
+
+			const elements = namedBindings.elements.filter(element => !importedEnums.has(element.name.text));
+			if (elements.length === namedBindings.elements.length) { return node; }
+			if (elements.length === 0 && !importClause.name) { return undefined; }
+
+			return ts.updateImportDeclaration(
+				node,
+				node.decorators,
+				node.modifiers,
+				ts.updateImportClause(
+					importClause,
+					importClause.name,
+					elements.length > 0 ? ts.updateNamedImports(namedBindings, elements) : undefined
+				),
+				node.moduleSpecifier
+			);
+		};
+
+		const findValue = (node: ts.Node) => {
+			let enumName: ts.Expression;
+			let memberName: string;
+
+			if (ts.isPropertyAccessExpression(node)) {
+				enumName = node.expression;
+				memberName = node.name.text;
+			}
+			else if (ts.isElementAccessExpression(node) && ts.isStringLiteral(node.argumentExpression)) {
+				enumName = node.expression;
+				memberName = node.argumentExpression.text;
+			}
+			else {
+				return undefined;
+			}
+
+			const values = ts.isIdentifier(enumName) ? importedEnums.get(enumName.text) : undefined;
+			return values && values.get(memberName);
+		};
+
+		const visit = (node: ts.Node): ts.VisitResult<ts.Node> => {
+			if (ts.isImportDeclaration(node)) { return visitImport(node); }
+
+			const value = findValue(node);
+			if (typeof value === 'number' && value < 0) {
+				return ts.createPrefix(ts.SyntaxKind.MinusToken, ts.createLiteral(-value));
+			}
+			else if (value !== undefined) {
+				return ts.createLiteral(value);
+			}
+
+			return ts.visitEachChild(node, visit, context);
+		};
+
+		return ts.visitEachChild(sourceFile, visit, context);
+	};
+}
+
+// Emits a file on its own, without type-checking it, for when only the emitted source is needed, like when hot
+// reloading. The type-checking is instead done in the background, with the results being sent once done. Emitting out
+// of the program would have the type checker check the whole file first, so the const enums that the file imports,
+// like those of the UE typings, are instead inlined by looking up their declarations in the parsed program.
+function transpileFile(filePath: string): Response {
+	updateScriptVersion(filePath);
+
+	const program = languageService.getProgram();
+	if (program === undefined) {
+		throw new Error('Failed to get program');
+	}
+
+	const sourceFile = program.getSourceFile(filePath);
+	if (sourceFile === undefined) {
+		throw new Error(`Failed to get source file: ${filePath}`);
+	}
+
+	const output = ts.transpileModule(sourceFile.text, {
+		compilerOptions: compilerOptions,
+		fileName: filePath,
+		reportDiagnostics: true,
+		transformers: { before: [inlineConstEnums(program, filePath)] }
+	});
+
+	const errors = (output.diagnostics || []).map(formatDiagnostic);
+	if (errors.length > 0) {
+		return { errors: errors };
+	}
+
+	const source = output.outputText;
+
+	pendingTypeChecks.add(filePath);
+	scheduleTypeCheck();
+
+	const fileExtension = path.parse(filePath).ext;
+	const fileName = path.basename(filePath);
+	const plainName = fileName.replace(fileExtension, '');
+
+	return {
+		source: source,
+		fileName: fileName,
+		name: plainName,
+		path: filePath,
+		errors: errors,
+		exports: [],
+		dependencies: []
+	};
+}
+
+function typeCheckFile(filePath: string): TypeCheckNotification {
+	updateScriptVersion(filePath);
+
+	const program = languageService.getProgram();
+	if (program === undefined) {
+		throw new Error('Failed to get program');
+	}
+
+	const sourceFile = program.getSourceFile(filePath);
+	if (sourceFile === undefined) {
+		throw new Error(`Failed to get source file: ${filePath}`);
+	}
+
+	const diagnostics = ts.getPreEmitDiagnostics(program, sourceFile);
+
+	return {
+		kind: 'typeCheck',
+		file: filePath,
+		errors: diagnostics.map(formatDiagnostic)
+	};
+}
+
+let typeCheckScheduled = false;
+
+// Type-checks one file per turn of the event loop, so that any new requests get handled in between
+function scheduleTypeCheck() {
+	if (typeCheckScheduled || pendingTypeChecks.size === 0) { return; }
+	typeCheckScheduled = true;
+
+	setImmediate(() => {
+		typeCheckScheduled = false;
+
+		const filePath: string = pendingTypeChecks.values().next().value;
+		pendingTypeChecks.delete(filePath);
+
+		let result: TypeCheckNotification;
+		try {
+			result = typeCheckFile(filePath);
+		}
+		catch (error) {
+			result = { kind: 'typeCheck', file: filePath, errors: [`[TSU]: ${error.stack || error}`] };
+		}
+
+		writeNotification(result);
+
+		scheduleTypeCheck();
+	});
+}
+
+// Loads files into the language service ahead of time, so that the first request doesn't have to pay for parsing and
+// binding them along with all the typings they depend on. The files are then checked one per turn of the event loop,
+// which gets the compiler itself warmed up, while still handling any new requests in between.
+function warmUp(filePaths: string[]) {
+	filePaths = filePaths.filter(filePath => {
+		try {
+			if (!scriptVersions.has(filePath)) { updateScriptVersion(filePath); }
+			return true;
+		}
+		catch {
+			return false;
+		}
+	});
+
+	let loaded = 0;
+	const total = filePaths.length;
+
+	const warmUpNext = () => {
+		try {
+			const program = languageService.getProgram();
+			const sourceFile = program && program.getSourceFile(filePaths[loaded]);
+			if (program && sourceFile) { program.getSemanticDiagnostics(sourceFile); }
+		}
+		catch {
+			// Any errors will be reported once the file is actually requested
+		}
+
+		loaded += 1;
+		writeNotification({ kind: 'warmUp', loaded: loaded, total: total });
+
+		if (loaded < total) { setImmediate(warmUpNext); }
+	};
+
+	writeNotification({ kind: 'warmUp', loaded: loaded, total: total });
+
+	if (total > 0) { setImmediate(warmUpNext); }
+}
+
+// Marks an emitted file as recently used, so that it isn't pruned right as the editor is about to load it
+function touchFile(filePath: string) {
+	const now = new Date();
+	try { fs.utimesSync(filePath, now, now); }
+	catch { /* Only matters for pruning */ }
+}
+
+// Writes emitted source to a file named after its hash, rather than inlining it in the response, so that the editor
+// only has to load it when it has actually changed. A source map that isn't inlined is written next to it.
+function writeSource(source: string, sourceMap?: string): EmittedSource {
+	if (!cacheDirectory) { return { source: source }; }
+
+	const sourceHash = crypto.createHash('sha1').update(source).digest('hex');
+	const emitDirectory = path.join(cacheDirectory, 'Emit');
+	const sourcePath = path.join(emitDirectory, `${sourceHash}.js`);
+
+	if (!fs.existsSync(sourcePath)) {
+		fs.mkdirSync(emitDirectory, { recursive: true });
+
+		// Written to a temporary file first, since other parser processes might emit the same source
+		const tempPath = `${sourcePath}.${process.pid}.tmp`;
+		fs.writeFileSync(tempPath, source, 'utf8');
+		fs.renameSync(tempPath, sourcePath);
+	}
+	else {
+		touchFile(sourcePath);
+	}
+
+	const sourceMapPath = sourceMap !== undefined ? `${sourcePath}.map` : undefined;
+	if (sourceMapPath && !fs.existsSync(sourceMapPath)) {
+		const tempPath = `${sourceMapPath}.${process.pid}.tmp`;
+		fs.writeFileSync(tempPath, sourceMap, 'utf8');
+		fs.renameSync(tempPath, sourceMapPath);
+	}
+	else if (sourceMapPath) {
+		touchFile(sourceMapPath);
+	}
+
+	return {
+		sourcePath: sourcePath,
+		sourceHash: sourceHash,
+		sourceMapPath: sourceMapPath
+	};
+}
+
+// Separates emitted source from its inline source map, if it has one
+function splitSourceMap(source: string): SplitSource {
+	const sourceMapPattern = /\n\/\/# sourceMappingURL=data:application\/json;base64,(\S*)\s*$/;
+	const match = sourceMapPattern.exec(source);
+	if (!match) { return { code: source }; }
+
+	return {
+		code: source.slice(0, match.index),
+		map: Buffer.from(match[1], 'base64').toString('utf8')
+	};
+}
+
+// Builds the source that gets cooked, where `__DEV__` is false, any code that's then unreachable is removed, logging
+// calls are dropped and the rest is minified. The source map is kept on the side rather than inlined.
+function minifySource(filePath: string, source: string): SplitSource {
+	const { code, map } = splitSourceMap(source);
+
+	const output = terser.minify(code, {
+		compress: {
+			global_defs: { __DEV__: false },
+			drop_console: true,
+			passes: 2
+		},
+		mangle: true,
+		sourceMap: map !== undefined ? { content: JSON.parse(map) } : false
+	});
+
+	if (output.error) {
+		throw new Error(`Failed to minify ${path.basename(filePath)}: ${output.error.message}`);
+	}
+
+	return {
+		code: output.code || '',
+		map: typeof output.map === 'string' ? output.map : undefined
+	};
+}
+
+// Where a package is installed, going by the `package.json` found from the importing file's directory
+function findPackage(moduleName: string, importer: string): InstalledPackage | undefined {
+	const segments = moduleName.split('/');
+	const packageName = moduleName.startsWith('@') ? segments.slice(0, 2).join('/') : segments[0];
+
+	for (let directory = path.dirname(importer); ; directory = path.dirname(directory)) {
+		const nodeModulesPath = path.join(directory, 'node_modules');
+		const packagePath = path.join(nodeModulesPath, packageName, 'package.json');
+		if (fs.existsSync(packagePath)) { return { nodeModulesPath: nodeModulesPath, packagePath: packagePath }; }
+
+		if (path.dirname(directory) === directory) { return undefined; }
+	}
+}
+
+// Whether a package only ships CommonJS
+function isCommonJSPackage(moduleName: string, importer: string) {
+	const installedPackage = findPackage(moduleName, importer);
+	if (!installedPackage) { return false; }
+
+	const { packagePath } = installedPackage;
+
+	const cachedResult = commonJSPackages.get(packagePath);
+	if (cachedResult !== undefined) { return cachedResult; }
+
+	let result = false;
+	try {
+		const packageJson = JSON.parse(fs.readFileSync(packagePath, 'utf8'));
+		result = !packageJson.module && !packageJson['jsnext:main'];
+	}
+	catch {
+		// Left to the bundler, which leaves anything it fails to load as an import
+	}
+
+	commonJSPackages.set(packagePath, result);
+	return result;
+}
+
+// Bundles a CommonJS package into a single file under `node_modules/.cache/tsu`, which scripts then require in place of
+// the package. The package is still loaded once and shared by every script, but as one file, rather than having each
+// of its files resolved and compiled at runtime. The file is named after what's imported and the installed version of
+// the package, so it only gets bundled again once the package changes.
+async function vendorPackage(moduleName: string, importer: string): Promise<VendoredPackage | undefined> {
+	const installedPackage = findPackage(moduleName, importer);
+	if (!installedPackage) { return undefined; }
+
+	const { nodeModulesPath, packagePath } = installedPackage;
+
+	let packageJson: string;
+	try { packageJson = fs.readFileSync(packagePath, 'utf8'); }
+	catch { return undefined; }
+
+	const vendorHash = hashText(`${moduleName}\n${packagePath}\n${packageJson}`);
+	const vendorDirectory = path.join(nodeModulesPath, '.cache', 'tsu');
+	const vendorPath = path.join(vendorDirectory, `${vendorHash}.js`);
+
+	let vendorWrite = vendorWrites.get(vendorPath);
+	if (!vendorWrite) {
+		vendorWrite = writeVendoredPackage(moduleName, importer, vendorPath);
+		vendorWrites.set(vendorPath, vendorWrite);
+		vendorWrite.catch(() => vendorWrites.delete(vendorPath));
+	}
+
+	try {
+		await vendorWrite;
+	}
+	catch {
+		// Left to be required as is, like it would have been without bundling
+		return undefined;
+	}
+
+	return {
+		// Resolves through `node_modules` like any other package, since it doesn't start with `./`
+		specifier: `.cache/tsu/${vendorHash}`,
+		files: [packagePath, vendorPath]
+	};
+}
+
+async function writeVendoredPackage(moduleName: string, importer: string, vendorPath: string) {
+	if (fs.existsSync(vendorPath)) { return; }
+
+	// The entry is named as a JavaScript file next to the importer, so that the package resolves the same way
+	const entryId = path.join(path.dirname(importer), '__tsuVendor.js');
+	const entryCode = `import vendored from ${JSON.stringify(moduleName)};\nexport default vendored;\n`;
+
+	const bundle = await rollup.rollup({
+		input: entryId,
+		external: id => Module.builtinModules.includes(id),
+		plugins: [
+			{
+				name: 'tsu-vendor',
+				resolveId: id => (id === entryId ? id : null),
+				load: id => (id === entryId ? entryCode : null)
+			},
+			nodeResolve(),
+			commonjs(),
+			json()
+		],
+		onwarn: () => undefined
+	});
+
+	// Exported as the package's own `module.exports`, so that requiring it works the same as requiring the package
+	const { output } = await bundle.generate({
+		format: 'cjs',
+		exports: 'default',
+		interop: false
+	});
+
+	const chunk = output[0] as rollup.OutputChunk;
+
+	fs.mkdirSync(path.dirname(vendorPath), { recursive: true });
+
+	// Written to a temporary file first, since other parser processes might vendor the same package
+	const tempPath = `${vendorPath}.${process.pid}.tmp`;
+	fs.writeFileSync(tempPath, chunk.code, 'utf8');
+	fs.renameSync(tempPath, vendorPath);
+}
+
+// The packages that emitted source imports, other than engine types
+function findBareRequires(source: string) {
+	const requirePattern = /(?:\brequire\(|\bimport\(|\bfrom\s*)(["'])([^"'.\/][^"']*)\1/g;
+	const bareRequires: string[] = [];
+	for (let match = requirePattern.exec(source); match; match = requirePattern.exec(source)) {
+		if (!match[2].startsWith('UE/')) { bareRequires.push(match[2]); }
+	}
+
+	return bareRequires;
+}
+
+// Inlines the node_modules that a module imports into its emitted source, so that the module loads as one unit rather
+// than having each of its packages resolved and compiled file by file at runtime. Only packages that ship ES modules
+// are inlined, and tree-shaken along the way. Packages that only ship CommonJS are vendored into a file of their own
+// instead, which is then required at runtime, where it's loaded once and shared by every script, rather than each
+// script getting its own copy of their state. Engine types, built-in modules and other scripts are left as imports.
+async function bundleSource(filePath: string, source: string): Promise<BundledSource> {
+	// The entry is named as a JavaScript file next to the script, so that packages resolve relative to the script
+	// and the CommonJS plugin picks the entry up
+	const entryId = filePath.replace(/\.tsx?$/, '.js');
+
+	// Keep the source map of the entry, so that it can be mapped all the way back to the script
+	const { code: entryCode, map: entryMap } = splitSourceMap(source);
+
+	const isBareModule = (id: string) => !id.startsWith('.') && !path.isAbsolute(id);
+
+	// The CommonJS packages that get vendored, along with the file that first imports them
+	const commonJSImports = new Map<string, string>();
+
+	const isCommonJSImport = (id: string, importer: string) => {
+		if (!isBareModule(id) || !isCommonJSPackage(id, importer)) { return false; }
+
+		if (!commonJSImports.has(id)) { commonJSImports.set(id, importer); }
+		return true;
+	};
+
+	const bundle = await rollup.rollup({
+		input: entryId,
+		external: (id, parentId) => (
+			id.startsWith('UE/') ||
+			Module.builtinModules.includes(id) ||
+			(parentId === entryId && !isBareModule(id)) ||
+			isCommonJSImport(id, parentId || entryId)
+		),
+		plugins: [
+			{
+				name: 'tsu-entry',
+				resolveId: id => (id === entryId ? id : null),
+				load: id => (id === entryId ? { code: entryCode, map: entryMap } : null)
+			},
+			nodeResolve(),
+			commonjs(),
+			json()
+		],
+		// Anything that fails to resolve is left as a require, which then fails at runtime like it would have anyway
+		onwarn: () => undefined
+	});
+
+	// Vendored packages end up in the emitted source by name, so they count as bundled files as well
+	const bundledFiles = bundle.watchFiles.filter(file => file !== entryId && path.isAbsolute(file));
+	const vendoredSpecifiers = new Map<string, string>();
+
+	for (const [id, importer] of commonJSImports) {
+		const vendoredPackage = await vendorPackage(id, importer);
+		if (vendoredPackage) {
+			vendoredSpecifiers.set(id, vendoredPackage.specifier);
+			bundledFiles.push(...vendoredPackage.files);
+		}
+	}
+
+	const { output } = await bundle.generate({
+		format: emitsESModules ? 'esm' : 'cjs',
+		interop: false,
+		paths: id => vendoredSpecifiers.get(id) || id,
+		sourcemap: entryMap !== undefined,
+		sourcemapFile: entryId
+	});
+
+	const chunk = output[0] as rollup.OutputChunk;
+	const bundledSource = chunk.map ? `${chunk.code}\n//# sourceMappingURL=${chunk.map.toUrl()}` : chunk.code;
+
+	return {
+		source: bundledSource,
+		bundledFiles: bundledFiles
+	};
+}
+
+// Moves the emitted source of a response out into a file, replacing it with its bundled source if it was bundled, and
+// then minifying it if it's a production build
+function finishResponse(response: Response, bundled?: BundledSource, production = false): FinishedResponse {
+	const { source, ...rest } = response as ResponseSuccess;
+	if (source === undefined) { return { response: response, bundledFiles: [] }; }
+
+	if (bundled === undefined) {
+		bundled = { source: source, bundledFiles: [] };
+	}
+
+	const emitted = production
+		? minifySource(rest.path, bundled.source)
+		: { code: bundled.source, map: undefined };
+
+	return {
+		response: { ...rest, ...writeSource(emitted.code, emitted.map) },
+		bundledFiles: bundled.bundledFiles
+	};
+}
+
 function isExported(node: ts.Node) {
 	const modifiers = node.modifiers;
 	return modifiers && modifiers.some(mod =>
@@ -273,8 +1186,16 @@ function parseFunction(
 	const typeChecker = program.getTypeChecker();
 
 	const signature = typeChecker.getSignatureFromDeclaration(declaration)!;
-	const returnType = typeChecker.getReturnTypeOfSignature(signature);
-	const returnTypeStr = typeChecker.typeToString(returnType);
+
+	// Async functions get exposed as latent functions, with the promised type as the return type
+	let returnType: ts.Type | undefined = typeChecker.getReturnTypeOfSignature(signature);
+	const latent = isPromiseType(returnType);
+	if (latent) {
+		const typeArguments = (returnType as ts.TypeReference).typeArguments;
+		returnType = typeArguments ? typeArguments[0] : undefined;
+	}
+
+	const returnTypeStr = returnType ? typeChecker.typeToString(returnType) : 'void';
 	const returnTypes = parseType(returnTypeStr);
 
 	const position = getPosition(declaration, sourceFile);
@@ -301,11 +1222,17 @@ function parseFunction(
 		name: declaration.name!.getText(),
 		parameters: parameters,
 		returnTypes: returnTypes,
+		latent: latent,
 		line: position.line,
 		character: position.character
 	};
 }
 
+function isPromiseType(type: ts.Type) {
+	const symbol = type.getSymbol();
+	return symbol !== undefined && symbol.getName() === 'Promise';
+}
+
 function parseParameter(
 	param: ts.ParameterDeclaration,
 	typeChecker: ts.TypeChecker
@@ -347,47 +1274,85 @@ function getPosition(node: ts.Node, sourceFile: ts.SourceFile) {
 	return pos;
 }
 
+function isUObject(symbol: ts.Symbol, typeChecker: ts.TypeChecker): boolean {
+	const cachedResult = uobjectSymbols.get(symbol);
+	if (cachedResult !== undefined) { return cachedResult; }
+
+	// Guards against circular base types while the base types are being visited
+	uobjectSymbols.set(symbol, false);
+
+	let result = (symbol.getName() === 'UObject');
+	if (!result && (symbol.flags & ts.SymbolFlags.Class)) {
+		const baseTypes = typeChecker.getDeclaredTypeOfSymbol(symbol).getBaseTypes() || [];
+		result = baseTypes.some(baseType => {
+			const baseSymbol = baseType.getSymbol();
+			return baseSymbol !== undefined && isUObject(baseSymbol, typeChecker);
+		});
+	}
+
+	uobjectSymbols.set(symbol, result);
+
+	return result;
+}
+
+// Finds the UObject types that a file refers to, either by importing them from the UE typings or by naming them in a
+// type annotation, without having to resolve the type of every node in the file
 function findDependencies(
 	program: ts.Program,
 	sourceFile: ts.SourceFile
 ) {
 	const typeChecker = program.getTypeChecker();
 
-	const isUObject = (type: ts.Type): boolean => {
-		const typeName = typeChecker.typeToString(type);
-		if (typeName === 'UObject') { return true; }
+	const dependencies = new Set<string>();
 
-		const baseTypes = type.getBaseTypes() || [];
-		return !!baseTypes.find(isUObject);
-	};
+	const addSymbol = (symbol: ts.Symbol | undefined) => {
+		if (symbol === undefined) { return; }
 
-	const dependencies = new Set<string>();
+		if (symbol.flags & ts.SymbolFlags.Alias) {
+			symbol = typeChecker.getAliasedSymbol(symbol);
+		}
 
-	const traverseTree = (node: ts.Node) => {
-		ts.forEachChild(node, traverseTree);
+		if (isUObject(symbol, typeChecker)) {
+			dependencies.add(symbol.getName());
+		}
+	};
 
-		let type;
-		try { type = typeChecker.getTypeAtLocation(node); }
-		catch { return; }
+	const addImport = (declaration: ts.ImportDeclaration) => {
+		const moduleName = (declaration.moduleSpecifier as ts.StringLiteral).text;
+		const importClause = declaration.importClause;
+		if (!moduleName.startsWith('UE/') || !importClause) { return; }
 
-		if (!type) { return; }
+		if (importClause.name) {
+			addSymbol(typeChecker.getSymbolAtLocation(importClause.name));
+		}
 
-		const flagName = (ts.TypeFlags[type.flags] || '');
-		const isLiteral = (flagName.search(/Literal/) !== -1);
-		const isCallable = !type.getCallSignatures().length;
-		const isValidNode = !isLiteral && isCallable;
+		const namedBindings = importClause.namedBindings;
+		if (!namedBindings) { return; }
 
-		if (!isValidNode) { return; }
+		if (ts.isNamespaceImport(namedBindings)) {
+			const moduleSymbol = typeChecker.getSymbolAtLocation(declaration.moduleSpecifier);
+			if (moduleSymbol) {
+				typeChecker.getExportsOfModule(moduleSymbol).forEach(addSymbol);
+			}
+		}
+		else {
+			for (const element of namedBindings.elements) {
+				addSymbol(typeChecker.getSymbolAtLocation(element.name));
+			}
+		}
+	};
 
-		const constructSignatures = type.getConstructSignatures();
-		if (constructSignatures.length) {
-			type = constructSignatures[0].getReturnType();
+	const traverseTree = (node: ts.Node) => {
+		if (ts.isImportDeclaration(node)) {
+			addImport(node);
+			return;
 		}
 
-		if (isUObject(type)) {
-			const typeName = typeChecker.typeToString(type);
-			dependencies.add(typeName);
+		if (ts.isTypeReferenceNode(node)) {
+			addSymbol(typeChecker.getSymbolAtLocation(node.typeName));
 		}
+
+		ts.forEachChild(node, traverseTree);
 	};
 
 	traverseTree(sourceFile);
@@ -395,53 +1360,336 @@ function findDependencies(
 	return Array.from(dependencies);
 }
 
-function writeResponse(response: Response | string) {
+// Messages in both directions are framed as a header line of `<id> <length>`, where the length is the number of
+// bytes of UTF-8 that follow, which lets requests be matched to responses regardless of how the pipes chunk them
+function writeMessage(id: number, message: string) {
+	const body = Buffer.from(message, 'utf8');
+	process.stdout.write(`${id} ${body.length}\n`);
+	process.stdout.write(body);
+}
+
+// Notifications aren't a response to any particular request, so they're sent with an ID of 0 instead
+function writeNotification(notification: Notification) {
+	writeMessage(0, JSON.stringify(notification));
+}
+
+function writeResponse(ids: number | number[], response: Response | string) {
 	if (typeof response !== 'string') {
-		response = JSON.stringify(response, null, '  ');
+		response = JSON.stringify(response);
 	}
 
-	process.stdout.write(response + '\n');
+	for (const id of Array.isArray(ids) ? ids : [ids]) {
+		writeMessage(id, response);
+	}
 
 	return response;
 }
 
-function processRequest(requestStr: string) {
-	const request = JSON.parse(requestStr) as Request;
+function getImportedFiles(sourceFile: ts.SourceFile): ImportedFiles {
+	const cachedFiles = importedFiles.get(sourceFile);
+	if (cachedFiles) { return cachedFiles; }
 
-	// Cache responses for a short period since Unreal compiles the source file
-	// multiple times when compiling the Blueprint
-	const cachedResponse = responseCache.get(request.file);
-	if (cachedResponse) { return writeResponse(cachedResponse); }
+	const fileInfo = ts.preProcessFile(sourceFile.text, true, true);
+	const directory = path.dirname(sourceFile.fileName);
 
-	const response = parseFile(request.file);
-	const responseStr = writeResponse(response);
+	const fileNames: string[] = [];
+	const unresolved: string[] = [];
 
-	responseCache.set(request.file, responseStr);
-	setTimeout(() => {
-		responseCache.delete(request.file);
-	}, 1000);
+	for (const ref of fileInfo.importedFiles) {
+		const resolvedModule = resolveModuleName(ref.fileName, sourceFile.fileName);
+		if (resolvedModule) {
+			fileNames.push(resolvedModule.resolvedFileName);
+		}
+		else {
+			unresolved.push(ref.fileName);
+		}
+	}
+
+	for (const ref of fileInfo.referencedFiles) {
+		fileNames.push(path.resolve(directory, ref.fileName));
+	}
+
+	const files = { fileNames: fileNames, unresolved: unresolved };
+
+	// Source files are reused for as long as they don't change, so this only needs doing once per version, unless
+	// something failed to resolve, which can start succeeding without the file changing, like when typings are written
+	if (unresolved.length === 0) {
+		importedFiles.set(sourceFile, files);
+	}
+
+	return files;
+}
+
+// The files that a file depends on, which are the files it imports, directly or indirectly, along with any global
+// declarations outside of the default library, like the typings of bundled modules. Any imports that failed to resolve
+// are returned as well, by the file importing them.
+function findDependencyFiles(program: ts.Program, sourceFile: ts.SourceFile): DependencyFiles {
+	const dependencies = new Set<string>();
+	const unresolved: { [filePath: string]: string[] } = {};
+
+	const visit = (file: ts.SourceFile) => {
+		const files = getImportedFiles(file);
+		if (files.unresolved.length > 0) {
+			unresolved[file.fileName] = files.unresolved;
+		}
+
+		for (const fileName of files.fileNames) {
+			if (dependencies.has(fileName)) { continue; }
+			dependencies.add(fileName);
+
+			const dependencyFile = program.getSourceFile(fileName);
+			if (dependencyFile) { visit(dependencyFile); }
+		}
+	};
+
+	visit(sourceFile);
+
+	for (const file of program.getSourceFiles()) {
+		if (!ts.isExternalModule(file) && !program.isSourceFileDefaultLibrary(file)) {
+			dependencies.add(file.fileName);
+		}
+	}
+
+	dependencies.delete(sourceFile.fileName);
+
+	return { fileNames: Array.from(dependencies), unresolved: unresolved };
+}
+
+function cacheResponse(
+	filePath: string,
+	response: Response,
+	responseStr: string,
+	program: ts.Program,
+	bundledFiles: string[]
+) {
+	const sourceFile = program.getSourceFile(filePath);
+	if (!sourceFile) { return; }
+
+	// Files are hashed as they were parsed, rather than as they are on disk by now, so that a response isn't stored
+	// under the hash of an edit that was made while it was being parsed
+	const fileHash = hashText(sourceFile.text);
+	const dependencyFiles = findDependencyFiles(program, sourceFile);
+
+	// Bundled packages end up in the emitted source, so they count as dependencies as well
+	const dependencies: { [filePath: string]: string } = {};
+	for (const dependency of [...dependencyFiles.fileNames, ...bundledFiles]) {
+		const dependencyFile = program.getSourceFile(dependency);
+		const dependencyHash = dependencyFile ? hashText(dependencyFile.text) : getFileHash(dependency);
+		if (!dependencyHash) { return; }
+		dependencies[dependency] = dependencyHash;
+	}
 
-	return responseStr;
+	responseCache.entries[filePath] = {
+		response: responseStr,
+		sourcePath: (response as ResponseSuccess).sourcePath,
+		bundled: tsuOptions.bundleNodeModules,
+		fileHash: fileHash,
+		dependencies: dependencies,
+		unresolved: dependencyFiles.unresolved
+	};
+
+	saveCache('responses.json', responseCache, pruneEmittedSources);
 }
 
-let input = '';
+// Removes the emitted sources, along with their source maps, that no cached response refers to anymore, once they
+// haven't been used for a while
+function pruneEmittedSources(cache: CacheFile<CachedResponse>) {
+	if (!cacheDirectory) { return; }
+
+	const referencedSources = new Set<string>();
+	for (const filePath of Object.keys(cache.entries)) {
+		const sourcePath = cache.entries[filePath].sourcePath;
+		if (sourcePath) { referencedSources.add(path.basename(sourcePath)); }
+	}
+
+	const emitDirectory = path.join(cacheDirectory, 'Emit');
+
+	let fileNames: string[];
+	try { fileNames = fs.readdirSync(emitDirectory); }
+	catch { return; }
+
+	const expiryTime = Date.now() - emitExpiryMs;
+
+	for (const fileName of fileNames) {
+		// Source maps and temporary files are named after the source they belong to
+		const extensionEnd = fileName.indexOf('.js');
+		const sourceName = extensionEnd !== -1 ? fileName.slice(0, extensionEnd + 3) : fileName;
+		if (referencedSources.has(sourceName)) { continue; }
 
-process.stdin.setEncoding('utf8');
-process.stdin.on('data', (chunk: string) => {
-	const lines = chunk.split(/\r?\n/);
-	if (lines.length <= 1) {
-		input += chunk;
+		const filePath = path.join(emitDirectory, fileName);
+		try {
+			if (fs.statSync(filePath).mtimeMs < expiryTime) { fs.unlinkSync(filePath); }
+		}
+		catch {
+			// Another parser process might have pruned it already
+		}
+	}
+}
+
+function findCachedResponse(filePath: string) {
+	const cachedResponse = responseCache.entries[filePath];
+	if (!cachedResponse || getFileHash(filePath) !== cachedResponse.fileHash) { return undefined; }
+	if (!!cachedResponse.bundled !== !!tsuOptions.bundleNodeModules) { return undefined; }
+
+	for (const dependency of Object.keys(cachedResponse.dependencies)) {
+		if (getFileHash(dependency) !== cachedResponse.dependencies[dependency]) { return undefined; }
+	}
+
+	// Imports that failed to resolve, like those of engine types without typings, make for a different response once
+	// they do resolve, without any of the files that were depended on having changed
+	const unresolved = cachedResponse.unresolved || {};
+	for (const containingFile of Object.keys(unresolved)) {
+		if (unresolved[containingFile].some(moduleName => resolveModuleName(moduleName, containingFile) !== undefined)) {
+			return undefined;
+		}
+	}
+
+	// The emitted source is kept in a separate file, which might have been cleaned out since
+	if (cachedResponse.sourcePath && !fs.existsSync(cachedResponse.sourcePath)) { return undefined; }
+
+	return cachedResponse.response;
+}
+
+// Writes the response once its source has been emitted. Responses are written right away, so that each file of a batch
+// gets its response as soon as it's parsed, except for those whose source imports packages that need bundling, which
+// only finishes once the batch is done. Successful responses that came with a program get cached as well, while
+// failures aren't, so that their errors always come from a fresh parse.
+function respond(
+	ids: number | number[],
+	filePath: string,
+	response: Response,
+	program?: ts.Program,
+	production = false
+) {
+	const finish = (bundled?: BundledSource) => {
+		const { response: finishedResponse, bundledFiles } = finishResponse(response, bundled, production);
+		const responseStr = writeResponse(ids, finishedResponse);
+
+		if (program && 'exports' in finishedResponse) {
+			cacheResponse(filePath, finishedResponse, responseStr, program, bundledFiles);
+		}
+	};
+
+	const fail = (error: any) => {
+		writeResponse(ids, { errors: [`[TSU]: ${error.stack || error}`] });
+	};
+
+	const { source } = response as ResponseSuccess;
+	if (source === undefined || !tsuOptions.bundleNodeModules || findBareRequires(source).length === 0) {
+		try { finish(); }
+		catch (error) { fail(error); }
 		return;
 	}
 
-	const lastLine = lines.splice(-1, 1)[0];
-	const firstLine = lines.splice(0, 1)[0];
+	// Counts as progress towards the request, which would otherwise time out if the rest of the batch takes long
+	writeNotification({ kind: 'progress', file: filePath });
 
-	processRequest(input + firstLine);
+	bundleSource(filePath, source)
+		.then(finish)
+		.catch(fail);
+}
 
-	for (const line of lines) {
-		processRequest(line);
+function addRequestId(idsByFile: Map<string, number[]>, filePath: string, id: number) {
+	const ids = idsByFile.get(filePath);
+	if (ids) {
+		ids.push(id);
 	}
+	else {
+		idsByFile.set(filePath, [id]);
+	}
+}
+
+// Parses the requested files out of the same program, responding to each file with every ID it was requested with.
+// Production builds are minified, so they're kept out of the response cache.
+function parseRequestedFiles(idsByFile: Map<string, number[]>, production = false) {
+	if (idsByFile.size === 0) { return; }
 
-	input = lastLine;
+	let filePaths = Array.from(idsByFile.keys());
+
+	try {
+		parseFiles(filePaths, (filePath, response, program) => {
+			respond(idsByFile.get(filePath)!, filePath, response, production ? undefined : program, production);
+
+			filePaths = filePaths.filter(other => other !== filePath);
+		});
+	}
+	catch (error) {
+		// Respond rather than crash, so that the remaining requests don't have to time out
+		const response: Response = { errors: [`[TSU]: ${error.stack || error}`] };
+		for (const filePath of filePaths) {
+			writeResponse(idsByFile.get(filePath)!, response);
+		}
+	}
+}
+
+function processRequest(requestStr: string) {
+	const request = JSON.parse(requestStr) as Request;
+	const idsByFile = new Map<string, number[]>();
+	const productionIdsByFile = new Map<string, number[]>();
+
+	if (request.warmUp) {
+		warmUp(request.warmUp);
+	}
+
+	for (const { id, file, transpileOnly, production } of request.files) {
+		// Production builds go through a full parse rather than being transpiled on their own, since inlining the
+		// const enums declared by the UE typings needs the rest of the program. They only happen when cooking files
+		// that have already been compiled, so the type-checking is of little extra cost.
+		if (production) {
+			addRequestId(productionIdsByFile, file, id);
+			continue;
+		}
+
+		if (transpileOnly) {
+			let response: Response;
+			try {
+				response = transpileFile(file);
+			}
+			catch (error) {
+				response = { errors: [`[TSU]: ${error.stack || error}`] };
+			}
+
+			respond(id, file, response);
+			continue;
+		}
+
+		// A full parse reports the same errors as the type-check would
+		pendingTypeChecks.delete(file);
+
+		// Unreal compiles the source file multiple times when compiling the Blueprint, and recompiles unchanged files
+		// on things like redundant reimports, so this tends to hit
+		const cachedResponse = findCachedResponse(file);
+		if (cachedResponse) {
+			writeResponse(id, cachedResponse);
+			continue;
+		}
+
+		addRequestId(idsByFile, file, id);
+	}
+
+	parseRequestedFiles(idsByFile);
+	parseRequestedFiles(productionIdsByFile, true);
+}
+
+let input = Buffer.alloc(0);
+
+process.stdin.on('data', (chunk: Buffer) => {
+	input = Buffer.concat([input, chunk]);
+
+	for (;;) {
+		const headerEnd = input.indexOf('\n');
+		if (headerEnd === -1) { return; }
+
+		const [, length] = input.toString('ascii', 0, headerEnd).trim().split(' ').map(Number);
+		const bodyStart = headerEnd + 1;
+		const bodyEnd = bodyStart + length;
+		if (input.length < bodyEnd) { return; }
+
+		const body = input.toString('utf8', bodyStart, bodyEnd);
+		input = input.slice(bodyEnd);
+
+		// Requests are answered with one message per file, using the IDs given for each file in the request, so the
+		// ID of the request message itself goes unused
+		processRequest(body);
+	}
 });
@@ -0,0 +1,19 @@
+// The Rollup plugins don't come with typings of their own, so these only cover what the parser makes use of
+
+declare module 'rollup-plugin-commonjs' {
+	import { Plugin } from 'rollup';
+	function commonjs(): Plugin;
+	export = commonjs;
+}
+
+declare module 'rollup-plugin-json' {
+	import { Plugin } from 'rollup';
+	function json(): Plugin;
+	export = json;
+}
+
+declare module 'rollup-plugin-node-resolve' {
+	import { Plugin } from 'rollup';
+	function nodeResolve(): Plugin;
+	export = nodeResolve;
+}
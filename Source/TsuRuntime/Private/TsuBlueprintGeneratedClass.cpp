@@ -8,7 +8,9 @@
 #include "TsuTypings.h"
 
 #include "Engine/Blueprint.h"
+#include "Engine/LatentActionManager.h"
 #include "Misc/ScopeExit.h"
+#include "Templates/UnrealTemplate.h"
 #include "UObject/Package.h"
 #include "UObject/UObjectGlobals.h"
 
@@ -18,6 +20,13 @@ const FName UTsuBlueprintGeneratedClass::MetaKeywords = TEXT("Keywords");
 const FName UTsuBlueprintGeneratedClass::MetaTooltip = TEXT("Tooltip");
 const FName UTsuBlueprintGeneratedClass::MetaDefaultToSelf = TEXT("DefaultToSelf");
 const FName UTsuBlueprintGeneratedClass::MetaAdvancedDisplay = TEXT("AdvancedDisplay");
+const FName UTsuBlueprintGeneratedClass::MetaLatent = TEXT("Latent");
+const FName UTsuBlueprintGeneratedClass::MetaLatentInfo = TEXT("LatentInfo");
+const FName UTsuBlueprintGeneratedClass::MetaWorldContext = TEXT("WorldContext");
+
+#if WITH_EDITOR
+FTsuBuildCookedSource UTsuBlueprintGeneratedClass::BuildCookedSource;
+#endif // WITH_EDITOR
 
 namespace TsuBlueprintGeneratedClass_Private
 {
@@ -93,7 +102,7 @@ void UTsuBlueprintGeneratedClass::Bind()
 {
 	Super::Bind();
 
-	if (Exports.IsValid())
+	if (HasValidExports())
 	{
 		// #todo(#mihe): Find a more appropriate place for this
 		TailoredName = FTsuTypings::TailorNameOfType(this);
@@ -103,16 +112,57 @@ void UTsuBlueprintGeneratedClass::Bind()
 	}
 }
 
+void UTsuBlueprintGeneratedClass::Serialize(FArchive& Ar)
+{
+#if WITH_EDITOR
+	// Cooked builds get the production build of the source, which is only swapped in for as long as it's being saved
+	FString CookedSource;
+	if (Ar.IsSaving() && Ar.IsCooking() && BuildCookedSource.IsBound() && BuildCookedSource.Execute(this, CookedSource))
+	{
+		TGuardValue<FString> SourceGuard{Exports.Source, MoveTemp(CookedSource)};
+		Super::Serialize(Ar);
+		return;
+	}
+#endif // WITH_EDITOR
+
+	Super::Serialize(Ar);
+}
+
 TSharedPtr<FTsuModule> UTsuBlueprintGeneratedClass::PinModule()
 {
 	if (auto PinnedModule = Module.Pin())
 		return PinnedModule;
 
 	UE_LOG(LogTsuRuntime, Log, TEXT("Loading module for class '%s'..."), *TailoredName);
-	Module = FTsuContext::Get().ClaimModule(*TailoredName, *Exports.Source, *Exports.Path);
+
+	Module = FTsuContext::Get().ClaimModule(*TailoredName, GetSharedSource(), *Exports.Path);
 	return Module.Pin();
 }
 
+TSharedRef<const FString> UTsuBlueprintGeneratedClass::GetSharedSource()
+{
+#if WITH_EDITOR
+	// The exports are replaced whenever the script is recompiled, and are needed again when saving
+	if (!SharedSource.IsValid() || !SharedSource->Equals(Exports.Source, ESearchCase::CaseSensitive))
+		SharedSource = MakeShared<const FString>(Exports.Source);
+#else // WITH_EDITOR
+	// Nothing reads the exported source once the module is loaded, so the buffer is handed over instead of copied,
+	// which leaves `Exports` without a source, see `HasValidExports`
+	if (!SharedSource.IsValid())
+		SharedSource = MakeShared<const FString>(MoveTemp(Exports.Source));
+#endif // WITH_EDITOR
+
+	return SharedSource.ToSharedRef();
+}
+
+bool UTsuBlueprintGeneratedClass::HasValidExports() const
+{
+	if (Exports.IsValid())
+		return true;
+
+	return Exports.Source.IsEmpty() && SharedSource.IsValid() && SharedSource->Len() > 0 && Exports.Exports.Num() > 0;
+}
+
 void UTsuBlueprintGeneratedClass::LoadModule()
 {
 	PinModule();
@@ -185,12 +235,25 @@ void UTsuBlueprintGeneratedClass::BindFunction(const FTsuParsedFunction& Export)
 					ReturnType.Name,
 					ReturnType.Dimensions))
 			{
-				ReturnParam->SetPropertyFlags(CPF_ReturnParm);
+				// Latent functions can't have return values, so the resolved value of the promise is passed
+				// through an output parameter instead
+				ReturnParam->SetPropertyFlags(Export.Latent ? CPF_OutParm : CPF_ReturnParm);
 				TsuBlueprintGeneratedClass_Private::LinkChild(Function, ReturnParam);
 			}
 		}
 	}
 
+	static const FName LatentInfoName = TEXT("LatentInfo");
+	static const FName WorldContextName = TEXT("WorldContextObject");
+
+	if (Export.Latent)
+	{
+		auto LatentInfoParam = NewObject<UStructProperty>(Function, LatentInfoName, RF_Public);
+		LatentInfoParam->Struct = FLatentActionInfo::StaticStruct();
+		LatentInfoParam->SetPropertyFlags(CPF_Parm);
+		TsuBlueprintGeneratedClass_Private::LinkChild(Function, LatentInfoParam);
+	}
+
 	auto Settings = GetDefault<UTsuRuntimeSettings>();
 
 	for (int32 Index = Export.Parameters.Num() - 1; Index >= 0; --Index)
@@ -227,8 +290,26 @@ void UTsuBlueprintGeneratedClass::BindFunction(const FTsuParsedFunction& Export)
 		}
 	}
 
+	if (Export.Latent)
+	{
+		auto WorldContextParam = NewObject<UObjectProperty>(Function, WorldContextName, RF_Public);
+		WorldContextParam->SetPropertyClass(UObject::StaticClass());
+		WorldContextParam->SetPropertyFlags(CPF_Parm);
+		TsuBlueprintGeneratedClass_Private::LinkChild(Function, WorldContextParam);
+
+#if WITH_EDITOR
+		Function->SetMetaData(MetaLatent, TEXT(""));
+		Function->SetMetaData(MetaLatentInfo, *LatentInfoName.ToString());
+		Function->SetMetaData(MetaWorldContext, *WorldContextName.ToString());
+#endif // WITH_EDITOR
+	}
+
+	const FNativeFuncPtr NativeFunction = Export.Latent
+		? static_cast<FNativeFuncPtr>(&UTsuBlueprintGeneratedClass::ExecInvokeLatent)
+		: static_cast<FNativeFuncPtr>(&UTsuBlueprintGeneratedClass::ExecInvoke);
+
 	AddFunctionToFunctionMap(Function, FunctionFName);
-	AddNativeFunction(*FunctionName, static_cast<FNativeFuncPtr>(&UTsuBlueprintGeneratedClass::ExecInvoke));
+	AddNativeFunction(*FunctionName, NativeFunction);
 	TsuBlueprintGeneratedClass_Private::LinkChild(this, Function);
 
 	Function->Bind();
@@ -246,6 +327,15 @@ void UTsuBlueprintGeneratedClass::ExecInvoke(UObject* /*Context*/, FFrame& Stack
 	This->PinModule()->Invoke(Stack, RESULT_PARAM);
 }
 
+void UTsuBlueprintGeneratedClass::ExecInvokeLatent(UObject* /*Context*/, FFrame& Stack, RESULT_DECL)
+{
+	ON_SCOPE_EXIT { P_FINISH; };
+
+	auto Outer = Stack.CurrentNativeFunction->GetOuterUClass();
+	auto This = static_cast<UTsuBlueprintGeneratedClass*>(Outer);
+	This->PinModule()->InvokeLatent(Stack);
+}
+
 UProperty* UTsuBlueprintGeneratedClass::NewParameterFromType(
 	UObject* Outer,
 	FName ParameterName,
@@ -1,20 +1,22 @@
 #include "TsuContext.h"
 
+#include "TsuBlueprintGeneratedClass.h"
 #include "TsuDelegateEvent.h"
 #include "TsuIsolate.h"
+#include "TsuLatentAction.h"
 #include "TsuPaths.h"
 #include "TsuReflection.h"
+#include "TsuResolutionCache.h"
 #include "TsuRuntimeLog.h"
 #include "TsuRuntimeSettings.h"
 #include "TsuStringConv.h"
+#include "TsuTrampolines.h"
 #include "TsuTryCatch.h"
 #include "TsuTypings.h"
 #include "TsuUtilities.h"
 #include "TsuWorldContextScope.h"
 
 #include "Engine/Engine.h"
-#include "HAL/PlatformFile.h"
-#include "HAL/PlatformFilemanager.h"
 #include "Kismet/GameplayStatics.h"
 #include "Misc/DefaultValueHelper.h"
 #include "Misc/FileHelper.h"
@@ -23,6 +25,7 @@
 #include "TimerManager.h"
 #include "UObject/PropertyPortFlags.h"
 #include "UObject/TextProperty.h"
+#include "UObject/UObjectIterator.h"
 
 #if WITH_EDITOR
 #include "Editor.h"
@@ -47,6 +50,96 @@ v8::Global<v8::Function> FTsuContext::GlobalStructHandlerConstructor;
 
 #define ensureV8(InExpression) FTsuContext::EnsureV8(ensure(InExpression), TEXT(#InExpression))
 
+namespace TsuContext_Private
+{
+
+bool CanInvokeDirectly(UFunction* Method)
+{
+	// Networked functions need to go through the callspace checks, and events might be overridden
+	return Method->HasAnyFunctionFlags(FUNC_Native)
+		&& !Method->HasAnyFunctionFlags(FUNC_Net | FUNC_BlueprintEvent)
+		&& Method->GetNativeFunc() != nullptr;
+}
+
+void InvokeDirectly(UObject* Object, UFunction* Method, void* ParamsBuffer)
+{
+	// Mirrors what UObject::ProcessEvent does for native functions, minus the copying of the parameters into a
+	// separate frame, since native thunks only ever read from and write to the parameters themselves
+
+	FFrame Stack{Object, Method, ParamsBuffer, nullptr, Method->Children};
+
+	if (Method->HasAnyFunctionFlags(FUNC_HasOutParms))
+	{
+		FOutParmRec** LastOut = &Stack.OutParms;
+
+		for (UProperty* Param : FParamRange(Method))
+		{
+			if (!Param->HasAnyPropertyFlags(CPF_OutParm))
+				continue;
+
+			auto Out = (FOutParmRec*)FMemory_Alloca(sizeof(FOutParmRec));
+			Out->PropAddr = Param->ContainerPtrToValuePtr<uint8>(ParamsBuffer);
+			Out->Property = Param;
+			Out->NextOutParm = nullptr;
+
+			*LastOut = Out;
+			LastOut = &Out->NextOutParm;
+		}
+	}
+
+	uint8* ReturnValueAddress = Method->ReturnValueOffset != MAX_uint16
+		? (uint8*)ParamsBuffer + Method->ReturnValueOffset
+		: nullptr;
+
+	Method->Invoke(Object, Stack, ReturnValueAddress);
+}
+
+/** Whether a property name can be declared as a named export of a generated module */
+bool IsExportableName(const FString& Name)
+{
+	static const TCHAR* ReservedWords[] = {
+		TEXT("await"), TEXT("break"), TEXT("case"), TEXT("catch"), TEXT("class"), TEXT("const"), TEXT("continue"),
+		TEXT("debugger"), TEXT("default"), TEXT("delete"), TEXT("do"), TEXT("else"), TEXT("enum"), TEXT("export"),
+		TEXT("extends"), TEXT("false"), TEXT("finally"), TEXT("for"), TEXT("function"), TEXT("if"),
+		TEXT("implements"), TEXT("import"), TEXT("in"), TEXT("instanceof"), TEXT("interface"), TEXT("let"),
+		TEXT("new"), TEXT("null"), TEXT("package"), TEXT("private"), TEXT("protected"), TEXT("public"),
+		TEXT("return"), TEXT("static"), TEXT("super"), TEXT("switch"), TEXT("this"), TEXT("throw"), TEXT("true"),
+		TEXT("try"), TEXT("typeof"), TEXT("var"), TEXT("void"), TEXT("while"), TEXT("with"), TEXT("yield")};
+
+	if (Name.IsEmpty())
+		return false;
+
+	for (const TCHAR* ReservedWord : ReservedWords)
+	{
+		if (Name.Equals(ReservedWord, ESearchCase::CaseSensitive))
+			return false;
+	}
+
+	for (int32 Index = 0; Index < Name.Len(); ++Index)
+	{
+		const TCHAR Char = Name[Index];
+		const bool bIsValid = FChar::IsAlpha(Char)
+			|| Char == TEXT('_')
+			|| Char == TEXT('$')
+			|| (Index > 0 && FChar::IsDigit(Char));
+
+		if (!bIsValid)
+			return false;
+	}
+
+	return true;
+}
+
+/** Gets the name of a module in call stacks, which is its path relative to the scripts directory */
+FString GetModuleOriginName(const FString& FullPath)
+{
+	FString OriginName = FullPath;
+	FPaths::MakePathRelativeTo(OriginName, *FPaths::ConvertRelativePathToFull(FTsuPaths::ScriptsSourceDir()));
+	return OriginName;
+}
+
+} // namespace TsuContext_Private
+
 FTsuContext::FTsuContext()
 {
 	Isolate = FTsuIsolate::Get();
@@ -70,8 +163,12 @@ FTsuContext::FTsuContext()
 	InitializeArrayProxy();
 	InitializeStructProxy();
 	InitializeKeys();
+	InitializeTickManager();
 
+	TaskQueue.Emplace(*this);
 	Inspector.Emplace(FTsuIsolate::GetPlatform(), Context);
+
+	Isolate->SetHostImportModuleDynamicallyCallback(&FTsuContext::OnImportModuleDynamically);
 }
 
 FTsuContext::~FTsuContext()
@@ -79,6 +176,12 @@ FTsuContext::~FTsuContext()
 	FCoreUObjectDelegates::GetPostGarbageCollect().RemoveAll(this);
 	FCoreUObjectDelegates::GetPreGarbageCollectDelegate().RemoveAll(this);
 
+	for (auto& PendingImport : PendingImports)
+	{
+		if (PendingImport.Value.Handle.IsValid())
+			PendingImport.Value.Handle->CancelHandle();
+	}
+
 	for (auto& Struct : AliveStructs)
 	{
 		FStructKey& Key = Struct.Key;
@@ -121,7 +224,12 @@ bool FTsuContext::Exists()
 	return Singleton.IsSet();
 }
 
-v8::MaybeLocal<v8::Value> FTsuContext::EvalModule(const TCHAR* Code, const TCHAR* Path)
+void FTsuContext::InvalidateResolutions()
+{
+	FTsuResolutionCache::Get().Invalidate();
+}
+
+v8::MaybeLocal<v8::Value> FTsuContext::EvalModule(const FTsuSharedString& Code, const TCHAR* Path)
 {
 	v8::Local<v8::Context> Context = GlobalContext.Get(Isolate);
 
@@ -129,34 +237,43 @@ v8::MaybeLocal<v8::Value> FTsuContext::EvalModule(const TCHAR* Code, const TCHAR
 	if (!ensure(FPaths::MakePathRelativeTo(ModulePath, *FTsuPaths::ScriptsSourceDir())))
 		return {};
 
-	// clang-format off
-	const FString WrappedCode = FString::Printf(
-		TEXT("(function(__filename, __dirname) {")
-		TEXT("const module = { exports: {} };")
-		TEXT("const exports = module.exports;")
-		TEXT("%s;\n")
-		TEXT("return module.exports;\n")
-		TEXT("})('%s', '%s')"),
-		Code,
-		*ModulePath,
-		*FPaths::GetPath(ModulePath));
-	// clang-format on
-
 	v8::ScriptOrigin Origin{TCHAR_TO_V8(ModulePath)};
-	v8::MaybeLocal<v8::Script> MaybeScript = v8::Script::Compile(
-		Context,
-		TCHAR_TO_V8(WrappedCode),
-		&Origin);
+	v8::ScriptCompiler::Source Source{FTsuStringConv::ToExternal(Code), Origin};
+
+	v8::Local<v8::String> Parameters[] = {u"exports"_v8, u"module"_v8, u"__filename"_v8, u"__dirname"_v8};
 
-	v8::Local<v8::Script> Script;
-	if (!ensure(MaybeScript.ToLocal(&Script)))
+	v8::MaybeLocal<v8::Function> MaybeFunction = v8::ScriptCompiler::CompileFunctionInContext(
+		Context,
+		&Source,
+		ARRAY_COUNT(Parameters),
+		Parameters,
+		0,
+		nullptr);
+
+	v8::Local<v8::Function> Function;
+	if (!ensure(MaybeFunction.ToLocal(&Function)))
 		return {};
 
+	v8::Local<v8::Object> Exports = v8::Object::New(Isolate);
+	v8::Local<v8::Object> Module = v8::Object::New(Isolate);
+	Module->Set(Context, u"exports"_v8, Exports).Check();
+
+	v8::Local<v8::Value> Arguments[] = {
+		Exports,
+		Module,
+		TCHAR_TO_V8(ModulePath),
+		TCHAR_TO_V8(FPaths::GetPath(ModulePath))};
+
 	FTsuTryCatch Catcher{Isolate};
-	return Script->Run(Context);
+
+	if (Function->Call(Context, v8::Undefined(Isolate), ARRAY_COUNT(Arguments), Arguments).IsEmpty())
+		return {};
+
+	// Read back rather than returned from the function, since the module might have replaced its exports
+	return Module->Get(Context, u"exports"_v8);
 }
 
-bool FTsuContext::BindModule(const TCHAR* Binding, const TCHAR* Code, const TCHAR* Path)
+bool FTsuContext::BindModule(const TCHAR* Binding, const FTsuSharedString& Code, const TCHAR* Path)
 {
 	v8::Local<v8::Context> Context = GlobalContext.Get(Isolate);
 	v8::Local<v8::Object> Global = Context->Global();
@@ -166,16 +283,297 @@ bool FTsuContext::BindModule(const TCHAR* Binding, const TCHAR* Code, const TCHA
 	return Global->Set(Context, TCHAR_TO_V8(Binding), Module).ToChecked();
 }
 
-TWeakPtr<FTsuModule> FTsuContext::ClaimModule(const TCHAR* Binding, const TCHAR* Code, const TCHAR* Path)
+TWeakPtr<FTsuModule> FTsuContext::ClaimModule(const TCHAR* Binding, const FTsuSharedString& Code, const TCHAR* Path)
 {
 	v8::HandleScope HandleScope{Isolate};
 
-	if (!ensure(BindModule(Binding, Code, Path)))
+	const bool bBound = GetDefault<UTsuRuntimeSettings>()->bUseESModules
+		? BindESModule(Binding, Code, Path)
+		: BindModule(Binding, Code, Path);
+
+	if (!ensure(bBound))
 		return {};
 
 	return LoadedModules.Add(Binding, MakeShared<FTsuModule>(Binding));
 }
 
+v8::MaybeLocal<v8::Value> FTsuContext::EvalESModule(const FTsuSharedString& Code, const TCHAR* Path)
+{
+	using namespace TsuContext_Private;
+
+	const FString FullPath = FPaths::ConvertRelativePathToFull(Path);
+
+	FTsuTryCatch Catcher{Isolate};
+
+	v8::Local<v8::Module> Module;
+	if (!CompileESModule(Code, FullPath, GetModuleOriginName(FullPath)).ToLocal(&Module))
+		return {};
+
+	if (!EvaluateESModule(Module))
+		return {};
+
+	return Module->GetModuleNamespace();
+}
+
+bool FTsuContext::BindESModule(const TCHAR* Binding, const FTsuSharedString& Code, const TCHAR* Path)
+{
+	v8::Local<v8::Context> Context = GlobalContext.Get(Isolate);
+	v8::Local<v8::Object> Global = Context->Global();
+
+	v8::Local<v8::Value> Namespace;
+	if (!EvalESModule(Code, Path).ToLocal(&Namespace))
+		return false;
+
+	return Global->Set(Context, TCHAR_TO_V8(Binding), Namespace).ToChecked();
+}
+
+v8::MaybeLocal<v8::Module> FTsuContext::CompileESModule(
+	const FTsuSharedString& Code,
+	const FString& Key,
+	const FString& OriginName)
+{
+	const uint32 SourceHash = TsuHash(**Code);
+
+	if (FESModule* CachedModule = ESModules.Find(Key))
+	{
+		v8::Local<v8::Module> Module = CachedModule->Module.Get(Isolate);
+		if (CachedModule->SourceHash == SourceHash)
+			return Module;
+
+		// Modules that have already imported the old module keep referring to it until they're compiled again
+		ESModuleKeys.RemoveSingle(Module->GetIdentityHash(), Key);
+		ESModules.Remove(Key);
+	}
+
+	// clang-format off
+	v8::ScriptOrigin Origin{
+		TCHAR_TO_V8(OriginName),
+		v8::Local<v8::Integer>(), // resource_line_offset
+		v8::Local<v8::Integer>(), // resource_column_offset
+		v8::Local<v8::Boolean>(), // resource_is_shared_cross_origin
+		v8::Local<v8::Integer>(), // script_id
+		v8::Local<v8::Value>(), // source_map_url
+		v8::Local<v8::Boolean>(), // resource_is_opaque
+		v8::False(Isolate), // is_wasm
+		v8::True(Isolate)}; // is_module
+	// clang-format on
+
+	v8::ScriptCompiler::Source Source{FTsuStringConv::ToExternal(Code), Origin};
+
+	v8::Local<v8::Module> Module;
+	if (!v8::ScriptCompiler::CompileModule(Isolate, &Source).ToLocal(&Module))
+		return {};
+
+	FESModule& NewModule = ESModules.Add(Key);
+	NewModule.Module.Reset(Isolate, Module);
+	NewModule.SourceHash = SourceHash;
+
+	ESModuleKeys.Add(Module->GetIdentityHash(), Key);
+
+	return Module;
+}
+
+v8::MaybeLocal<v8::Module> FTsuContext::ResolveESModule(const FString& Specifier, const FString& ReferrerKey)
+{
+	using namespace TsuContext_Private;
+
+	if (Specifier.StartsWith(TEXT("UE/")))
+	{
+		const FString TypeName = Specifier.RightChop(3);
+		FString Code = FString::Printf(TEXT("export const %s = __import('%s');\n"), *TypeName, *TypeName);
+		return CompileESModule(MakeShared<const FString>(MoveTemp(Code)), Specifier, Specifier);
+	}
+
+	if (Specifier.StartsWith(TEXT("./")) || Specifier.StartsWith(TEXT("../")))
+	{
+		FString BasePath = FPaths::GetPath(ReferrerKey) / Specifier;
+		FPaths::CollapseRelativeDirectories(BasePath);
+
+		const FString Candidates[] = {BasePath, BasePath + TEXT(".js"), BasePath / TEXT("index.js")};
+
+		for (const FString& Candidate : Candidates)
+		{
+			if (const FESModule* CachedModule = ESModules.Find(Candidate))
+				return CachedModule->Module.Get(Isolate);
+		}
+
+		// Scripts that haven't been imported yet might still be loaded as blueprints, in which case their parsed
+		// source is the one to use, since the scripts directory only holds their TypeScript source. The source is
+		// shared with the module of the class rather than copied, and might already have been handed over to it.
+		for (TObjectIterator<UTsuBlueprintGeneratedClass> It; It; ++It)
+		{
+			const FString ClassPath = FPaths::ConvertRelativePathToFull(It->Exports.Path);
+
+			for (const FString& Candidate : Candidates)
+			{
+				if (ClassPath == Candidate)
+				{
+					return CompileESModule(It->GetSharedSource(), Candidate, GetModuleOriginName(Candidate));
+				}
+			}
+		}
+
+#if UE_BUILD_SHIPPING
+#error LoadFileToString won't work in Shipping
+#endif // UE_BUILD_SHIPPING
+
+		for (const FString& Candidate : Candidates)
+		{
+			FString Code;
+			if (!FTsuResolutionCache::Get().FileExists(Candidate) || !FFileHelper::LoadFileToString(Code, *Candidate))
+				continue;
+
+			return CompileESModule(MakeShared<const FString>(MoveTemp(Code)), Candidate, GetModuleOriginName(Candidate));
+		}
+
+		const FString Message = FString::Printf(TEXT("Cannot find module '%s'"), *Specifier);
+		Isolate->ThrowException(v8::Exception::Error(TCHAR_TO_V8(*Message)));
+		return {};
+	}
+
+	// Anything else is a package, which is loaded through `require` and re-exported by a generated module
+	v8::Local<v8::Context> Context = GlobalContext.Get(Isolate);
+
+	if (!CommonJSExports.Contains(Specifier))
+	{
+		v8::Local<v8::Function> Require = Context->Global()
+			->Get(Context, u"require"_v8)
+			.ToLocalChecked()
+			.As<v8::Function>();
+
+		v8::Local<v8::Value> Argument = TCHAR_TO_V8(Specifier);
+
+		v8::Local<v8::Value> Exports;
+		if (!Require->Call(Context, v8::Undefined(Isolate), 1, &Argument).ToLocal(&Exports))
+			return {};
+
+		CommonJSExports.Emplace(Specifier, v8::Global<v8::Value>{Isolate, Exports});
+	}
+
+	v8::Local<v8::Value> Exports = CommonJSExports[Specifier].Get(Isolate);
+
+	FString EscapedSpecifier = Specifier.ReplaceCharWithEscapedChar();
+
+	// clang-format off
+	FString Code = FString::Printf(
+		TEXT("const __exports = __getCommonJSExports('%s');\n")
+		TEXT("export default __exports && __exports.__esModule ? __exports.default : __exports;\n"),
+		*EscapedSpecifier);
+	// clang-format on
+
+	v8::Local<v8::Array> Keys;
+	if (Exports->IsObject() && Exports.As<v8::Object>()->GetOwnPropertyNames(Context).ToLocal(&Keys))
+	{
+		TArray<FString> Names;
+
+		for (uint32 Index = 0; Index < Keys->Length(); ++Index)
+		{
+			v8::Local<v8::Value> Key = Keys->Get(Context, Index).ToLocalChecked();
+			if (!Key->IsString())
+				continue;
+
+			FString Name = V8_TO_TCHAR(Key.As<v8::String>());
+			if (IsExportableName(Name))
+				Names.Add(MoveTemp(Name));
+		}
+
+		if (Names.Num() > 0)
+			Code += FString::Printf(TEXT("export const { %s } = __exports;\n"), *FString::Join(Names, TEXT(", ")));
+	}
+
+	return CompileESModule(MakeShared<const FString>(MoveTemp(Code)), Specifier, Specifier);
+}
+
+bool FTsuContext::EvaluateESModule(v8::Local<v8::Module> Module)
+{
+	v8::Local<v8::Context> Context = GlobalContext.Get(Isolate);
+
+	if (Module->GetStatus() == v8::Module::kUninstantiated)
+	{
+		if (!Module->InstantiateModule(Context, &FTsuContext::OnResolveModule).FromMaybe(false))
+			return false;
+	}
+
+	if (Module->GetStatus() == v8::Module::kInstantiated)
+	{
+		if (Module->Evaluate(Context).IsEmpty())
+			return false;
+	}
+
+	if (Module->GetStatus() == v8::Module::kErrored)
+	{
+		Isolate->ThrowException(Module->GetException());
+		return false;
+	}
+
+	return true;
+}
+
+const FString* FTsuContext::FindESModuleKey(v8::Local<v8::Module> Module)
+{
+	for (auto It = ESModuleKeys.CreateConstKeyIterator(Module->GetIdentityHash()); It; ++It)
+	{
+		const FESModule* CachedModule = ESModules.Find(It.Value());
+		if (CachedModule && CachedModule->Module == Module)
+			return &It.Value();
+	}
+
+	return nullptr;
+}
+
+v8::MaybeLocal<v8::Module> FTsuContext::OnResolveModule(
+	v8::Local<v8::Context> Context,
+	v8::Local<v8::String> Specifier,
+	v8::Local<v8::Module> Referrer)
+{
+	const FString* ReferrerKey = Singleton->FindESModuleKey(Referrer);
+	if (!ensure(ReferrerKey != nullptr))
+	{
+		Isolate->ThrowException(v8::Exception::Error(u"Cannot resolve imports of an unknown module"_v8));
+		return {};
+	}
+
+	// Copied, since resolving might add to the module maps
+	const FString Key = *ReferrerKey;
+
+	return Singleton->ResolveESModule(V8_TO_TCHAR(Specifier), Key);
+}
+
+v8::MaybeLocal<v8::Promise> FTsuContext::OnImportModuleDynamically(
+	v8::Local<v8::Context> Context,
+	v8::Local<v8::ScriptOrModule> Referrer,
+	v8::Local<v8::String> Specifier)
+{
+	v8::Local<v8::Promise::Resolver> Resolver;
+	if (!v8::Promise::Resolver::New(Context).ToLocal(&Resolver))
+		return {};
+
+	// Both kinds of modules are named relative to the scripts directory, which lets CommonJS modules import too
+	FString ReferrerKey;
+	v8::Local<v8::Value> ResourceName = Referrer->GetResourceName();
+	if (ResourceName->IsString())
+	{
+		ReferrerKey = FPaths::ConvertRelativePathToFull(
+			FTsuPaths::ScriptsSourceDir(),
+			V8_TO_TCHAR(ResourceName.As<v8::String>()));
+	}
+
+	v8::TryCatch Catcher{Isolate};
+
+	v8::Local<v8::Module> Module;
+	if (Singleton->ResolveESModule(V8_TO_TCHAR(Specifier), ReferrerKey).ToLocal(&Module)
+		&& Singleton->EvaluateESModule(Module))
+	{
+		Resolver->Resolve(Context, Module->GetModuleNamespace()).Check();
+	}
+	else
+	{
+		Resolver->Reject(Context, Catcher.Exception()).Check();
+	}
+
+	return Resolver->GetPromise();
+}
+
 void FTsuContext::UnloadModule(const TCHAR* Binding)
 {
 	v8::HandleScope HandleScope{Isolate};
@@ -253,12 +651,16 @@ void FTsuContext::InitializeBuiltins()
 	DefineProperty(Global, u"module"_v8, Global);
 	DefineProperty(Global, u"exports"_v8, v8::Object::New(Isolate));
 
+	// Cooked scripts have `__DEV__` replaced with false by the parser, so this is only ever seen by uncooked scripts
+	DefineProperty(Global, u"__DEV__"_v8, v8::Boolean::New(Isolate, !UE_BUILD_SHIPPING));
+
 	DefineMethod(Global, u"setTimeout"_v8, &FTsuContext::_OnSetTimeout);
 	DefineMethod(Global, u"setInterval"_v8, &FTsuContext::_OnSetInterval);
 	DefineMethod(Global, u"clearTimeout"_v8, &FTsuContext::_OnClearTimeout);
 	DefineMethod(Global, u"clearInterval"_v8, &FTsuContext::_OnClearTimeout);
 	DefineMethod(Global, u"__require"_v8, &FTsuContext::_OnRequire);
 	DefineMethod(Global, u"__import"_v8, &FTsuContext::_OnImport);
+	DefineMethod(Global, u"__getCommonJSExports"_v8, &FTsuContext::_OnGetCommonJSExports);
 	DefineMethod(Global, u"__getProperty"_v8, &FTsuContext::_OnGetProperty);
 	DefineMethod(Global, u"__setProperty"_v8, &FTsuContext::_OnSetProperty);
 	DefineMethod(Global, u"__getArrayLength"_v8, &FTsuContext::_OnGetArrayLength);
@@ -276,6 +678,14 @@ void FTsuContext::InitializeBuiltins()
 	DefineMethod(Console, u"timeEnd"_v8, &FTsuContext::_OnConsoleTimeEnd);
 	DefineProperty(Global, u"console"_v8, Console);
 
+	v8::Local<v8::Object> Tsu = v8::Object::New(Isolate);
+	DefineMethod(Tsu, u"schedule"_v8, &FTsuContext::_OnSchedule);
+	DefineMethod(Tsu, u"yieldFrame"_v8, &FTsuContext::_OnYieldFrame);
+	DefineMethod(Tsu, u"importAsync"_v8, &FTsuContext::_OnImportAsync);
+	DefineMethod(Tsu, u"addTick"_v8, &FTsuContext::_OnAddTick);
+	DefineMethod(Tsu, u"removeTick"_v8, &FTsuContext::_OnRemoveTick);
+	DefineProperty(Global, u"tsu"_v8, Tsu);
+
 	v8::Local<v8::Object> Path = v8::Object::New(Isolate);
 	DefineMethod(Path, u"join"_v8, &FTsuContext::_OnPathJoin);
 	DefineMethod(Path, u"resolve"_v8, &FTsuContext::_OnPathResolve);
@@ -285,6 +695,8 @@ void FTsuContext::InitializeBuiltins()
 	v8::Local<v8::Object> File = v8::Object::New(Isolate);
 	DefineMethod(File, u"read"_v8, &FTsuContext::_OnFileRead);
 	DefineMethod(File, u"exists"_v8, &FTsuContext::_OnFileExists);
+	DefineMethod(File, u"findResolution"_v8, &FTsuContext::_OnFindResolution);
+	DefineMethod(File, u"addResolution"_v8, &FTsuContext::_OnAddResolution);
 	DefineProperty(Global, u"__file"_v8, File);
 
 #if PLATFORM_WINDOWS
@@ -362,7 +774,7 @@ void FTsuContext::InitializeRequire()
 
 	FString RequireCode;
 	verify(FFileHelper::LoadFileToString(RequireCode, *SourcePath));
-	BindModule(TEXT("require"), *RequireCode, *SourcePath);
+	BindModule(TEXT("require"), MakeShared<const FString>(MoveTemp(RequireCode)), *SourcePath);
 }
 
 void FTsuContext::InitializeArrayProxy()
@@ -376,7 +788,7 @@ void FTsuContext::InitializeArrayProxy()
 	verify(FFileHelper::LoadFileToString(ArrayProxyHandlerCode, *SourcePath));
 
 	v8::Local<v8::Function> HandlerConstructor = EvalModule(
-		*ArrayProxyHandlerCode,
+		MakeShared<const FString>(MoveTemp(ArrayProxyHandlerCode)),
 		*SourcePath
 	).ToLocalChecked().As<v8::Function>();
 
@@ -394,13 +806,28 @@ void FTsuContext::InitializeStructProxy()
 	verify(FFileHelper::LoadFileToString(StructProxyHandlerCode, *SourcePath));
 
 	v8::Local<v8::Function> HandlerConstructor = EvalModule(
-		*StructProxyHandlerCode,
+		MakeShared<const FString>(MoveTemp(StructProxyHandlerCode)),
 		*SourcePath
 	).ToLocalChecked().As<v8::Function>();
 
 	GlobalStructHandlerConstructor.Reset(Isolate, HandlerConstructor);
 }
 
+void FTsuContext::InitializeTickManager()
+{
+	const FString SourcePath = FTsuPaths::BootstrapPath() / TEXT("tickDispatcher.js");
+
+	FString TickDispatcherCode;
+	verify(FFileHelper::LoadFileToString(TickDispatcherCode, *SourcePath));
+
+	v8::Local<v8::Function> Dispatcher = EvalModule(
+		MakeShared<const FString>(MoveTemp(TickDispatcherCode)),
+		*SourcePath
+	).ToLocalChecked().As<v8::Function>();
+
+	TickManager.Emplace(*this, Dispatcher);
+}
+
 v8::Local<v8::Function> FTsuContext::FindOrAddConstructor(UStruct* Type)
 {
 	v8::Local<v8::Context> Context = GlobalContext.Get(Isolate);
@@ -455,14 +882,20 @@ v8::Local<v8::FunctionTemplate> FTsuContext::AddTemplate(UStruct* Type)
 		v8::Local<v8::String> Name = TCHAR_TO_V8(FTsuTypings::TailorNameOfField(Property));
 		v8::Local<v8::External> Data = v8::External::New(Isolate, Property);
 
+		v8::FunctionCallback GetterTrampoline = FTsuTrampolines::FindGetter(Property);
+		v8::FunctionCallback SetterTrampoline = FTsuTrampolines::FindSetter(Property);
+
 		v8::Local<v8::FunctionTemplate> Getter = v8::FunctionTemplate::New(
 			Isolate,
-			&FTsuContext::_OnPropertyGet,
+			GetterTrampoline ? GetterTrampoline : &FTsuContext::_OnPropertyGet,
 			Data);
 
 		v8::Local<v8::FunctionTemplate> Setter = bIsReadOnly
 			? v8::Local<v8::FunctionTemplate>()
-			: v8::FunctionTemplate::New(Isolate, &FTsuContext::_OnPropertySet, Data);
+			: v8::FunctionTemplate::New(
+				Isolate,
+				SetterTrampoline ? SetterTrampoline : &FTsuContext::_OnPropertySet,
+				Data);
 
 		PrototypeTemplate->SetAccessorProperty(Name, Getter, Setter);
 	}, Type);
@@ -474,20 +907,24 @@ v8::Local<v8::FunctionTemplate> FTsuContext::AddTemplate(UStruct* Type)
 
 		if (Method->HasAnyFunctionFlags(FUNC_Static))
 		{
+			v8::FunctionCallback Trampoline = FTsuTrampolines::Find(Method, false);
+
 			ConstructorTemplate->Set(
 				Name,
 				v8::FunctionTemplate::New(
 					Isolate,
-					&FTsuContext::_OnCallStaticMethod,
+					Trampoline ? Trampoline : &FTsuContext::_OnCallStaticMethod,
 					Data));
 		}
 		else
 		{
+			v8::FunctionCallback Trampoline = FTsuTrampolines::Find(Method, true);
+
 			PrototypeTemplate->Set(
 				Name,
 				v8::FunctionTemplate::New(
 					Isolate,
-					&FTsuContext::_OnCallMethod,
+					Trampoline ? Trampoline : &FTsuContext::_OnCallMethod,
 					Data));
 		}
 	}, Type);
@@ -496,9 +933,11 @@ v8::Local<v8::FunctionTemplate> FTsuContext::AddTemplate(UStruct* Type)
 	{
 		v8::Local<v8::String> Name = TCHAR_TO_V8(FTsuTypings::TailorNameOfExtension(Extension));
 
+		v8::FunctionCallback Trampoline = FTsuTrampolines::Find(Extension, true);
+
 		v8::Local<v8::FunctionTemplate> Callback = v8::FunctionTemplate::New(
 			Isolate,
-			&FTsuContext::_OnCallExtensionMethod,
+			Trampoline ? Trampoline : &FTsuContext::_OnCallExtensionMethod,
 			v8::External::New(Isolate, Extension));
 
 		PrototypeTemplate->Set(Name, Callback);
@@ -508,9 +947,11 @@ v8::Local<v8::FunctionTemplate> FTsuContext::AddTemplate(UStruct* Type)
 	{
 		v8::Local<v8::String> Name = TCHAR_TO_V8(FTsuTypings::TailorNameOfExtension(Extension));
 
+		v8::FunctionCallback Trampoline = FTsuTrampolines::Find(Extension, false);
+
 		v8::Local<v8::FunctionTemplate> Callback = v8::FunctionTemplate::New(
 			Isolate,
-			&FTsuContext::_OnCallStaticMethod,
+			Trampoline ? Trampoline : &FTsuContext::_OnCallStaticMethod,
 			v8::External::New(Isolate, Extension));
 
 		ConstructorTemplate->Set(Name, Callback);
@@ -520,9 +961,11 @@ v8::Local<v8::FunctionTemplate> FTsuContext::AddTemplate(UStruct* Type)
 	{
 		v8::Local<v8::String> Name = TCHAR_TO_V8(FTsuTypings::TailorNameOfExtension(Extension));
 
+		v8::FunctionCallback Trampoline = FTsuTrampolines::Find(Extension, false);
+
 		v8::Local<v8::FunctionTemplate> Callback = v8::FunctionTemplate::New(
 			Isolate,
-			&FTsuContext::_OnCallStaticMethod,
+			Trampoline ? Trampoline : &FTsuContext::_OnCallStaticMethod,
 			v8::External::New(Isolate, Extension));
 
 		ConstructorTemplate->Set(Name, Callback);
@@ -710,6 +1153,103 @@ void FTsuContext::Invoke(const TCHAR* Binding, FFrame& Stack, RESULT_DECL)
 		WritePropertyToBuffer(ReturnProperty, ReturnValue, RESULT_PARAM);
 }
 
+void FTsuContext::InvokeLatent(const TCHAR* Binding, FFrame& Stack)
+{
+	v8::HandleScope HandleScope{Isolate};
+
+	v8::Local<v8::Context> Context = GlobalContext.Get(Isolate);
+	v8::Local<v8::Object> Global = Context->Global();
+
+	UFunction* Function = Stack.CurrentNativeFunction;
+
+	// The world context parameter always comes first, followed by the script parameters, the latent info and
+	// finally the optional output parameter. See UTsuBlueprintGeneratedClass::BindFunction.
+	UObject* WorldContextObject = nullptr;
+	Stack.StepCompiledIn<UObjectPropertyBase>(&WorldContextObject);
+
+	FTsuWorldContextScope WorldScope{*this, WorldContextObject ? WorldContextObject : Stack.Object};
+
+	TArray<v8::Local<v8::Value>> Arguments;
+	FLatentActionInfo LatentInfo;
+	UProperty* ResultProperty = nullptr;
+	void* ResultAddress = nullptr;
+
+	for (
+		UProperty* Argument = (UProperty*)Function->Children->Next;
+		Argument != nullptr;
+		Argument = (UProperty*)Argument->Next)
+	{
+		auto StructArgument = Cast<UStructProperty>(Argument);
+		if (StructArgument && StructArgument->Struct == FLatentActionInfo::StaticStruct())
+		{
+			Stack.StepCompiledIn<UStructProperty>(&LatentInfo);
+		}
+		else if (FTsuReflection::IsInputParameter(Argument))
+		{
+			PopArgumentFromStack(Stack, Argument, Arguments);
+		}
+		else if (Argument->HasAnyPropertyFlags(CPF_OutParm))
+		{
+			uint8* TemporaryBuffer = (uint8*)FMemory_Alloca(Argument->GetSize());
+			Argument->InitializeValue(TemporaryBuffer);
+
+			uint8& Result = Stack.StepCompiledInRef<UProperty, uint8>(TemporaryBuffer);
+
+			// The result can only be written once the promise settles, so there's no point in holding on to
+			// the temporary buffer if the caller didn't provide any storage of its own
+			if (&Result != TemporaryBuffer)
+			{
+				ResultProperty = Argument;
+				ResultAddress = &Result;
+			}
+
+			Argument->DestroyValue(TemporaryBuffer);
+		}
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+	if (!World)
+		return;
+
+	FLatentActionManager& LatentManager = World->GetLatentActionManager();
+	if (LatentManager.FindExistingAction<FTsuLatentAction>(LatentInfo.CallbackTarget, LatentInfo.UUID))
+		return;
+
+	const FString FunctionName = FTsuTypings::TailorNameOfField(Function);
+	v8::Local<v8::Function> Export = GetExportedFunction(Binding, *FunctionName).ToLocalChecked();
+
+	FTsuTryCatch Catcher{Isolate};
+
+	v8::MaybeLocal<v8::Value> MaybeReturnValue = Export->Call(
+		Context,
+		Global,
+		Arguments.Num(),
+		Arguments.GetData());
+
+	Catcher.Check();
+
+	v8::Local<v8::Value> ReturnValue;
+	if (!MaybeReturnValue.ToLocal(&ReturnValue))
+		return;
+
+	v8::Local<v8::Promise> Promise;
+	if (ReturnValue->IsPromise())
+	{
+		Promise = ReturnValue.As<v8::Promise>();
+	}
+	else
+	{
+		v8::Local<v8::Promise::Resolver> Resolver = v8::Promise::Resolver::New(Context).ToLocalChecked();
+		Resolver->Resolve(Context, ReturnValue).Check();
+		Promise = Resolver->GetPromise();
+	}
+
+	LatentManager.AddNewAction(
+		LatentInfo.CallbackTarget,
+		LatentInfo.UUID,
+		new FTsuLatentAction(LatentInfo, Promise, ResultProperty, ResultAddress));
+}
+
 bool FTsuContext::InvokeDelegateEvent(
 	v8::Local<v8::Object> WorldContext,
 	v8::Local<v8::Function> Callback,
@@ -1332,6 +1872,73 @@ void FTsuContext::OnClearTimeout(const v8::FunctionCallbackInfo<v8::Value>& Info
 	}
 }
 
+void FTsuContext::OnSchedule(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+	if (!ensureV8(Info.Length() >= 1 && Info.Length() <= 2))
+		return;
+
+	if (!ensureV8(Info[0]->IsFunction()))
+		return;
+
+	v8::Local<v8::Context> Context = GlobalContext.Get(Isolate);
+
+	v8::Local<v8::Function> InCallback = Info[0].As<v8::Function>();
+
+	int32 Priority = 0;
+	if (Info.Length() == 2 && !Info[1]->IsUndefined())
+		Priority = Info[1]->Int32Value(Context).FromMaybe(0);
+
+	UObject* WorldContext = nullptr;
+	GetInternalFields(GetWorldContext(), &WorldContext);
+
+	TaskQueue->Schedule(InCallback, WorldContext, Priority);
+}
+
+void FTsuContext::OnYieldFrame(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+	v8::Local<v8::Context> Context = GlobalContext.Get(Isolate);
+	Info.GetReturnValue().Set(TaskQueue->YieldFrame(Context));
+}
+
+void FTsuContext::OnAddTick(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+	if (!ensureV8(Info.Length() >= 2 && Info.Length() <= 3))
+		return;
+
+	UObject* Object = nullptr;
+	if (!ensureV8(GetInternalFields(Info[0], &Object) && Object != nullptr))
+		return;
+
+	if (!ensureV8(Info[1]->IsFunction()))
+		return;
+
+	v8::Local<v8::Context> Context = GlobalContext.Get(Isolate);
+
+	ETickingGroup TickGroup = TG_PrePhysics;
+	if (Info.Length() == 3 && !Info[2]->IsUndefined())
+		TickGroup = (ETickingGroup)Info[2]->Int32Value(Context).FromMaybe(TG_PrePhysics);
+
+	if (!ensureV8(TickGroup >= 0 && TickGroup < TG_MAX))
+		return;
+
+	ensureV8(TickManager->Register(
+		Object,
+		Info[1].As<v8::Function>(),
+		TickGroup));
+}
+
+void FTsuContext::OnRemoveTick(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+	if (!ensureV8(Info.Length() == 1))
+		return;
+
+	UObject* Object = nullptr;
+	if (!ensureV8(GetInternalFields(Info[0], &Object) && Object != nullptr))
+		return;
+
+	TickManager->Unregister(Object);
+}
+
 void FTsuContext::OnPathJoin(const v8::FunctionCallbackInfo<v8::Value>& Info)
 {
 	const int32 NumArgs = Info.Length();
@@ -1421,10 +2028,44 @@ void FTsuContext::OnFileExists(const v8::FunctionCallbackInfo<v8::Value>& Info)
 #error FileExists won't work in Shipping
 #endif // UE_BUILD_SHIPPING
 
-	const bool bFileExists = FPlatformFileManager::Get().GetPlatformFile().FileExists(*Path);
+	const bool bFileExists = FTsuResolutionCache::Get().FileExists(Path);
 	Info.GetReturnValue().Set(bFileExists);
 }
 
+void FTsuContext::OnFindResolution(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+	if (!ensureV8(Info.Length() == 2))
+		return;
+
+	v8::Local<v8::Value> BaseDirArg = Info[0];
+	v8::Local<v8::Value> IdArg = Info[1];
+	if (!ensureV8(BaseDirArg->IsString() && IdArg->IsString()))
+		return;
+
+	const FString BaseDir = V8_TO_TCHAR(BaseDirArg.As<v8::String>());
+	const FString Id = V8_TO_TCHAR(IdArg.As<v8::String>());
+
+	if (const FString* Path = FTsuResolutionCache::Get().FindResolution(BaseDir, Id))
+		Info.GetReturnValue().Set(TCHAR_TO_V8(*Path));
+}
+
+void FTsuContext::OnAddResolution(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+	if (!ensureV8(Info.Length() == 3))
+		return;
+
+	v8::Local<v8::Value> BaseDirArg = Info[0];
+	v8::Local<v8::Value> IdArg = Info[1];
+	v8::Local<v8::Value> PathArg = Info[2];
+	if (!ensureV8(BaseDirArg->IsString() && IdArg->IsString() && PathArg->IsString()))
+		return;
+
+	FTsuResolutionCache::Get().AddResolution(
+		V8_TO_TCHAR(BaseDirArg.As<v8::String>()),
+		V8_TO_TCHAR(IdArg.As<v8::String>()),
+		V8_TO_TCHAR(PathArg.As<v8::String>()));
+}
+
 void FTsuContext::OnRequire(const v8::FunctionCallbackInfo<v8::Value>& Info)
 {
 	if (!ensureV8(Info.Length() == 1))
@@ -1444,7 +2085,7 @@ void FTsuContext::OnRequire(const v8::FunctionCallbackInfo<v8::Value>& Info)
 	if (!ensureV8(FFileHelper::LoadFileToString(Code, *Path)))
 		return;
 
-	v8::MaybeLocal<v8::Value> MaybeModule = EvalModule(*Code, *Path);
+	v8::MaybeLocal<v8::Value> MaybeModule = EvalModule(MakeShared<const FString>(MoveTemp(Code)), *Path);
 
 	v8::Local<v8::Value> Module;
 	if (!ensureV8(MaybeModule.ToLocal(&Module)))
@@ -1478,6 +2119,98 @@ void FTsuContext::OnImport(const v8::FunctionCallbackInfo<v8::Value>& Info)
 	}
 }
 
+void FTsuContext::OnGetCommonJSExports(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+	if (!ensureV8(Info.Length() == 1))
+		return;
+
+	v8::Local<v8::Value> SpecifierArg = Info[0];
+	if (!ensureV8(SpecifierArg->IsString()))
+		return;
+
+	const FString Specifier = V8_TO_TCHAR(SpecifierArg.As<v8::String>());
+
+	const v8::Global<v8::Value>* Exports = CommonJSExports.Find(Specifier);
+	if (!ensureV8(Exports != nullptr))
+		return;
+
+	Info.GetReturnValue().Set(Exports->Get(Isolate));
+}
+
+void FTsuContext::OnImportAsync(const v8::FunctionCallbackInfo<v8::Value>& Info)
+{
+	if (!ensureV8(Info.Length() == 1))
+		return;
+
+	v8::Local<v8::Value> TypeNameArg = Info[0];
+	if (!ensureV8(TypeNameArg->IsString()))
+		return;
+
+	v8::Local<v8::Context> Context = GlobalContext.Get(Isolate);
+	v8::Local<v8::Promise::Resolver> Resolver = v8::Promise::Resolver::New(Context).ToLocalChecked();
+	Info.GetReturnValue().Set(Resolver->GetPromise());
+
+	const FString TypeName = V8_TO_TCHAR(TypeNameArg.As<v8::String>());
+
+	if (auto Object = Cast<UStruct>(FTsuReflection::FindLoadedTypeByName(TypeName)))
+	{
+		Resolver->Resolve(Context, FindOrAddConstructor(Object)).Check();
+		return;
+	}
+
+	const FSoftObjectPath ClassPath = FTsuReflection::FindUnloadedTypePath(TypeName);
+	if (!ClassPath.IsValid())
+	{
+		const FString Message = FString::Printf(TEXT("Failed to find type '%s'"), *TypeName);
+		Resolver->Reject(Context, v8::Exception::Error(TCHAR_TO_V8(*Message))).Check();
+		return;
+	}
+
+	// Streaming the class in avoids the hitch that comes with loading it, and all its dependencies, synchronously
+	const uint64 ImportHandle = NextImportHandle++;
+
+	FPendingImport& PendingImport = PendingImports.Add(ImportHandle);
+	PendingImport.TypeName = TypeName;
+	PendingImport.ClassPath = ClassPath;
+	PendingImport.Resolver.Reset(Isolate, Resolver);
+
+	TSharedPtr<FStreamableHandle> Handle = StreamableManager.RequestAsyncLoad(
+		ClassPath,
+		FStreamableDelegate::CreateRaw(this, &FTsuContext::OnImportLoaded, ImportHandle));
+
+	// The delegate might have been executed already, if the class happened to be loaded
+	if (FPendingImport* StillPendingImport = PendingImports.Find(ImportHandle))
+		StillPendingImport->Handle = MoveTemp(Handle);
+}
+
+void FTsuContext::OnImportLoaded(uint64 ImportHandle)
+{
+	FPendingImport* FoundImport = PendingImports.Find(ImportHandle);
+	if (!FoundImport)
+		return;
+
+	FPendingImport PendingImport = MoveTemp(*FoundImport);
+	PendingImports.Remove(ImportHandle);
+
+	v8::HandleScope HandleScope{Isolate};
+	v8::Local<v8::Context> Context = GlobalContext.Get(Isolate);
+	v8::Local<v8::Promise::Resolver> Resolver = PendingImport.Resolver.Get(Isolate);
+
+	FTsuTryCatch Catcher{Isolate};
+
+	if (auto Object = Cast<UStruct>(PendingImport.ClassPath.ResolveObject()))
+	{
+		Resolver->Resolve(Context, FindOrAddConstructor(Object)).Check();
+	}
+	else
+	{
+		const FString Message = FString::Printf(TEXT("Failed to load type '%s'"), *PendingImport.TypeName);
+		Resolver->Reject(Context, v8::Exception::Error(TCHAR_TO_V8(*Message))).Check();
+	}
+
+	Isolate->RunMicrotasks();
+}
+
 void FTsuContext::OnGetProperty(const v8::FunctionCallbackInfo<v8::Value>& Info)
 {
 	if (!ensureV8(Info.Length() == 2))
@@ -1774,7 +2507,12 @@ void FTsuContext::CallMethod(
 	void* ParamsBuffer,
 	v8::ReturnValue<v8::Value> ReturnValue)
 {
-	Object->ProcessEvent(Method, ParamsBuffer);
+	using namespace TsuContext_Private;
+
+	if (CanInvokeDirectly(Method))
+		InvokeDirectly(Object, Method, ParamsBuffer);
+	else
+		Object->ProcessEvent(Method, ParamsBuffer);
 
 	if (FTsuReflection::HasOutputParameters(Method))
 	{
@@ -0,0 +1,65 @@
+#include "TsuLatentAction.h"
+
+#include "TsuContext.h"
+#include "TsuIsolate.h"
+#include "TsuRuntimeLog.h"
+#include "TsuStringConv.h"
+
+FTsuLatentAction::FTsuLatentAction(
+	const FLatentActionInfo& LatentInfo,
+	v8::Local<v8::Promise> InPromise,
+	UProperty* InResultProperty,
+	void* InResultAddress)
+	: ExecutionFunction(LatentInfo.ExecutionFunction)
+	, OutputLink(LatentInfo.Linkage)
+	, CallbackTarget(LatentInfo.CallbackTarget)
+	, Promise(FTsuIsolate::Get(), InPromise)
+	, ResultProperty(InResultProperty)
+	, ResultAddress(InResultAddress)
+{
+}
+
+void FTsuLatentAction::UpdateOperation(FLatentResponse& Response)
+{
+	// The promise will never settle if the context has been torn down underneath it
+	if (!FTsuContext::Exists())
+	{
+		Response.DoneIf(true);
+		return;
+	}
+
+	v8::Isolate* Isolate = FTsuIsolate::Get();
+	v8::HandleScope HandleScope{Isolate};
+
+	v8::Local<v8::Promise> LocalPromise = Promise.Get(Isolate);
+
+	switch (LocalPromise->State())
+	{
+	case v8::Promise::kPending:
+		break;
+	case v8::Promise::kFulfilled:
+		if (ResultProperty && ResultAddress)
+			FTsuContext::Get().WritePropertyToBuffer(ResultProperty, LocalPromise->Result(), ResultAddress);
+
+		Response.FinishAndTriggerIf(true, ExecutionFunction, OutputLink, CallbackTarget);
+		break;
+	case v8::Promise::kRejected:
+	{
+		v8::Local<v8::Context> Context = Isolate->GetCurrentContext();
+		v8::Local<v8::String> Reason = LocalPromise->Result()->ToString(Context).ToLocalChecked();
+		UE_LOG(LogTsuRuntime, Error, TEXT("[V8] Unhandled promise rejection: %s"), *V8_TO_TCHAR(Reason));
+
+		Response.DoneIf(true);
+		break;
+	}
+	}
+}
+
+#if WITH_EDITOR
+
+FString FTsuLatentAction::GetDescription() const
+{
+	return TEXT("Waiting for script promise to settle");
+}
+
+#endif // WITH_EDITOR
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "TsuV8Wrapper.h"
+
+#include "Engine/LatentActionManager.h"
+#include "LatentActions.h"
+
+class FTsuLatentAction
+	: public FPendingLatentAction
+{
+public:
+	/**
+	 * @param LatentInfo The latent info passed to the latent function
+	 * @param Promise The promise returned by the exported async function
+	 * @param ResultProperty Optional property through which the resolved value is returned
+	 * @param ResultAddress Optional address of the resolved value, inside the caller's frame
+	 */
+	FTsuLatentAction(
+		const FLatentActionInfo& LatentInfo,
+		v8::Local<v8::Promise> Promise,
+		UProperty* ResultProperty = nullptr,
+		void* ResultAddress = nullptr);
+
+	void UpdateOperation(FLatentResponse& Response) override;
+
+#if WITH_EDITOR
+	FString GetDescription() const override;
+#endif // WITH_EDITOR
+
+private:
+	FName ExecutionFunction;
+	int32 OutputLink = 0;
+	FWeakObjectPtr CallbackTarget;
+	v8::Global<v8::Promise> Promise;
+	UProperty* ResultProperty = nullptr;
+	void* ResultAddress = nullptr;
+};
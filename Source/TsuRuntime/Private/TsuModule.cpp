@@ -16,3 +16,8 @@ void FTsuModule::Invoke(FFrame& Stack, RESULT_DECL) const
 {
 	FTsuContext::Get().Invoke(*Binding, Stack, RESULT_PARAM);
 }
+
+void FTsuModule::InvokeLatent(FFrame& Stack) const
+{
+	FTsuContext::Get().InvokeLatent(*Binding, Stack);
+}
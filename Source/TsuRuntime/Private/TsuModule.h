@@ -11,6 +11,7 @@ public:
 
 	void Unload() const;
 	void Invoke(FFrame& Stack, RESULT_DECL) const;
+	void InvokeLatent(FFrame& Stack) const;
 
 private:
 	FString Binding;
@@ -1,7 +1,7 @@
 #include "TsuReflection.h"
 
-#include "TsuBlueprintGeneratedClass.h"
 #include "TsuObjectLibrary.h"
+#include "TsuReflectionDatabase.h"
 #include "TsuRotatorLibrary.h"
 #include "TsuTimelineLibrary.h"
 #include "TsuTransformLibrary.h"
@@ -9,12 +9,22 @@
 #include "TsuUtilities.h"
 #include "TsuVectorLibrary.h"
 
-#include "Kismet/BlueprintFunctionLibrary.h"
-#include "UObject/UObjectIterator.h"
+#include "UObject/Package.h"
 
 // #todo(#mihe): Take a look at UEdGraphSchema_K2::IsAllowableBlueprintVariableType?
 // #todo(#mihe): Take a look at CanBeExposed in K2Node_MakeStruct.cpp?
 
+namespace TsuReflection_Private
+{
+
+FTsuTypeIndex& GetTypeIndex()
+{
+	static FTsuTypeIndex Index;
+	return Index;
+}
+
+} // namespace TsuReflection_Private
+
 const FName FTsuReflection::MetaWorldContext = TEXT("WorldContext");
 const FName FTsuReflection::MetaNativeMakeFunc = TEXT("NativeMakeFunc");
 const FName FTsuReflection::MetaNativeBreakFunc = TEXT("NativeBreakFunc");
@@ -226,126 +236,33 @@ bool FTsuReflection::CanLibraryExtendType(UStruct* Library, UStruct* Type)
 	return true;
 }
 
-void FTsuReflection::VisitAllTypes(const TypeVisitor& Visitor)
+void FTsuReflection::VisitAllTypes(const TypeVisitor& Visitor, bool bIncludeNative)
 {
-	FTsuTypeSet ReferencedTypes;
-	ReferencedTypes.Reserve(100);
-
-	for (auto Class : TObjectRange<UClass>())
-	{
-		if (IsInternalType(Class))
-			continue;
+	FTsuReflectionDatabase& Database = FTsuReflectionDatabase::Get();
 
-		ReferencedTypes.Reset();
-		if (GetReferencesInType(Class, ReferencedTypes))
-			Visitor(Class, ReferencedTypes);
-	}
-
-	for (auto Struct : TObjectRange<UScriptStruct>())
-	{
-		if (IsInternalType(Struct))
-			continue;
-
-		ReferencedTypes.Reset();
-		if (GetReferencesInType(Struct, ReferencedTypes))
-			Visitor(Struct, ReferencedTypes);
-	}
-
-	for (auto Enum : TObjectRange<UEnum>())
+	Database.VisitTypes([&](UField* Type)
 	{
-		if (IsInternalType(Enum))
-			continue;
-
-		ReferencedTypes.Reset();
-		Visitor(Enum, ReferencedTypes);
-	}
+		if (const FTsuTypeSet* References = Database.FindReferences(Type))
+			Visitor(Type, *References);
+	}, bIncludeNative);
 }
 
 void FTsuReflection::VisitFunctionLibraries(const LibraryVisitor& Visitor)
 {
-	using FCache = TArray<UClass*>;
-
-	static const FCache Cache = []
-	{
-		FCache Result;
-
-		for (auto Class : TObjectRange<UClass>())
-		{
-			if (!Class->IsChildOf<UBlueprintFunctionLibrary>())
-				continue;
-
-			if (Cast<UTsuBlueprintGeneratedClass>(Class))
-				continue;
-
-			Result.Add(Class);
-		}
-
-		return Result;
-	}();
-
-	for (UClass* Class : Cache)
+	for (UClass* Class : FTsuReflectionDatabase::Get().GetFunctionLibraries())
 		Visitor(Class);
 }
 
 void FTsuReflection::VisitMakeFunctions(const MakeVisitor& Visitor)
 {
-	using FCache = TMap<UFunction*, UScriptStruct*>;
-
-	static const FCache Cache = []
-	{
-		FCache Result;
-
-		VisitFunctionLibraries([&](UClass* Library)
-		{
-			for (auto Function : TImmediateFieldRange<UFunction>(Library))
-			{
-				if (!Function->HasMetaData(MetaNativeMakeFunc))
-					continue;
-
-				UProperty* ReturnProperty = Function->GetReturnProperty();
-				auto StructProperty = Cast<UStructProperty>(ReturnProperty);
-				if (ensure(StructProperty))
-					Result.FindOrAdd(Function) = StructProperty->Struct;
-			}
-		});
-
-		return Result;
-	}();
-
-	for (const auto& Entry : Cache)
-		Visitor(Entry.Key, Entry.Value);
+	for (const auto& Entry : FTsuReflectionDatabase::Get().GetMakeFunctions())
+		Visitor(Entry.Value, Entry.Key);
 }
 
 void FTsuReflection::VisitBreakFunctions(const BreakVisitor& Visitor)
 {
-	using FCache = TMap<UFunction*, UScriptStruct*>;
-
-	static const FCache Cache = []
-	{
-		FCache Result;
-
-		VisitFunctionLibraries([&](UClass* Library)
-		{
-			for (auto Function : TImmediateFieldRange<UFunction>(Library))
-			{
-				if (!Function->HasMetaData(MetaNativeBreakFunc))
-					continue;
-
-				FParamIterator ParamIt{Function};
-				if (!ensure(ParamIt))
-					continue;
-
-				auto StructProperty = Cast<UStructProperty>(*ParamIt);
-				if (ensure(StructProperty))
-					Result.FindOrAdd(Function) = StructProperty->Struct;
-			}
-		});
-
-		return Result;
-	}();
-
-	for (const auto& Entry : Cache)
-		Visitor(Entry.Key, Entry.Value);
+	for (const auto& Entry : FTsuReflectionDatabase::Get().GetBreakFunctions())
+		Visitor(Entry.Value, Entry.Key);
 }
 
 void FTsuReflection::VisitProperties(
@@ -395,92 +312,20 @@ void FTsuReflection::VisitMethods(const MethodVisitor& Visitor, UStruct* Object)
 
 void FTsuReflection::VisitExtensionMethods(const ExtensionVisitor& Visitor, UStruct* Object)
 {
-	using FCache = TMap<UStruct*, TArray<UFunction*>>;
-
-	static const FCache Cache = [&]
-	{
-		FCache Result;
-
-		VisitFunctionLibraries([&](UClass* Library)
-		{
-			for (auto Function : TImmediateFieldRange<UFunction>(Library))
-			{
-				if (UStruct* Type = FindExtendedTypeNonStatic(Function))
-				{
-					if (CanLibraryExtendType(Library, Type))
-						Result.FindOrAdd(Type).Add(Function);
-				}
-			}
-		});
-
-		return Result;
-	}();
-
-	if (const TArray<UFunction*>* Functions = Cache.Find(Object))
-	{
-		for (UFunction* Function : *Functions)
-			Visitor(Function);
-	}
+	for (UFunction* Function : FTsuReflectionDatabase::Get().GetExtensionMethods(Object))
+		Visitor(Function);
 }
 
 void FTsuReflection::VisitStaticExtensionMethods(const StaticExtensionVisitor& Visitor, UStruct* Object)
 {
-	using FCache = TMap<UStruct*, TArray<UFunction*>>;
-
-	static const FCache Cache = [&]
-	{
-		FCache Result;
-
-		VisitFunctionLibraries([&](UClass* Library)
-		{
-			for (auto Function : TImmediateFieldRange<UFunction>(Library))
-			{
-				if (UStruct* Type = FindExtendedTypeStatic(Function))
-				{
-					if (CanLibraryExtendType(Library, Type))
-						Result.FindOrAdd(Type).Add(Function);
-				}
-			}
-		});
-
-		return Result;
-	}();
-
-	if (const TArray<UFunction*>* Functions = Cache.Find(Object))
-	{
-		for (UFunction* Function : *Functions)
-			Visitor(Function);
-	}
+	for (UFunction* Function : FTsuReflectionDatabase::Get().GetStaticExtensionMethods(Object))
+		Visitor(Function);
 }
 
 void FTsuReflection::VisitExtensionConstants(const ConstantVisitor& Visitor, UStruct* Object)
 {
-	using FCache = TMap<UStruct*, TArray<UFunction*>>;
-
-	static const FCache Cache = [&]
-	{
-		FCache Result;
-
-		VisitFunctionLibraries([&](UClass* Library)
-		{
-			for (auto Function : TImmediateFieldRange<UFunction>(Library))
-			{
-				if (UStruct* Type = FindExtendedTypeConstant(Function))
-				{
-					if (CanLibraryExtendType(Library, Type))
-						Result.FindOrAdd(Type).Add(Function);
-				}
-			}
-		});
-
-		return Result;
-	}();
-
-	if (const TArray<UFunction*>* Functions = Cache.Find(Object))
-	{
-		for (UFunction* Function : *Functions)
-			Visitor(Function);
-	}
+	for (UFunction* Function : FTsuReflectionDatabase::Get().GetExtensionConstants(Object))
+		Visitor(Function);
 }
 
 void FTsuReflection::VisitFunctionParameters(
@@ -707,15 +552,7 @@ UFunction* FTsuReflection::FindMakeFunction(UStruct* Struct)
 	if (!ScriptStruct)
 		return nullptr;
 
-	UFunction* Result = nullptr;
-
-	VisitMakeFunctions([&](UFunction* Function, UScriptStruct* ScriptStruct)
-	{
-		if (ScriptStruct == Struct)
-			Result = Function;
-	});
-
-	return Result;
+	return FTsuReflectionDatabase::Get().GetMakeFunctions().FindRef(ScriptStruct);
 }
 
 UFunction* FTsuReflection::FindBreakFunction(UStruct* Struct)
@@ -724,15 +561,7 @@ UFunction* FTsuReflection::FindBreakFunction(UStruct* Struct)
 	if (!ScriptStruct)
 		return nullptr;
 
-	UFunction* Result = nullptr;
-
-	VisitBreakFunctions([&](UFunction* Function, UScriptStruct* ScriptStruct)
-	{
-		if (ScriptStruct == Struct)
-			Result = Function;
-	});
-
-	return Result;
+	return FTsuReflectionDatabase::Get().GetBreakFunctions().FindRef(ScriptStruct);
 }
 
 bool FTsuReflection::HasMakeFunction(UStruct* Struct)
@@ -858,6 +687,15 @@ UStruct* FTsuReflection::FindExtendedType(UFunction* Function)
 
 UField* FTsuReflection::FindTypeByName(const FString& TypeName)
 {
-	static FTsuTypeIndex Index;
-	return Index.Find(TypeName);
+	return TsuReflection_Private::GetTypeIndex().Find(TypeName);
+}
+
+UField* FTsuReflection::FindLoadedTypeByName(const FString& TypeName)
+{
+	return TsuReflection_Private::GetTypeIndex().FindLoaded(TypeName);
+}
+
+FSoftObjectPath FTsuReflection::FindUnloadedTypePath(const FString& TypeName)
+{
+	return TsuReflection_Private::GetTypeIndex().FindBlueprintClassPath(TypeName);
 }
@@ -0,0 +1,735 @@
+#include "TsuReflectionDatabase.h"
+
+#include "TsuBlueprintGeneratedClass.h"
+#include "TsuPaths.h"
+#include "TsuRuntimeLog.h"
+#include "TsuRuntimeSettings.h"
+#include "TsuTypings.h"
+
+#include "Async/Async.h"
+#include "Hash/CityHash.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/FileHelper.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectIterator.h"
+
+#if WITH_EDITOR
+#include "Editor.h"
+#endif // WITH_EDITOR
+
+namespace TsuReflectionDatabase_Private
+{
+
+// Bump this whenever the format of the database or the rules for references change
+const TCHAR* DatabaseVersion = TEXT("1");
+
+bool IsNativeType(UField* Type)
+{
+	return Type->GetOutermost()->HasAnyPackageFlags(PKG_CompiledIn);
+}
+
+bool ShouldPersist()
+{
+	return GetDefault<UTsuRuntimeSettings>()->bPersistReflectionDatabase;
+}
+
+} // namespace TsuReflectionDatabase_Private
+
+using namespace TsuReflectionDatabase_Private;
+
+FTsuReflectionDatabase& FTsuReflectionDatabase::Get()
+{
+	static FTsuReflectionDatabase Instance;
+	return Instance;
+}
+
+void FTsuReflectionDatabase::Initialize()
+{
+	FTsuReflectionDatabase& Database = Get();
+	if (Database.bIsListening)
+		return;
+
+	Database.Build();
+
+	GUObjectArray.AddUObjectCreateListener(&Database);
+	GUObjectArray.AddUObjectDeleteListener(&Database);
+	Database.bIsListening = true;
+
+#if WITH_EDITOR
+	if (GEditor)
+	{
+		Database.HandleBlueprintCompiled = GEditor->OnBlueprintCompiled().AddRaw(
+			&Database,
+			&FTsuReflectionDatabase::OnBlueprintCompiled);
+	}
+#endif // WITH_EDITOR
+
+	FCoreDelegates::OnPreExit.AddStatic(&FTsuReflectionDatabase::Shutdown);
+}
+
+void FTsuReflectionDatabase::Shutdown()
+{
+	FTsuReflectionDatabase& Database = Get();
+	if (!Database.bIsListening)
+		return;
+
+#if WITH_EDITOR
+	if (GEditor)
+		GEditor->OnBlueprintCompiled().Remove(Database.HandleBlueprintCompiled);
+#endif // WITH_EDITOR
+
+	GUObjectArray.RemoveUObjectCreateListener(&Database);
+	GUObjectArray.RemoveUObjectDeleteListener(&Database);
+	Database.bIsListening = false;
+
+	if (ShouldPersist())
+		Database.Save();
+}
+
+UField* FTsuReflectionDatabase::FindType(const FString& TypeName)
+{
+	Refresh();
+
+	UField* Type = TypesByName.FindRef(TypeName);
+
+	if (auto Class = Cast<UClass>(Type))
+	{
+		if (FTsuReflection::IsInvalidClass(Class))
+			return nullptr;
+	}
+
+	return Type;
+}
+
+const FTsuTypeSet* FTsuReflectionDatabase::FindReferences(UField* Type)
+{
+	check(IsInGameThread());
+
+	Refresh();
+
+	FTypeEntry* Entry = Types.Find(Type);
+	if (!Entry)
+	{
+		AddType(Type);
+		Entry = Types.Find(Type);
+		if (!Entry)
+			return nullptr;
+	}
+
+	if (!Entry->bHasReferences)
+	{
+		// Gathering the references queries the database, so the entry can't be held on to meanwhile
+		FTsuTypeSet References;
+		const bool bIsValid = FTsuReflection::GetReferencesInType(Type, References);
+
+		Entry = Types.Find(Type);
+		if (!Entry)
+			return nullptr;
+
+		Entry->References = MoveTemp(References);
+		Entry->bIsValid = bIsValid;
+		Entry->bHasReferences = true;
+
+		if (IsNativeType(Type))
+			bNativeDirty = true;
+	}
+
+	return Entry->bIsValid ? &Entry->References : nullptr;
+}
+
+void FTsuReflectionDatabase::VisitTypes(const TFunctionRef<void(UField*)>& Visitor, bool bIncludeNative)
+{
+	Refresh();
+
+	// The visitor is free to query the database, which might add types, so we can't iterate the map directly
+	TArray<UField*> VisitedTypes;
+	VisitedTypes.Reserve(Types.Num());
+
+	for (const auto& Entry : Types)
+	{
+		if (bIncludeNative || !IsNativeType(Entry.Key))
+			VisitedTypes.Add(Entry.Key);
+	}
+
+	for (UField* Type : VisitedTypes)
+		Visitor(Type);
+}
+
+const TArray<UClass*>& FTsuReflectionDatabase::GetFunctionLibraries()
+{
+	if (IsInGameThread())
+		Refresh();
+
+	return FunctionLibraries;
+}
+
+const TArray<UFunction*>& FTsuReflectionDatabase::GetExtensionMethods(UStruct* Type)
+{
+	static const TArray<UFunction*> Empty;
+
+	if (IsInGameThread())
+		Refresh();
+
+	const TArray<UFunction*>* Functions = ExtensionMethods.Find(Type);
+	return Functions ? *Functions : Empty;
+}
+
+const TArray<UFunction*>& FTsuReflectionDatabase::GetStaticExtensionMethods(UStruct* Type)
+{
+	static const TArray<UFunction*> Empty;
+
+	if (IsInGameThread())
+		Refresh();
+
+	const TArray<UFunction*>* Functions = StaticExtensionMethods.Find(Type);
+	return Functions ? *Functions : Empty;
+}
+
+const TArray<UFunction*>& FTsuReflectionDatabase::GetExtensionConstants(UStruct* Type)
+{
+	static const TArray<UFunction*> Empty;
+
+	if (IsInGameThread())
+		Refresh();
+
+	const TArray<UFunction*>* Functions = ExtensionConstants.Find(Type);
+	return Functions ? *Functions : Empty;
+}
+
+const TMap<UScriptStruct*, UFunction*>& FTsuReflectionDatabase::GetMakeFunctions()
+{
+	if (IsInGameThread())
+		Refresh();
+
+	return MakeFunctions;
+}
+
+const TMap<UScriptStruct*, UFunction*>& FTsuReflectionDatabase::GetBreakFunctions()
+{
+	if (IsInGameThread())
+		Refresh();
+
+	return BreakFunctions;
+}
+
+void FTsuReflectionDatabase::NotifyUObjectCreated(const UObjectBase* Object, int32 /*Index*/)
+{
+	if (!IsIndexedType(Object))
+		return;
+
+	// The object is still being constructed, so we can't do much with it yet
+	FScopeLock ScopeLock{&PendingLock};
+	PendingTypes.Emplace(static_cast<UField*>(const_cast<UObjectBase*>(Object)), true);
+}
+
+void FTsuReflectionDatabase::NotifyUObjectDeleted(const UObjectBase* Object, int32 /*Index*/)
+{
+	if (!IsIndexedType(Object))
+		return;
+
+	UField* Type = static_cast<UField*>(const_cast<UObjectBase*>(Object));
+
+	FScopeLock ScopeLock{&PendingLock};
+
+	// Types that were never indexed must not be touched once they're gone
+	PendingTypes.RemoveAll([&](const TPair<UField*, bool>& Change)
+	{
+		return Change.Key == Type && Change.Value;
+	});
+
+	PendingTypes.Emplace(Type, false);
+}
+
+void FTsuReflectionDatabase::Build()
+{
+	BuildTimeStart = FPlatformTime::Seconds();
+
+	bIsBuilt = true;
+
+	Types.Reset();
+	TypesByName.Reset();
+
+	Types.Reserve(16 * 1024);
+	TypesByName.Reserve(16 * 1024);
+
+	BuildFunctionLibraries();
+
+	bIsLoaded = ShouldPersist() && Load();
+	bNativeDirty = !bIsLoaded;
+
+	AddTypesInRange(false);
+
+	if (bIsLoaded)
+	{
+		FinishBuild();
+		return;
+	}
+
+	// Tailoring the names of all the native types is by far the most expensive part of building the database, and
+	// since native types are never destroyed it's safe to do on a worker thread while the game thread carries on.
+	// Reading metadata isn't safe off the game thread though, so any explicit script names are read up front, and
+	// only types without one get named on the worker thread. Anything that queries the database before this finishes
+	// will block on it.
+
+	TArray<TPair<UField*, FString>> NativeTypes;
+	NativeTypes.Reserve(16 * 1024);
+
+	auto AddIfNative = [&](UField* Type)
+	{
+		if (IsNativeType(Type) && !FTsuReflection::IsInternalType(Type))
+		{
+			TOptional<FString> ScriptName = FTsuTypings::GetExplicitScriptName(Type);
+			NativeTypes.Emplace(Type, ScriptName ? MoveTemp(ScriptName.GetValue()) : FString());
+		}
+	};
+
+	for (auto Class : TObjectRange<UClass>())
+		AddIfNative(Class);
+
+	for (auto Struct : TObjectRange<UScriptStruct>())
+		AddIfNative(Struct);
+
+	for (auto Enum : TObjectRange<UEnum>())
+		AddIfNative(Enum);
+
+	PendingNativeTypes = Async(EAsyncExecution::ThreadPool, [NativeTypes = MoveTemp(NativeTypes)]() mutable
+	{
+		for (TPair<UField*, FString>& NativeType : NativeTypes)
+		{
+			if (NativeType.Value.IsEmpty())
+				NativeType.Value = FTsuTypings::GetImplicitScriptName(NativeType.Key);
+		}
+
+		return MoveTemp(NativeTypes);
+	});
+}
+
+void FTsuReflectionDatabase::FinishBuild()
+{
+	if (PendingNativeTypes.IsValid())
+	{
+		TArray<TPair<UField*, FString>> NativeTypes = PendingNativeTypes.Get();
+		PendingNativeTypes = {};
+
+		for (TPair<UField*, FString>& NativeType : NativeTypes)
+		{
+			if (Types.Contains(NativeType.Key))
+				continue;
+
+			FTypeEntry& Entry = Types.Add(NativeType.Key);
+			Entry.Name = MoveTemp(NativeType.Value);
+			TypesByName.Add(Entry.Name, NativeType.Key);
+		}
+	}
+
+	BuildExtensions();
+
+	UE_LOG(
+		LogTsuRuntime,
+		Log,
+		TEXT("Built reflection database with %d types in %.1f ms%s"),
+		Types.Num(),
+		(FPlatformTime::Seconds() - BuildTimeStart) * 1000,
+		bIsLoaded ? TEXT(" (loaded from disk)") : TEXT(""));
+}
+
+void FTsuReflectionDatabase::Refresh()
+{
+	check(IsInGameThread());
+
+	if (!bIsBuilt)
+		Build();
+
+	// Building the extensions will look up types by name, which ends up back here
+	if (bIsRefreshing)
+		return;
+
+	TGuardValue<bool> RefreshGuard{bIsRefreshing, true};
+
+	if (PendingNativeTypes.IsValid())
+		FinishBuild();
+
+	TArray<TPair<UField*, bool>> Changes;
+
+	{
+		FScopeLock ScopeLock{&PendingLock};
+		Changes = MoveTemp(PendingTypes);
+	}
+
+	bool bLibrariesDirty = false;
+
+	for (const TPair<UField*, bool>& Change : Changes)
+	{
+		UField* Type = Change.Key;
+		const bool bWasCreated = Change.Value;
+
+		if (bWasCreated)
+		{
+			AddType(Type);
+
+			if (auto Class = Cast<UClass>(Type))
+				bLibrariesDirty = bLibrariesDirty || Class->IsChildOf<UBlueprintFunctionLibrary>();
+		}
+		else
+		{
+			RemoveType(Type);
+
+			bLibrariesDirty = bLibrariesDirty || FunctionLibraries.Contains(Type);
+		}
+	}
+
+	if (bBlueprintsDirty)
+	{
+		RemoveNonNativeTypes();
+		AddTypesInRange(false);
+
+		bBlueprintsDirty = false;
+		bLibrariesDirty = true;
+	}
+
+	if (bLibrariesDirty)
+	{
+		BuildFunctionLibraries();
+		bExtensionsDirty = true;
+	}
+
+	if (bExtensionsDirty)
+	{
+		BuildExtensions();
+
+		bExtensionsDirty = false;
+		bReferencesDirty = true;
+	}
+
+	if (bReferencesDirty)
+	{
+		for (auto& Entry : Types)
+		{
+			Entry.Value.References.Reset();
+			Entry.Value.bHasReferences = false;
+		}
+
+		bReferencesDirty = false;
+		bNativeDirty = true;
+	}
+	else if (RemovedTypesSinceRefresh.Num() > 0)
+	{
+		// Only the types that referenced a removed type are affected by it
+		for (auto& Entry : Types)
+		{
+			FTypeEntry& TypeEntry = Entry.Value;
+			if (!TypeEntry.bHasReferences)
+				continue;
+
+			bool bReferencesRemoved = false;
+			for (UField* Reference : TypeEntry.References)
+			{
+				if (RemovedTypesSinceRefresh.Contains(Reference))
+				{
+					bReferencesRemoved = true;
+					break;
+				}
+			}
+
+			if (!bReferencesRemoved)
+				continue;
+
+			TypeEntry.References.Reset();
+			TypeEntry.bHasReferences = false;
+
+			if (IsNativeType(Entry.Key))
+				bNativeDirty = true;
+		}
+	}
+
+	RemovedTypesSinceRefresh.Reset();
+}
+
+void FTsuReflectionDatabase::AddType(UField* Type)
+{
+	if (Types.Contains(Type) || FTsuReflection::IsInternalType(Type))
+		return;
+
+	FTypeEntry& Entry = Types.Add(Type);
+	Entry.Name = FTsuTypings::TailorNameOfType(Type);
+	TypesByName.Add(Entry.Name, Type);
+}
+
+void FTsuReflectionDatabase::RemoveType(UField* Type)
+{
+	FTypeEntry Entry;
+	if (!Types.RemoveAndCopyValue(Type, Entry))
+		return;
+
+	if (TypesByName.FindRef(Entry.Name) == Type)
+		TypesByName.Remove(Entry.Name);
+
+	// Other types might be referencing the removed type
+	RemovedTypesSinceRefresh.Add(Type);
+}
+
+void FTsuReflectionDatabase::AddTypesInRange(bool bIncludeNative)
+{
+	auto AddIfIncluded = [&](UField* Type)
+	{
+		if (bIncludeNative || !IsNativeType(Type))
+			AddType(Type);
+	};
+
+	for (auto Class : TObjectRange<UClass>())
+		AddIfIncluded(Class);
+
+	for (auto Struct : TObjectRange<UScriptStruct>())
+		AddIfIncluded(Struct);
+
+	for (auto Enum : TObjectRange<UEnum>())
+		AddIfIncluded(Enum);
+}
+
+void FTsuReflectionDatabase::RemoveNonNativeTypes()
+{
+	TArray<UField*> RemovedTypes;
+
+	for (const auto& Entry : Types)
+	{
+		if (!IsNativeType(Entry.Key))
+			RemovedTypes.Add(Entry.Key);
+	}
+
+	for (UField* Type : RemovedTypes)
+		RemoveType(Type);
+}
+
+void FTsuReflectionDatabase::BuildFunctionLibraries()
+{
+	FunctionLibraries.Reset();
+
+	for (auto Class : TObjectRange<UClass>())
+	{
+		if (!Class->IsChildOf<UBlueprintFunctionLibrary>())
+			continue;
+
+		if (Cast<UTsuBlueprintGeneratedClass>(Class))
+			continue;
+
+		FunctionLibraries.Add(Class);
+	}
+}
+
+void FTsuReflectionDatabase::BuildExtensions()
+{
+	ExtensionMethods.Reset();
+	StaticExtensionMethods.Reset();
+	ExtensionConstants.Reset();
+	MakeFunctions.Reset();
+	BreakFunctions.Reset();
+
+	for (UClass* Library : FunctionLibraries)
+	{
+		for (auto Function : TImmediateFieldRange<UFunction>(Library))
+		{
+			if (UStruct* Type = FTsuReflection::FindExtendedTypeNonStatic(Function))
+			{
+				if (FTsuReflection::CanLibraryExtendType(Library, Type))
+					ExtensionMethods.FindOrAdd(Type).Add(Function);
+			}
+
+			if (UStruct* Type = FTsuReflection::FindExtendedTypeStatic(Function))
+			{
+				if (FTsuReflection::CanLibraryExtendType(Library, Type))
+					StaticExtensionMethods.FindOrAdd(Type).Add(Function);
+			}
+
+			if (UStruct* Type = FTsuReflection::FindExtendedTypeConstant(Function))
+			{
+				if (FTsuReflection::CanLibraryExtendType(Library, Type))
+					ExtensionConstants.FindOrAdd(Type).Add(Function);
+			}
+
+			if (Function->HasMetaData(FTsuReflection::MetaNativeMakeFunc))
+			{
+				auto StructProperty = Cast<UStructProperty>(Function->GetReturnProperty());
+				if (ensure(StructProperty))
+					MakeFunctions.Add(StructProperty->Struct, Function);
+			}
+
+			if (Function->HasMetaData(FTsuReflection::MetaNativeBreakFunc))
+			{
+				FParamIterator ParamIt{Function};
+				if (!ensure(ParamIt))
+					continue;
+
+				auto StructProperty = Cast<UStructProperty>(*ParamIt);
+				if (ensure(StructProperty))
+					BreakFunctions.Add(StructProperty->Struct, Function);
+			}
+		}
+	}
+}
+
+bool FTsuReflectionDatabase::Load()
+{
+	LoadedStamp.Reset();
+
+	const FString Stamp = GetStamp();
+	if (Stamp.IsEmpty())
+		return false;
+
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *FTsuPaths::ReflectionDatabasePath()))
+		return false;
+
+	if (Lines.Num() == 0 || Lines[0] != Stamp)
+		return false;
+
+	TArray<FString> Fields;
+
+	for (int32 LineIndex = 1; LineIndex < Lines.Num(); ++LineIndex)
+	{
+		// <Path> <Name> <1 = Valid, 0 = Unknown, x = Invalid> <ReferencePath>...
+		Lines[LineIndex].ParseIntoArray(Fields, TEXT(" "));
+		if (Fields.Num() < 3)
+			continue;
+
+		UField* Type = FindObject<UField>(nullptr, *Fields[0]);
+		if (!Type || Types.Contains(Type))
+			continue;
+
+		FTypeEntry& Entry = Types.Add(Type);
+		Entry.Name = MoveTemp(Fields[1]);
+		TypesByName.Add(Entry.Name, Type);
+
+		if (Fields[2] == TEXT("x"))
+		{
+			Entry.bHasReferences = true;
+			Entry.bIsValid = false;
+		}
+		else if (Fields[2] == TEXT("1"))
+		{
+			Entry.References.Reserve(Fields.Num() - 3);
+
+			bool bIsComplete = true;
+			for (int32 FieldIndex = 3; FieldIndex < Fields.Num() && bIsComplete; ++FieldIndex)
+			{
+				UField* Reference = FindObject<UField>(nullptr, *Fields[FieldIndex]);
+				if (Reference)
+					Entry.References.Add(Reference);
+				else
+					bIsComplete = false;
+			}
+
+			// Anything that doesn't resolve, like a Blueprint that isn't loaded yet, means we start over
+			if (bIsComplete)
+			{
+				Entry.bHasReferences = true;
+				Entry.bIsValid = true;
+			}
+			else
+			{
+				Entry.References.Reset();
+			}
+		}
+	}
+
+	LoadedStamp = Stamp;
+
+	return true;
+}
+
+void FTsuReflectionDatabase::Save()
+{
+	const FString Stamp = GetStamp();
+	if (Stamp.IsEmpty())
+		return;
+
+	if (Stamp == LoadedStamp && !bNativeDirty)
+		return;
+
+	FString Output;
+	Output.Reserve(Types.Num() * 256);
+
+	Output += Stamp;
+	Output += TEXT("\n");
+
+	for (const auto& Entry : Types)
+	{
+		UField* Type = Entry.Key;
+		const FTypeEntry& Value = Entry.Value;
+
+		if (!IsNativeType(Type))
+			continue;
+
+		Output += Type->GetPathName();
+		Output += TEXT(" ");
+		Output += Value.Name;
+		Output += TEXT(" ");
+		Output += !Value.bHasReferences ? TEXT("0") : Value.bIsValid ? TEXT("1") : TEXT("x");
+
+		if (Value.bHasReferences && Value.bIsValid)
+		{
+			for (UField* Reference : Value.References)
+			{
+				Output += TEXT(" ");
+				Output += Reference->GetPathName();
+			}
+		}
+
+		Output += TEXT("\n");
+	}
+
+	if (FFileHelper::SaveStringToFile(Output, *FTsuPaths::ReflectionDatabasePath()))
+	{
+		LoadedStamp = Stamp;
+		bNativeDirty = false;
+	}
+	else
+	{
+		UE_LOG(LogTsuRuntime, Warning, TEXT("Failed to save reflection database"));
+	}
+}
+
+FString FTsuReflectionDatabase::GetStamp() const
+{
+	// The native types are only known to be unchanged if the TSU generator has written a stamp for them
+	FString NativeTypesStamp;
+	if (!FFileHelper::LoadFileToString(NativeTypesStamp, *FTsuPaths::NativeTypesStampPath()))
+		return {};
+
+	// Function libraries contribute to the references of the types they extend, and not all of them are native
+	TArray<FString> LibraryPaths;
+	LibraryPaths.Reserve(FunctionLibraries.Num());
+
+	for (UClass* Library : FunctionLibraries)
+		LibraryPaths.Add(Library->GetPathName());
+
+	LibraryPaths.Sort();
+
+	const FString Libraries = FString::Join(LibraryPaths, TEXT(";"));
+	const uint64 LibrariesHash = CityHash64((const char*)*Libraries, Libraries.Len() * sizeof(TCHAR));
+
+	return FString::Printf(
+		TEXT("%s:%s:%016llx"),
+		*NativeTypesStamp.TrimStartAndEnd(),
+		DatabaseVersion,
+		LibrariesHash);
+}
+
+void FTsuReflectionDatabase::OnBlueprintCompiled()
+{
+	// Compiling can replace classes outright, so the Blueprint types are indexed anew on the next query
+	bBlueprintsDirty = true;
+}
+
+bool FTsuReflectionDatabase::IsIndexedType(const UObjectBase* Object)
+{
+	UClass* Class = Object->GetClass();
+	if (!Class)
+		return false;
+
+	return (
+		Class->IsChildOf<UClass>() ||
+		Class->IsChildOf<UScriptStruct>() ||
+		Class->IsChildOf<UEnum>()
+	);
+}
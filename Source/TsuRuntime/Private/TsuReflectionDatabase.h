@@ -0,0 +1,133 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "TsuReflection.h"
+
+#include "Async/Future.h"
+#include "UObject/UObjectArray.h"
+
+class UBlueprint;
+
+/**
+ * Indexes the types exposed to script, along with the information about them that would otherwise require walking
+ * every class, struct and enum, like their references, extension methods and make/break functions.
+ *
+ * The database is built once after engine init, with the bulk of the work happening on a worker thread, and is then
+ * kept up to date through the UObject create/delete listeners and the Blueprint compilation delegates. Newly created types are only indexed once the database is
+ * queried from the game thread, since they're not fully constructed when the listener is notified.
+ *
+ * The native part of the database can optionally be saved to disk (see `bPersistReflectionDatabase`), in which case
+ * warm starts can skip analyzing the native types for as long as the stamp written by the TSU generator is the same.
+ *
+ * Queries are not synchronized, and are expected to happen either on the game thread or while the game thread is
+ * blocked waiting for them, like during the typings generation.
+ */
+class FTsuReflectionDatabase final
+	: public FUObjectArray::FUObjectCreateListener
+	, public FUObjectArray::FUObjectDeleteListener
+{
+public:
+	static FTsuReflectionDatabase& Get();
+
+	/** Builds the database, loading it from disk if possible. Should be called after engine init. */
+	static void Initialize();
+
+	/** Saves the database to disk if needed, and stops listening for changes */
+	static void Shutdown();
+
+	FTsuReflectionDatabase(const FTsuReflectionDatabase& Other) = delete;
+	FTsuReflectionDatabase& operator=(const FTsuReflectionDatabase& Other) = delete;
+
+	/** Finds a type by its script name, or `nullptr` if no such type has been indexed */
+	UField* FindType(const FString& TypeName);
+
+	/**
+	 * Finds the types referenced by a type, computing and caching them if needed.
+	 *
+	 * @returns The references, or `nullptr` if the type isn't valid for use in script
+	 */
+	const FTsuTypeSet* FindReferences(UField* Type);
+
+	/** Visits all indexed types, filtering out internal types and (optionally) native types */
+	void VisitTypes(const TFunctionRef<void(UField*)>& Visitor, bool bIncludeNative = true);
+
+	/** All classes deriving from UBlueprintFunctionLibrary, excluding TSU blueprints */
+	const TArray<UClass*>& GetFunctionLibraries();
+
+	const TArray<UFunction*>& GetExtensionMethods(UStruct* Type);
+	const TArray<UFunction*>& GetStaticExtensionMethods(UStruct* Type);
+	const TArray<UFunction*>& GetExtensionConstants(UStruct* Type);
+
+	/** Make functions (`NativeMakeFunc`) by the struct they make */
+	const TMap<UScriptStruct*, UFunction*>& GetMakeFunctions();
+
+	/** Break functions (`NativeBreakFunc`) by the struct they break */
+	const TMap<UScriptStruct*, UFunction*>& GetBreakFunctions();
+
+private:
+	struct FTypeEntry
+	{
+		FString Name;
+		FTsuTypeSet References;
+		bool bHasReferences = false;
+		bool bIsValid = false;
+	};
+
+	using FExtensionMap = TMap<UStruct*, TArray<UFunction*>>;
+
+	FTsuReflectionDatabase() = default;
+
+	void NotifyUObjectCreated(const UObjectBase* Object, int32 Index) override;
+	void NotifyUObjectDeleted(const UObjectBase* Object, int32 Index) override;
+
+	void Build();
+	void FinishBuild();
+	void Refresh();
+	void AddType(UField* Type);
+	void RemoveType(UField* Type);
+	void AddTypesInRange(bool bIncludeNative);
+	void RemoveNonNativeTypes();
+	void BuildFunctionLibraries();
+	void BuildExtensions();
+
+	bool Load();
+	void Save();
+	FString GetStamp() const;
+
+	void OnBlueprintCompiled();
+
+	static bool IsIndexedType(const UObjectBase* Object);
+
+	TMap<UField*, FTypeEntry> Types;
+	TMap<FString, UField*> TypesByName;
+	TArray<UClass*> FunctionLibraries;
+	FExtensionMap ExtensionMethods;
+	FExtensionMap StaticExtensionMethods;
+	FExtensionMap ExtensionConstants;
+	TMap<UScriptStruct*, UFunction*> MakeFunctions;
+	TMap<UScriptStruct*, UFunction*> BreakFunctions;
+
+	/** Types created/deleted since the last refresh, where `true` means created */
+	FCriticalSection PendingLock;
+	TArray<TPair<UField*, bool>> PendingTypes;
+
+	/** Types removed since the last refresh, whose referencing types need their references recomputed */
+	TSet<UField*> RemovedTypesSinceRefresh;
+
+	TFuture<TArray<TPair<UField*, FString>>> PendingNativeTypes;
+	double BuildTimeStart = 0.0;
+
+	FString LoadedStamp;
+#if WITH_EDITOR
+	FDelegateHandle HandleBlueprintCompiled;
+#endif // WITH_EDITOR
+	bool bIsBuilt = false;
+	bool bIsLoaded = false;
+	bool bIsListening = false;
+	bool bReferencesDirty = false;
+	bool bExtensionsDirty = false;
+	bool bBlueprintsDirty = false;
+	bool bNativeDirty = false;
+	bool bIsRefreshing = false;
+};
@@ -0,0 +1,56 @@
+#include "TsuResolutionCache.h"
+
+#include "HAL/PlatformFile.h"
+#include "HAL/PlatformFilemanager.h"
+#include "Misc/Paths.h"
+
+FTsuResolutionCache& FTsuResolutionCache::Get()
+{
+	static FTsuResolutionCache Singleton;
+	return Singleton;
+}
+
+const FString* FTsuResolutionCache::FindResolution(const FString& BaseDir, const FString& Id) const
+{
+	return Resolutions.Find(FResolutionKey{BaseDir, Id});
+}
+
+void FTsuResolutionCache::AddResolution(const FString& BaseDir, const FString& Id, const FString& Path)
+{
+	Resolutions.Add(FResolutionKey{BaseDir, Id}, Path);
+}
+
+bool FTsuResolutionCache::FileExists(const FString& Path)
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+	// Scripts change all the time, and aren't probed nearly as much as packages are, so they're left uncached
+	if (!Path.Contains(TEXT("node_modules")))
+		return PlatformFile.FileExists(*Path);
+
+	const FString Directory = FPaths::GetPath(Path);
+
+	TSet<FString>* Listing = DirectoryListings.Find(Directory);
+	if (!Listing)
+	{
+		Listing = &DirectoryListings.Add(Directory);
+
+		PlatformFile.IterateDirectory(
+			*Directory,
+			[Listing](const TCHAR* FilenameOrDirectory, bool bIsDirectory)
+			{
+				if (!bIsDirectory)
+					Listing->Add(FPaths::GetCleanFilename(FilenameOrDirectory));
+
+				return true;
+			});
+	}
+
+	return Listing->Contains(FPaths::GetCleanFilename(Path));
+}
+
+void FTsuResolutionCache::Invalidate()
+{
+	Resolutions.Reset();
+	DirectoryListings.Reset();
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Caches the paths that `require` calls resolve to, along with the listings of the `node_modules` directories that
+ * the resolution probes, so that requiring an already resolved module doesn't have to touch the file system.
+ *
+ * Nothing here notices changes on disk by itself, so the caches are instead invalidated as a whole whenever the
+ * editor sees something change under the scripts directory.
+ */
+class FTsuResolutionCache final
+{
+public:
+	static FTsuResolutionCache& Get();
+
+	/** Finds what a module ID resolved to when required from a given directory, or `nullptr` if not yet resolved */
+	const FString* FindResolution(const FString& BaseDir, const FString& Id) const;
+
+	void AddResolution(const FString& BaseDir, const FString& Id, const FString& Path);
+
+	/** Checks whether a file exists, going by the cached listing of its directory if it's within `node_modules` */
+	bool FileExists(const FString& Path);
+
+	/** Throws away everything cached so far */
+	void Invalidate();
+
+private:
+	using FResolutionKey = TTuple<FString, FString>;
+
+	TMap<FResolutionKey, FString> Resolutions;
+
+	/** The names of the files in each `node_modules` directory, which is empty for directories that don't exist */
+	TMap<FString, TSet<FString>> DirectoryListings;
+};
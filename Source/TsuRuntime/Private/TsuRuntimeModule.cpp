@@ -3,6 +3,7 @@
 #include "TsuBlueprint.h"
 #include "TsuContext.h"
 #include "TsuPaths.h"
+#include "TsuReflectionDatabase.h"
 #include "TsuRuntimeBlueprintCompiler.h"
 
 #if WITH_EDITOR
@@ -110,6 +111,7 @@ private:
 		}
 
 		RegisterSettings();
+		FTsuReflectionDatabase::Initialize();
 		FTsuContext::Get();
 		AddCleanupDelegates();
 	}
@@ -15,6 +15,24 @@ public:
 	UPROPERTY(EditAnywhere, Config, Category="Runtime", Meta=(ConfigRestartRequired=true))
 	bool bAllowCodeGenerationFromStrings = false;
 
+	/** The time, in milliseconds, that tasks queued through `tsu.schedule` are allowed to run for each frame */
+	UPROPERTY(EditAnywhere, Config, Category="Runtime", Meta=(ClampMin=0, Units="ms"))
+	float TaskBudget = 2.f;
+
+	/**
+	 * Whether or not to save the reflection data of native types to disk, letting subsequent runs skip analyzing
+	 * them for as long as the native types are unchanged. Requires the TSU generator to be enabled.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category="Runtime", Meta=(ConfigRestartRequired=true))
+	bool bPersistReflectionDatabase = false;
+
+	/**
+	 * Whether or not to load scripts as ES modules rather than CommonJS modules, which lets them use `import()` to
+	 * load other scripts on demand. Requires `module` to be set to "es2015" or "esnext" in your tsconfig.json.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category="Runtime", Meta=(ConfigRestartRequired=true))
+	bool bUseESModules = false;
+
 	/** Whether or not to use a DefaultToSelf parameter */
 	UPROPERTY(EditAnywhere, Config, Category="Compilation", Meta=(ConfigRestartRequired=true))
 	bool bUseSelfParameter = false;
@@ -22,4 +40,11 @@ public:
 	/** The name of the parameter that should get the 'DefaultToSelf' metadata assigned to it */
 	UPROPERTY(EditAnywhere, Config, Category="Compilation", Meta=(ConfigRestartRequired=true, EditCondition="bUseSelfParameter"))
 	FString SelfParameterName = TEXT("target");
+
+	/**
+	 * Whether or not to write the typings of native types as one `declare module` file per engine/game module, rather
+	 * than one file per type. Requires "TsuBundles" to be listed under `types` in your tsconfig.json.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category="Typings", Meta=(ConfigRestartRequired=true))
+	bool bBundleTypings = false;
 };
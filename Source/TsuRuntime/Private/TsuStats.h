@@ -0,0 +1,7 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("TSU"), STATGROUP_Tsu, STATCAT_Advanced);
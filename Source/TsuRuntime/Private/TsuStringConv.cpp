@@ -2,6 +2,34 @@
 
 #include "TsuIsolate.h"
 
+namespace TsuStringConv_Private
+{
+
+class FExternalString final
+	: public v8::String::ExternalStringResource
+{
+public:
+	explicit FExternalString(const FTsuSharedString& InString)
+		: String(InString)
+	{
+	}
+
+	const uint16_t* data() const override
+	{
+		return reinterpret_cast<const uint16_t*>(**String);
+	}
+
+	size_t length() const override
+	{
+		return (size_t)String->Len();
+	}
+
+private:
+	FTsuSharedString String;
+};
+
+} // namespace TsuStringConv_Private
+
 v8::Local<v8::String> FTsuStringConv::To(const FString& String)
 {
 	return To(*String, String.Len());
@@ -19,6 +47,25 @@ v8::Local<v8::String> FTsuStringConv::To(const TCHAR* String, int32 Length)
 	).ToLocalChecked();
 }
 
+v8::Local<v8::String> FTsuStringConv::ToExternal(const FTsuSharedString& String)
+{
+	using namespace TsuStringConv_Private;
+
+	static_assert(sizeof(TCHAR) == sizeof(uint16_t), "Character size mismatch");
+
+	// V8 takes ownership of the resource, and disposes of it once the string is garbage collected
+	auto Resource = new FExternalString(String);
+
+	v8::Local<v8::String> Result;
+	if (!v8::String::NewExternalTwoByte(FTsuIsolate::Get(), Resource).ToLocal(&Result))
+	{
+		delete Resource;
+		return To(*String);
+	}
+
+	return Result;
+}
+
 FString FTsuStringConv::From(v8::Local<v8::String> String)
 {
 	static_assert(sizeof(uint16_t) == sizeof(TCHAR), "Character size mismatch");
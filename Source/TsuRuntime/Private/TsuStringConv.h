@@ -4,11 +4,17 @@
 
 #include "TsuV8Wrapper.h"
 
+/** An immutable string that can be handed to V8 without being copied into its heap */
+using FTsuSharedString = TSharedRef<const FString>;
+
 class FTsuStringConv
 {
 public:
 	static v8::Local<v8::String> To(const TCHAR* String, int32 Length = -1);
 	static v8::Local<v8::String> To(const FString& String);
+
+	/** Creates an external string, which refers to the shared string and keeps it alive rather than copying it */
+	static v8::Local<v8::String> ToExternal(const FTsuSharedString& String);
 	static FString From(v8::Local<v8::String> String);
 };
 
@@ -0,0 +1,150 @@
+#include "TsuTaskQueue.h"
+
+#include "TsuContext.h"
+#include "TsuRuntimeSettings.h"
+#include "TsuStats.h"
+#include "TsuTryCatch.h"
+#include "TsuWorldContextScope.h"
+
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("Task Queue"), STAT_TsuTaskQueue, STATGROUP_Tsu);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Task Queue Depth"), STAT_TsuTaskQueueDepth, STATGROUP_Tsu);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Tasks Run"), STAT_TsuTasksRun, STATGROUP_Tsu);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Task Budget Overruns"), STAT_TsuTaskBudgetOverruns, STATGROUP_Tsu);
+
+namespace TsuTaskQueue_Private
+{
+
+struct FTaskPredicate
+{
+	bool operator()(const FTsuTask& Lhs, const FTsuTask& Rhs) const
+	{
+		if (Lhs.Priority != Rhs.Priority)
+			return Lhs.Priority > Rhs.Priority;
+
+		return Lhs.Sequence < Rhs.Sequence;
+	}
+};
+
+} // namespace TsuTaskQueue_Private
+
+FTsuTaskQueue::FTsuTaskQueue(FTsuContext& InContext)
+	: FTickerObjectBase(0.f)
+	, Context(InContext)
+{
+	FWorldDelegates::OnWorldCleanup.AddRaw(this, &FTsuTaskQueue::OnWorldCleanup);
+}
+
+FTsuTaskQueue::~FTsuTaskQueue()
+{
+	FWorldDelegates::OnWorldCleanup.RemoveAll(this);
+}
+
+void FTsuTaskQueue::Schedule(
+	v8::Local<v8::Function> Callback,
+	UObject* WorldContext,
+	int32 Priority)
+{
+	using namespace TsuTaskQueue_Private;
+
+	v8::Isolate* Isolate = Callback->GetIsolate();
+
+	FTsuTask Task;
+	Task.Callback.Reset(Isolate, Callback);
+	Task.WorldContext = WorldContext;
+	Task.Priority = Priority;
+	Task.Sequence = NextSequence++;
+
+	Tasks.HeapPush(MoveTemp(Task), FTaskPredicate());
+
+	SET_DWORD_STAT(STAT_TsuTaskQueueDepth, Tasks.Num());
+}
+
+v8::Local<v8::Promise> FTsuTaskQueue::YieldFrame(v8::Local<v8::Context> InContext)
+{
+	v8::Local<v8::Promise::Resolver> Resolver = v8::Promise::Resolver::New(InContext).ToLocalChecked();
+	FrameWaiters.Emplace(InContext->GetIsolate(), Resolver);
+	return Resolver->GetPromise();
+}
+
+bool FTsuTaskQueue::Tick(float DeltaTime)
+{
+	using namespace TsuTaskQueue_Private;
+
+	if (Tasks.Num() == 0 && FrameWaiters.Num() == 0)
+		return true;
+
+	SCOPE_CYCLE_COUNTER(STAT_TsuTaskQueue);
+
+	v8::Isolate* Isolate = Context.Isolate;
+	v8::HandleScope HandleScope{Isolate};
+
+	v8::Local<v8::Context> LocalContext = Context.GlobalContext.Get(Isolate);
+	v8::Local<v8::Object> Global = LocalContext->Global();
+
+	if (FrameWaiters.Num() > 0)
+	{
+		TArray<v8::Global<v8::Promise::Resolver>> Waiters = MoveTemp(FrameWaiters);
+
+		FTsuTryCatch Catcher{Isolate};
+
+		for (v8::Global<v8::Promise::Resolver>& Waiter : Waiters)
+			Waiter.Get(Isolate)->Resolve(LocalContext, v8::Undefined(Isolate)).Check();
+
+		Isolate->RunMicrotasks();
+	}
+
+	const double Budget = GetDefault<UTsuRuntimeSettings>()->TaskBudget / 1000.0;
+	const double TimeStart = FPlatformTime::Seconds();
+
+	int32 NumTasksRun = 0;
+
+	while (Tasks.Num() > 0)
+	{
+		FTsuTask Task;
+		Tasks.HeapPop(Task, FTaskPredicate(), false);
+
+		UObject* WorldContext = Task.WorldContext.Get();
+		if (Task.WorldContext.IsStale())
+			continue;
+
+		{
+			FTsuWorldContextScope WorldScope{Context, WorldContext};
+			FTsuTryCatch Catcher{Isolate};
+
+			Task.Callback.Get(Isolate)->Call(LocalContext, Global, 0, nullptr);
+		}
+
+		++NumTasksRun;
+
+		if (FPlatformTime::Seconds() - TimeStart >= Budget)
+			break;
+	}
+
+	if (FPlatformTime::Seconds() - TimeStart > Budget)
+		INC_DWORD_STAT(STAT_TsuTaskBudgetOverruns);
+
+	INC_DWORD_STAT_BY(STAT_TsuTasksRun, NumTasksRun);
+	SET_DWORD_STAT(STAT_TsuTaskQueueDepth, Tasks.Num());
+
+	return true;
+}
+
+void FTsuTaskQueue::OnWorldCleanup(UWorld* World, bool /*bSessionEnded*/, bool /*bCleanupResources*/)
+{
+	using namespace TsuTaskQueue_Private;
+
+	const int32 NumRemoved = Tasks.RemoveAll([World](const FTsuTask& Task)
+	{
+		UObject* WorldContext = Task.WorldContext.Get();
+		return WorldContext && WorldContext->GetWorld() == World;
+	});
+
+	if (NumRemoved == 0)
+		return;
+
+	Tasks.Heapify(FTaskPredicate());
+
+	SET_DWORD_STAT(STAT_TsuTaskQueueDepth, Tasks.Num());
+}
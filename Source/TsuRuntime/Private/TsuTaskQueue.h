@@ -0,0 +1,53 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "TsuV8Wrapper.h"
+
+#include "Containers/Ticker.h"
+
+class FTsuContext;
+
+struct FTsuTask
+{
+	v8::Global<v8::Function> Callback;
+	TWeakObjectPtr<UObject> WorldContext;
+	int32 Priority = 0;
+	uint64 Sequence = 0;
+};
+
+class FTsuTaskQueue
+	: public FTickerObjectBase
+{
+public:
+	FTsuTaskQueue(FTsuContext& InContext);
+	~FTsuTaskQueue();
+
+	/**
+	 * Queues a callback to be run during one of the upcoming frames. Tasks with a higher priority
+	 * are run first, and tasks of equal priority are run in the order they were scheduled.
+	 * 
+	 * @param Callback The callback to run
+	 * @param WorldContext The world context at the time of scheduling
+	 * @param Priority The priority of the task
+	 */
+	void Schedule(v8::Local<v8::Function> Callback, UObject* WorldContext, int32 Priority);
+
+	/**
+	 * Creates a promise that will be resolved at the start of the next frame, before any tasks are run.
+	 * 
+	 * @param Context The context in which to create the promise
+	 * @returns The resulting promise
+	 */
+	v8::Local<v8::Promise> YieldFrame(v8::Local<v8::Context> Context);
+
+	bool Tick(float DeltaTime) override;
+
+private:
+	void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+
+	FTsuContext& Context;
+	TArray<FTsuTask> Tasks;
+	TArray<v8::Global<v8::Promise::Resolver>> FrameWaiters;
+	uint64 NextSequence = 0;
+};
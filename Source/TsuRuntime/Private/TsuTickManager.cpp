@@ -0,0 +1,235 @@
+#include "TsuTickManager.h"
+
+#include "TsuContext.h"
+#include "TsuStats.h"
+#include "TsuTryCatch.h"
+#include "TsuWorldContextScope.h"
+
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("Tick Dispatch"), STAT_TsuTickDispatch, STATGROUP_Tsu);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Ticking Objects"), STAT_TsuTickingObjects, STATGROUP_Tsu);
+
+void FTsuTickGroup::ExecuteTick(
+	float DeltaTime,
+	ELevelTick /*TickType*/,
+	ENamedThreads::Type /*CurrentThread*/,
+	const FGraphEventRef& /*MyCompletionGraphEvent*/)
+{
+	Manager->Dispatch(*this, DeltaTime);
+}
+
+FString FTsuTickGroup::DiagnosticMessage()
+{
+	return TEXT("FTsuTickGroup");
+}
+
+FTsuTickManager::FTsuTickManager(FTsuContext& InContext, v8::Local<v8::Function> InDispatcher)
+	: Context(InContext)
+	, Dispatcher(InDispatcher->GetIsolate(), InDispatcher)
+{
+	FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(this, &FTsuTickManager::OnPostGarbageCollect);
+	FWorldDelegates::OnWorldCleanup.AddRaw(this, &FTsuTickManager::OnWorldCleanup);
+}
+
+FTsuTickManager::~FTsuTickManager()
+{
+	FWorldDelegates::OnWorldCleanup.RemoveAll(this);
+	FCoreUObjectDelegates::GetPostGarbageCollect().RemoveAll(this);
+
+	SET_DWORD_STAT(STAT_TsuTickingObjects, 0);
+}
+
+bool FTsuTickManager::Register(
+	UObject* Object,
+	v8::Local<v8::Function> Callback,
+	ETickingGroup TickGroup)
+{
+	UWorld* World = GEngine->GetWorldFromContextObject(Object, EGetWorldErrorMode::LogAndReturnNull);
+	if (!World || !World->PersistentLevel)
+		return false;
+
+	Unregister(Object);
+
+	v8::Isolate* Isolate = Context.Isolate;
+	v8::Local<v8::Context> LocalContext = Context.GlobalContext.Get(Isolate);
+
+	TUniquePtr<FTsuTickGroup>& Group = Groups.FindOrAdd(FTickGroupKey(World, TickGroup));
+	if (!Group.IsValid())
+	{
+		Group = MakeUnique<FTsuTickGroup>();
+		Group->Manager = this;
+		Group->World = World;
+		Group->ObjectValues.Reset(Isolate, v8::Array::New(Isolate));
+		Group->Callbacks.Reset(Isolate, v8::Array::New(Isolate));
+		Group->bCanEverTick = true;
+		Group->TickGroup = TickGroup;
+		Group->EndTickGroup = TickGroup;
+		Group->RegisterTickFunction(World->PersistentLevel);
+	}
+
+	const int32 Index = Group->Objects.Add(FObjectKey(Object));
+	Group->Callbacks.Get(Isolate)->Set(LocalContext, Index, Callback).Check();
+
+	Registrations.Add(FObjectKey(Object), Group.Get());
+
+	SET_DWORD_STAT(STAT_TsuTickingObjects, Registrations.Num());
+
+	return true;
+}
+
+void FTsuTickManager::Unregister(UObject* Object)
+{
+	const FObjectKey ObjectKey{Object};
+
+	FTsuTickGroup* Group = nullptr;
+	if (!Registrations.RemoveAndCopyValue(ObjectKey, Group))
+		return;
+
+	const int32 Index = Group->Objects.IndexOfByKey(ObjectKey);
+	if (ensure(Index != INDEX_NONE))
+	{
+		v8::HandleScope HandleScope{Context.Isolate};
+		RemoveAt(*Group, Index);
+	}
+
+	SET_DWORD_STAT(STAT_TsuTickingObjects, Registrations.Num());
+}
+
+void FTsuTickManager::Dispatch(FTsuTickGroup& Group, float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_TsuTickDispatch);
+
+	UWorld* World = Group.World.Get();
+	if (!World || Group.Objects.Num() == 0)
+		return;
+
+	v8::Isolate* Isolate = Context.Isolate;
+	v8::HandleScope HandleScope{Isolate};
+
+	RemoveStaleObjects(Group);
+
+	const int32 NumObjects = Group.Objects.Num();
+	if (NumObjects == 0)
+		return;
+
+	v8::Local<v8::Context> LocalContext = Context.GlobalContext.Get(Isolate);
+
+	FTsuWorldContextScope WorldScope{Context, World};
+
+	// The wrappers are looked up for every dispatch rather than held on to, since the context keeps the objects of
+	// any live wrappers referenced, which would stop registered objects from ever being garbage collected
+	v8::Local<v8::Array> ObjectValues = Group.ObjectValues.Get(Isolate);
+	for (int32 Index = 0; Index < NumObjects; ++Index)
+	{
+		v8::Local<v8::Value> ObjectValue = Context.ReferenceClassObject(Group.Objects[Index].ResolveObjectPtr());
+		ObjectValues->Set(LocalContext, Index, ObjectValue).Check();
+	}
+
+	// The object and callback arrays are kept alive between frames and are only ever appended to or
+	// swapped around in, so the dispatcher is told how many of the elements are actually in use.
+	v8::Local<v8::Value> Arguments[] = {
+		ObjectValues,
+		Group.Callbacks.Get(Isolate),
+		v8::Integer::New(Isolate, NumObjects),
+		v8::Number::New(Isolate, DeltaTime)
+	};
+
+	{
+		TGuardValue<bool> DispatchingGuard{Group.bDispatching, true};
+		FTsuTryCatch Catcher{Isolate};
+
+		Dispatcher.Get(Isolate)->Call(
+			LocalContext,
+			LocalContext->Global(),
+			ARRAY_COUNT(Arguments),
+			Arguments);
+	}
+
+	for (int32 Index = 0; Index < NumObjects; ++Index)
+		ObjectValues->Set(LocalContext, Index, v8::Undefined(Isolate)).Check();
+
+	if (Group.bHasClearedSlots)
+	{
+		Group.bHasClearedSlots = false;
+
+		for (int32 Index = Group.Objects.Num() - 1; Index >= 0; --Index)
+		{
+			if (Group.Objects[Index] == FObjectKey())
+				RemoveAt(Group, Index);
+		}
+	}
+}
+
+void FTsuTickManager::RemoveAt(FTsuTickGroup& Group, int32 Index)
+{
+	v8::Isolate* Isolate = Context.Isolate;
+	v8::Local<v8::Context> LocalContext = Context.GlobalContext.Get(Isolate);
+
+	v8::Local<v8::Array> Callbacks = Group.Callbacks.Get(Isolate);
+
+	// Swapping in the last element while dispatching would move an object to an index that the dispatcher has already
+	// passed, and out of step with its wrapper, so the slot is only cleared until the dispatch is done
+	if (Group.bDispatching)
+	{
+		Callbacks->Set(LocalContext, Index, v8::Undefined(Isolate)).Check();
+		Group.Objects[Index] = FObjectKey();
+		Group.bHasClearedSlots = true;
+		return;
+	}
+
+	const int32 LastIndex = Group.Objects.Num() - 1;
+	if (Index != LastIndex)
+		Callbacks->Set(LocalContext, Index, Callbacks->Get(LocalContext, LastIndex).ToLocalChecked()).Check();
+
+	// Clear the last slot so that the callback can be collected
+	Callbacks->Set(LocalContext, LastIndex, v8::Undefined(Isolate)).Check();
+
+	Group.Objects.RemoveAtSwap(Index, 1, false);
+}
+
+void FTsuTickManager::RemoveStaleObjects(FTsuTickGroup& Group)
+{
+	for (int32 Index = Group.Objects.Num() - 1; Index >= 0; --Index)
+	{
+		const FObjectKey ObjectKey = Group.Objects[Index];
+		if (ObjectKey.ResolveObjectPtr() == nullptr)
+		{
+			Registrations.Remove(ObjectKey);
+			RemoveAt(Group, Index);
+		}
+	}
+
+	SET_DWORD_STAT(STAT_TsuTickingObjects, Registrations.Num());
+}
+
+void FTsuTickManager::OnPostGarbageCollect()
+{
+	v8::HandleScope HandleScope{Context.Isolate};
+
+	for (auto Iter = Groups.CreateIterator(); Iter; ++Iter)
+	{
+		FTsuTickGroup& Group = *Iter->Value;
+		RemoveStaleObjects(Group);
+
+		if (Group.Objects.Num() == 0)
+			Iter.RemoveCurrent();
+	}
+}
+
+void FTsuTickManager::OnWorldCleanup(UWorld* World, bool /*bSessionEnded*/, bool /*bCleanupResources*/)
+{
+	for (auto Iter = Groups.CreateIterator(); Iter; ++Iter)
+	{
+		if (Iter->Key.Get<0>() != World)
+			continue;
+
+		for (const FObjectKey& ObjectKey : Iter->Value->Objects)
+			Registrations.Remove(ObjectKey);
+
+		Iter.RemoveCurrent();
+	}
+
+	SET_DWORD_STAT(STAT_TsuTickingObjects, Registrations.Num());
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "TsuV8Wrapper.h"
+
+#include "Engine/EngineBaseTypes.h"
+#include "UObject/ObjectKey.h"
+
+class FTsuContext;
+class FTsuTickManager;
+
+struct FTsuTickGroup
+	: public FTickFunction
+{
+	void ExecuteTick(
+		float DeltaTime,
+		ELevelTick TickType,
+		ENamedThreads::Type CurrentThread,
+		const FGraphEventRef& MyCompletionGraphEvent) override;
+
+	FString DiagnosticMessage() override;
+
+	FTsuTickManager* Manager = nullptr;
+	TWeakObjectPtr<UWorld> World;
+	TArray<FObjectKey> Objects;
+
+	/** Only filled in for the duration of a dispatch, since the wrappers would otherwise keep the objects alive */
+	v8::Global<v8::Array> ObjectValues;
+	v8::Global<v8::Array> Callbacks;
+
+	/** Objects removed while dispatching only have their slots cleared, and are compacted once the dispatch is done */
+	bool bDispatching = false;
+	bool bHasClearedSlots = false;
+};
+
+class FTsuTickManager
+{
+	friend struct FTsuTickGroup;
+
+	using FTickGroupKey = TTuple<UWorld*, ETickingGroup>;
+
+public:
+	/**
+	 * @param Context The context that owns the tick manager
+	 * @param Dispatcher The script function that runs all the callbacks of a tick group
+	 */
+	FTsuTickManager(FTsuContext& Context, v8::Local<v8::Function> Dispatcher);
+	~FTsuTickManager();
+
+	FTsuTickManager(const FTsuTickManager& Other) = delete;
+	FTsuTickManager& operator=(const FTsuTickManager& Other) = delete;
+
+	/**
+	 * Registers a callback to be called every frame, during the specified tick group of the object's world.
+	 * Registering an object that is already registered will replace its callback.
+	 * 
+	 * @param Object The object to register
+	 * @param Callback The callback to call
+	 * @param TickGroup The tick group in which to call the callback
+	 * @returns Whether the object was successfully registered
+	 */
+	bool Register(
+		UObject* Object,
+		v8::Local<v8::Function> Callback,
+		ETickingGroup TickGroup);
+
+	/** Unregisters the callback of an object, if it has one */
+	void Unregister(UObject* Object);
+
+private:
+	void Dispatch(FTsuTickGroup& Group, float DeltaTime);
+	void RemoveAt(FTsuTickGroup& Group, int32 Index);
+	void RemoveStaleObjects(FTsuTickGroup& Group);
+
+	void OnPostGarbageCollect();
+	void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+
+	FTsuContext& Context;
+	v8::Global<v8::Function> Dispatcher;
+	TMap<FTickGroupKey, TUniquePtr<FTsuTickGroup>> Groups;
+	TMap<FObjectKey, FTsuTickGroup*> Registrations;
+};
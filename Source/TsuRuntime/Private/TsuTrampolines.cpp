@@ -0,0 +1,615 @@
+#include "TsuTrampolines.h"
+
+#include "TsuContext.h"
+#include "TsuObjectLibrary.h"
+#include "TsuRotatorLibrary.h"
+#include "TsuStringConv.h"
+#include "TsuTransformLibrary.h"
+#include "TsuVectorLibrary.h"
+
+#include "Templates/IntegerSequence.h"
+#include "Templates/Tuple.h"
+#include "UObject/Class.h"
+
+// Written by the TSU generator, when it's enabled for at least one module
+#if defined(__has_include)
+#if __has_include("TsuGeneratedBindings.inl")
+#define TSU_WITH_GENERATED_BINDINGS 1
+#endif
+#endif
+
+#ifndef TSU_WITH_GENERATED_BINDINGS
+#define TSU_WITH_GENERATED_BINDINGS 0
+#endif
+
+#if TSU_WITH_GENERATED_BINDINGS
+#include "TsuGeneratedHeaders.inl"
+#endif // TSU_WITH_GENERATED_BINDINGS
+
+template<typename T, typename Enable>
+struct FTsuTrampolines::TValue
+{
+	// Only the structs with a TBaseStructure specialization are supported
+	static_assert(TIsClass<T>::Value, "Unsupported trampoline type");
+
+	static bool Read(v8::Local<v8::Value> InValue, T& OutValue)
+	{
+		v8::Local<v8::Value> Value = FTsuContext::Singleton->UnwrapStructProxy(InValue);
+		if (!Value->IsObject() || Value.As<v8::Object>()->InternalFieldCount() != 2)
+			return false;
+
+		auto Type = static_cast<UStruct*>(Value.As<v8::Object>()->GetAlignedPointerFromInternalField(1));
+		if (Type != TBaseStructure<T>::Get())
+			return false;
+
+		OutValue = *static_cast<T*>(Value.As<v8::Object>()->GetAlignedPointerFromInternalField(0));
+		return true;
+	}
+
+	static v8::Local<v8::Value> Write(const T& Value)
+	{
+		UScriptStruct* Type = TBaseStructure<T>::Get();
+
+		void* Object = FMemory::Malloc(Type->GetStructureSize());
+		Type->InitializeStruct(Object);
+		*static_cast<T*>(Object) = Value;
+
+		return FTsuContext::Singleton->ReferenceStructObject(Object, Type);
+	}
+};
+
+template<>
+struct FTsuTrampolines::TValue<float>
+{
+	static bool Read(v8::Local<v8::Value> Value, float& OutValue)
+	{
+		if (!Value->IsNumber())
+			return false;
+
+		OutValue = (float)Value.As<v8::Number>()->Value();
+		return true;
+	}
+
+	static v8::Local<v8::Value> Write(float Value)
+	{
+		return v8::Number::New(FTsuContext::Isolate, (double)Value);
+	}
+};
+
+template<>
+struct FTsuTrampolines::TValue<int32>
+{
+	static bool Read(v8::Local<v8::Value> Value, int32& OutValue)
+	{
+		if (!Value->IsNumber())
+			return false;
+
+		OutValue = (int32)Value.As<v8::Number>()->Value();
+		return true;
+	}
+
+	static v8::Local<v8::Value> Write(int32 Value)
+	{
+		return v8::Number::New(FTsuContext::Isolate, (double)Value);
+	}
+};
+
+template<>
+struct FTsuTrampolines::TValue<uint8>
+{
+	static bool Read(v8::Local<v8::Value> Value, uint8& OutValue)
+	{
+		if (!Value->IsNumber())
+			return false;
+
+		OutValue = (uint8)Value.As<v8::Number>()->Value();
+		return true;
+	}
+
+	static v8::Local<v8::Value> Write(uint8 Value)
+	{
+		return v8::Number::New(FTsuContext::Isolate, (double)Value);
+	}
+};
+
+template<>
+struct FTsuTrampolines::TValue<bool>
+{
+	static bool Read(v8::Local<v8::Value> Value, bool& OutValue)
+	{
+		if (!Value->IsBoolean())
+			return false;
+
+		OutValue = Value.As<v8::Boolean>()->Value();
+		return true;
+	}
+
+	static v8::Local<v8::Value> Write(bool Value)
+	{
+		return v8::Boolean::New(FTsuContext::Isolate, Value);
+	}
+};
+
+template<>
+struct FTsuTrampolines::TValue<FString>
+{
+	static bool Read(v8::Local<v8::Value> Value, FString& OutValue)
+	{
+		if (!Value->IsString())
+			return false;
+
+		OutValue = V8_TO_TCHAR(Value.As<v8::String>());
+		return true;
+	}
+
+	static v8::Local<v8::Value> Write(const FString& Value)
+	{
+		return TCHAR_TO_V8(Value);
+	}
+};
+
+template<typename T>
+struct FTsuTrampolines::TValue<T*, typename TEnableIf<TIsDerivedFrom<typename TRemoveConst<T>::Type, UObject>::IsDerived>::Type>
+{
+	static bool Read(v8::Local<v8::Value> Value, T*& OutValue)
+	{
+		if (Value->IsNull())
+		{
+			OutValue = nullptr;
+			return true;
+		}
+
+		if (!Value->IsObject() || Value.As<v8::Object>()->InternalFieldCount() != 2)
+			return false;
+
+		auto Object = static_cast<UObject*>(Value.As<v8::Object>()->GetAlignedPointerFromInternalField(0));
+		auto Type = static_cast<UStruct*>(Value.As<v8::Object>()->GetAlignedPointerFromInternalField(1));
+
+		// Structs share the same internal field layout, so make sure this is actually an object
+		if (!Type->IsA<UClass>())
+			return false;
+
+		OutValue = Cast<typename TRemoveConst<T>::Type>(Object);
+		return OutValue || !Object;
+	}
+
+	static v8::Local<v8::Value> Write(T* Value)
+	{
+		return FTsuContext::Singleton->ReferenceClassObject(const_cast<typename TRemoveConst<T>::Type*>(Value));
+	}
+};
+
+template<typename ReturnType, typename... ArgTypes, ReturnType(*Function)(ArgTypes...)>
+struct FTsuTrampolines::TTrampoline<ReturnType(*)(ArgTypes...), Function>
+{
+	using FArgs = TTuple<typename TDecay<ArgTypes>::Type...>;
+
+	static constexpr int32 NumArgs = sizeof...(ArgTypes);
+
+	static void CallMethod(const v8::FunctionCallbackInfo<v8::Value>& Info)
+	{
+		if (!Call(Info, TMakeIntegerSequence<uint32, NumArgs>{}, 1))
+			FTsuContext::_OnCallExtensionMethod(Info);
+	}
+
+	static void CallStatic(const v8::FunctionCallbackInfo<v8::Value>& Info)
+	{
+		if (!Call(Info, TMakeIntegerSequence<uint32, NumArgs>{}, 0))
+			FTsuContext::_OnCallStaticMethod(Info);
+	}
+
+private:
+	static v8::Local<v8::Value> GetArg(
+		const v8::FunctionCallbackInfo<v8::Value>& Info,
+		uint32 Index,
+		uint32 ThisOffset)
+	{
+		return Index < ThisOffset ? Info.This().As<v8::Value>() : Info[Index - ThisOffset];
+	}
+
+	template<uint32... Indices>
+	static bool Call(
+		const v8::FunctionCallbackInfo<v8::Value>& Info,
+		TIntegerSequence<uint32, Indices...>,
+		uint32 ThisOffset)
+	{
+		// Anything other than an exact match is left to the reflection path, which deals with default values
+		if (Info.Length() + (int32)ThisOffset != NumArgs)
+			return false;
+
+		FArgs Args;
+
+		bool bReadArgs = true;
+		(void)std::initializer_list<int32>{(bReadArgs = bReadArgs
+			&& TValue<typename TDecay<ArgTypes>::Type>::Read(GetArg(Info, Indices, ThisOffset), Args.template Get<Indices>()),
+			0)...};
+
+		if (!bReadArgs)
+			return false;
+
+		Return(Info, Args, TIntegerSequence<uint32, Indices...>{});
+		return true;
+	}
+
+	template<uint32... Indices, typename T = ReturnType>
+	static typename TEnableIf<!TIsVoidType<T>::Value>::Type Return(
+		const v8::FunctionCallbackInfo<v8::Value>& Info,
+		FArgs& Args,
+		TIntegerSequence<uint32, Indices...>)
+	{
+		Info.GetReturnValue().Set(TValue<typename TDecay<T>::Type>::Write(Function(Args.template Get<Indices>()...)));
+	}
+
+	template<uint32... Indices, typename T = ReturnType>
+	static typename TEnableIf<TIsVoidType<T>::Value>::Type Return(
+		const v8::FunctionCallbackInfo<v8::Value>& Info,
+		FArgs& Args,
+		TIntegerSequence<uint32, Indices...>)
+	{
+		Function(Args.template Get<Indices>()...);
+	}
+};
+
+template<
+	typename FunctionType,
+	FunctionType Function,
+	typename ClassType,
+	typename ReturnType,
+	typename... ArgTypes>
+struct FTsuTrampolines::TMemberTrampoline
+{
+	using FArgs = TTuple<typename TDecay<ArgTypes>::Type...>;
+
+	static constexpr int32 NumArgs = sizeof...(ArgTypes);
+
+	static void CallMethod(const v8::FunctionCallbackInfo<v8::Value>& Info)
+	{
+		if (!Call(Info, TMakeIntegerSequence<uint32, NumArgs>{}))
+			FTsuContext::_OnCallMethod(Info);
+	}
+
+	static void CallStatic(const v8::FunctionCallbackInfo<v8::Value>& Info)
+	{
+		// Member functions are never bound as static functions
+		FTsuContext::_OnCallStaticMethod(Info);
+	}
+
+private:
+	template<uint32... Indices>
+	static bool Call(
+		const v8::FunctionCallbackInfo<v8::Value>& Info,
+		TIntegerSequence<uint32, Indices...>)
+	{
+		if (Info.Length() != NumArgs)
+			return false;
+
+		ClassType* Object = nullptr;
+		if (!TValue<ClassType*>::Read(Info.This(), Object) || !Object)
+			return false;
+
+		FArgs Args;
+
+		bool bReadArgs = true;
+		(void)std::initializer_list<int32>{(bReadArgs = bReadArgs
+			&& TValue<typename TDecay<ArgTypes>::Type>::Read(Info[Indices], Args.template Get<Indices>()),
+			0)...};
+
+		if (!bReadArgs)
+			return false;
+
+		Return(Info, Object, Args, TIntegerSequence<uint32, Indices...>{});
+		return true;
+	}
+
+	template<uint32... Indices, typename T = ReturnType>
+	static typename TEnableIf<!TIsVoidType<T>::Value>::Type Return(
+		const v8::FunctionCallbackInfo<v8::Value>& Info,
+		ClassType* Object,
+		FArgs& Args,
+		TIntegerSequence<uint32, Indices...>)
+	{
+		Info.GetReturnValue().Set(TValue<typename TDecay<T>::Type>::Write((Object->*Function)(Args.template Get<Indices>()...)));
+	}
+
+	template<uint32... Indices, typename T = ReturnType>
+	static typename TEnableIf<TIsVoidType<T>::Value>::Type Return(
+		const v8::FunctionCallbackInfo<v8::Value>& Info,
+		ClassType* Object,
+		FArgs& Args,
+		TIntegerSequence<uint32, Indices...>)
+	{
+		(Object->*Function)(Args.template Get<Indices>()...);
+	}
+};
+
+template<typename ClassType, typename ReturnType, typename... ArgTypes, ReturnType(ClassType::*Function)(ArgTypes...)>
+struct FTsuTrampolines::TTrampoline<ReturnType(ClassType::*)(ArgTypes...), Function>
+	: public TMemberTrampoline<ReturnType(ClassType::*)(ArgTypes...), Function, ClassType, ReturnType, ArgTypes...>
+{
+};
+
+template<typename ClassType, typename ReturnType, typename... ArgTypes, ReturnType(ClassType::*Function)(ArgTypes...) const>
+struct FTsuTrampolines::TTrampoline<ReturnType(ClassType::*)(ArgTypes...) const, Function>
+	: public TMemberTrampoline<ReturnType(ClassType::*)(ArgTypes...) const, Function, ClassType, ReturnType, ArgTypes...>
+{
+};
+
+template<typename ClassType, typename ValueType, ValueType ClassType::*Member>
+struct FTsuTrampolines::TPropertyTrampoline<ValueType ClassType::*, Member>
+{
+	static void Get(const v8::FunctionCallbackInfo<v8::Value>& Info)
+	{
+		ClassType* Object = nullptr;
+		if (!TValue<ClassType*>::Read(Info.This(), Object) || !Object)
+		{
+			FTsuContext::_OnPropertyGet(Info);
+			return;
+		}
+
+		Info.GetReturnValue().Set(TValue<ValueType>::Write(Object->*Member));
+	}
+
+	static void Set(const v8::FunctionCallbackInfo<v8::Value>& Info)
+	{
+		ClassType* Object = nullptr;
+		ValueType Value;
+
+		if (Info.Length() != 1
+			|| !TValue<ClassType*>::Read(Info.This(), Object)
+			|| !Object
+			|| !TValue<ValueType>::Read(Info[0], Value))
+		{
+			FTsuContext::_OnPropertySet(Info);
+			return;
+		}
+
+		Object->*Member = Value;
+	}
+};
+
+#define TSU_TRAMPOLINE(Class, Name)                                                 \
+	Entries.Add(                                                                    \
+		FEntryKey{Class::StaticClass(), GET_FUNCTION_NAME_CHECKED(Class, Name)},    \
+		FEntry{                                                                     \
+			&TTrampoline<decltype(&Class::Name), &Class::Name>::CallMethod,         \
+			&TTrampoline<decltype(&Class::Name), &Class::Name>::CallStatic})
+
+// Used by the generated bindings, where the exact function pointer type picks out the function from any C++
+// overloads of the same name, which also rules out taking its address with GET_FUNCTION_NAME_CHECKED
+#define TSU_TYPED_TRAMPOLINE(Class, Name, ...)                                      \
+	Entries.Add(                                                                    \
+		FEntryKey{Class::StaticClass(), FName(TEXT(#Name))},                        \
+		FEntry{                                                                     \
+			&TTrampoline<__VA_ARGS__, &Class::Name>::CallMethod,                    \
+			&TTrampoline<__VA_ARGS__, &Class::Name>::CallStatic})
+
+#define TSU_PROPERTY_TRAMPOLINE(Class, Name)                                        \
+	Entries.Add(                                                                    \
+		FEntryKey{Class::StaticClass(), GET_MEMBER_NAME_CHECKED(Class, Name)},      \
+		FEntry{                                                                     \
+			&TPropertyTrampoline<decltype(&Class::Name), &Class::Name>::Get,        \
+			&TPropertyTrampoline<decltype(&Class::Name), &Class::Name>::Set})
+
+TMap<FTsuTrampolines::FEntryKey, FTsuTrampolines::FEntry> FTsuTrampolines::CreateEntries()
+{
+	TMap<FEntryKey, FEntry> Entries;
+
+	TSU_TRAMPOLINE(UTsuVectorLibrary, Cross);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, Dot);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, Add);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, AddFloat);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, Subtract);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, SubtractFloat);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, Divide);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, DivideFloat);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, Multiply);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, MultiplyFloat);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, Equals);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, AllComponentsEqual);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, Negate);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, Component);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, GetMax);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, GetAbsMax);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, GetMin);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, GetAbsMin);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, ComponentMin);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, ComponentMax);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, GetAbs);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, Length);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, LengthSquared);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, Length2D);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, LengthSquared2D);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, IsNearlyZero);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, IsZero);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, IsNormalized);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, GetSignVector);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, Projection);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, GetUnsafeNormal);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, GridSnap);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, BoundToCube);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, GetClampedToLength);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, GetClampedToLength2D);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, GetClampedToMaxLength);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, GetClampedToMaxLength2D);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, AddBounded);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, Reciprocal);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, IsUniform);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, MirrorByVector);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, RotateAngleAxis);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, GetSafeNormal);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, GetSafeNormal2D);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, CosineAngle2D);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, ProjectOnTo);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, ProjectOnToNormal);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, ToRotator);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, ToQuat);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, UnwindEuler);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, ContainsNaN);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, IsUnit);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, ToString);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, ToCompactString);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, UnitCartesianToSpherical);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, HeadingAngle);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, PointsAreSame);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, PointsAreNear);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, PointPlaneDist);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, VectorPlaneProject);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, Dist);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, Dist2D);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, DistSquared);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, DistSquared2D);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, BoxPushOut);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, Parallel);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, Coincident);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, Orthogonal);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, Coplanar);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, Triple);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, RadiansToDegrees);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, DegreesToRadians);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, Clone);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, Lerp);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, InterpTo);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, InterpToConstant);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, WithX);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, WithY);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, WithZ);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, Zero);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, One);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, Up);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, Down);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, Forward);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, Backward);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, Right);
+	TSU_TRAMPOLINE(UTsuVectorLibrary, Left);
+
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, Add);
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, AddFloats);
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, Subtract);
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, Scale);
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, IsNearlyZero);
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, IsZero);
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, Equals);
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, GetInverse);
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, GridSnap);
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, ToVector);
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, ToQuaternion);
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, ToEuler);
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, RotateVector);
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, UnrotateVector);
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, Clamp);
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, GetNormalized);
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, GetDenormalized);
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, ToString);
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, ToCompactString);
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, ContainsNaN);
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, Random);
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, ClampAxis);
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, NormalizeAxis);
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, CompressAxisToByte);
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, DecompressAxisFromByte);
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, CompressAxisToShort);
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, DecompressAxisFromShort);
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, MakeFromEuler);
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, GetForwardVector);
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, GetRightVector);
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, GetUpVector);
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, Lerp);
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, InterpTo);
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, InterpToConstant);
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, Compose);
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, WithPitch);
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, WithYaw);
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, WithRoll);
+	TSU_TRAMPOLINE(UTsuRotatorLibrary, ZeroRotator);
+
+	TSU_TRAMPOLINE(UTsuTransformLibrary, ToHumanReadableString);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, ToString);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, Inverse);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, BlendedWith);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, Multiply);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, AnyHasNegativeScale);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, ScaleLocation);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, ScaleLocationFloat);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, RemoveScaling);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, GetMaximumAxisScale);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, GetMinimumAxisScale);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, GetRelativeTransform);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, GetRelativeTransformReverse);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, TransformLocation);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, TransformLocationNoScale);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, InverseTransformLocation);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, InverseTransformLocationNoScale);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, TransformDirection);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, TransformDirectionNoScale);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, InverseTransformDirection);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, InverseTransformDirectionNoScale);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, TransformRotation);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, InverseTransformRotation);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, GetSafeScaleReciprocal);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, GetDeterminant);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, ContainsNaN);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, IsValid);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, RotationEquals);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, LocationEquals);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, ScaleEquals);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, Equals);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, EqualsNoScale);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, MultiplyScale);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, MultiplyScaleFloat);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, ConcatenateRotation);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, AddToLocation);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, AddTranslations);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, SubtractTranslations);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, Accumulate);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, NormalizeRotation);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, IsRotationNormalized);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, InterpTo);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, WithLocation);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, WithScale);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, WithRotation);
+	TSU_TRAMPOLINE(UTsuTransformLibrary, Identity);
+
+	TSU_TRAMPOLINE(UTsuObjectLibrary, IsValid);
+	TSU_TRAMPOLINE(UTsuObjectLibrary, GetName);
+	TSU_TRAMPOLINE(UTsuObjectLibrary, GetPathName);
+	TSU_TRAMPOLINE(UTsuObjectLibrary, GetDisplayName);
+	TSU_TRAMPOLINE(UTsuObjectLibrary, GetClass);
+	TSU_TRAMPOLINE(UTsuObjectLibrary, Equals);
+
+#if TSU_WITH_GENERATED_BINDINGS
+#include "TsuGeneratedBindings.inl"
+#endif // TSU_WITH_GENERATED_BINDINGS
+
+	return Entries;
+}
+
+#undef TSU_PROPERTY_TRAMPOLINE
+#undef TSU_TYPED_TRAMPOLINE
+#undef TSU_TRAMPOLINE
+
+const FTsuTrampolines::FEntry* FTsuTrampolines::FindEntry(UClass* Class, FName Name)
+{
+	static const TMap<FEntryKey, FEntry> Entries = CreateEntries();
+	return Entries.Find(FEntryKey{Class, Name});
+}
+
+v8::FunctionCallback FTsuTrampolines::Find(UFunction* Function, bool bIsMethod)
+{
+	const FEntry* Entry = FindEntry(Function->GetOwnerClass(), Function->GetFName());
+	if (!Entry)
+		return nullptr;
+
+	return bIsMethod ? Entry->First : Entry->Second;
+}
+
+v8::FunctionCallback FTsuTrampolines::FindGetter(UProperty* Property)
+{
+	const FEntry* Entry = FindEntry(Property->GetOwnerClass(), Property->GetFName());
+	return Entry ? Entry->First : nullptr;
+}
+
+v8::FunctionCallback FTsuTrampolines::FindSetter(UProperty* Property)
+{
+	const FEntry* Entry = FindEntry(Property->GetOwnerClass(), Property->GetFName());
+	return Entry ? Entry->Second : nullptr;
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "TsuV8Wrapper.h"
+
+/**
+ * Typed V8 callbacks for functions and properties, which call the native C++ function or access the C++ member
+ * directly instead of going through a parameter buffer and `UFunction::Invoke`.
+ *
+ * Trampolines are registered for the TSU extension libraries, as well as for whatever the TSU generator has exported
+ * from the modules listed under `[TsuGenerator]` in the engine config.
+ *
+ * Each trampoline falls back to the reflection-based callbacks on `FTsuContext` whenever the arguments can't be
+ * converted, e.g. when arguments are omitted in favor of their default values.
+ */
+class FTsuTrampolines
+{
+public:
+	/**
+	 * Finds the trampoline for a given function, if there is one.
+	 *
+	 * @param Function The function
+	 * @param bIsMethod Whether the function is bound as a method, with `this` as the object or first parameter
+	 * @returns The trampoline, or `nullptr` if the function has none
+	 */
+	static v8::FunctionCallback Find(UFunction* Function, bool bIsMethod);
+
+	/**
+	 * Finds the getter trampoline for a given property, if there is one.
+	 *
+	 * @param Property The property
+	 * @returns The trampoline, or `nullptr` if the property has none
+	 */
+	static v8::FunctionCallback FindGetter(UProperty* Property);
+
+	/**
+	 * Finds the setter trampoline for a given property, if there is one.
+	 *
+	 * @param Property The property
+	 * @returns The trampoline, or `nullptr` if the property has none
+	 */
+	static v8::FunctionCallback FindSetter(UProperty* Property);
+
+private:
+	struct FEntry
+	{
+		v8::FunctionCallback First = nullptr;
+		v8::FunctionCallback Second = nullptr;
+	};
+
+	using FEntryKey = TPair<UClass*, FName>;
+
+	static const FEntry* FindEntry(UClass* Class, FName Name);
+
+	static TMap<FEntryKey, FEntry> CreateEntries();
+
+	template<typename T, typename Enable = void>
+	struct TValue;
+
+	template<typename FunctionType, FunctionType Function>
+	struct TTrampoline;
+
+	template<
+		typename FunctionType,
+		FunctionType Function,
+		typename ClassType,
+		typename ReturnType,
+		typename... ArgTypes>
+	struct TMemberTrampoline;
+
+	template<typename MemberType, MemberType Member>
+	struct TPropertyTrampoline;
+};
@@ -1,55 +1,47 @@
 #include "TsuTypeIndex.h"
 
-#include "TsuReflection.h"
-#include "TsuRuntimeLog.h"
-#include "TsuTypings.h"
+#include "TsuReflectionDatabase.h"
 
-#include "Editor.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "Misc/PackageName.h"
 #include "UObject/UObjectGlobals.h"
 
-FTsuTypeIndex::FTsuTypeIndex()
+UField* FTsuTypeIndex::Find(const FString& TypeName)
 {
-	Index.Reserve(1024);
-
-	FTsuReflection::VisitAllTypes([&](UField* Type, const FTsuTypeSet& /*References*/)
-	{
-		Index.Emplace(FTsuTypings::TailorNameOfType(Type), Type);
-	});
+	UField* Result = FindLoaded(TypeName);
 
-#if WITH_EDITOR
-	if (GEditor)
+	// If we can't find the type, we assume that it's a not-yet-loaded blueprint
+	if (!Result)
 	{
-		GEditor->OnBlueprintPreCompile().AddLambda([this](UBlueprint* Blueprint)
-		{
-			if (auto GeneratedClass = Cast<UBlueprintGeneratedClass>(Blueprint->GeneratedClass))
-				Index.FindOrAdd(FTsuTypings::TailorNameOfType(GeneratedClass)) = GeneratedClass;
-		});
+		const FSoftObjectPath ClassPath = FindBlueprintClassPath(TypeName);
+		if (ClassPath.IsValid())
+			Result = LoadObject<UBlueprintGeneratedClass>(nullptr, *ClassPath.ToString());
 	}
-#endif // WITH_EDITOR
+
+	return Result;
 }
 
-UField* FTsuTypeIndex::Find(const FString& TypeName)
+UField* FTsuTypeIndex::FindLoaded(const FString& TypeName)
 {
-	UField* Result = Index.FindRef(TypeName);
+	UField* Result = FTsuReflectionDatabase::Get().FindType(TypeName);
 
 	// If we can't find the type, we assume that it's a not-yet-indexed blueprint
 	if (!Result)
 	{
 		const FString ClassName = FString::Printf(TEXT("%s_C"), *TypeName);
 		Result = FindObject<UBlueprintGeneratedClass>(ANY_PACKAGE, *ClassName, true);
-		if (!Result)
-		{
-			const FString ShortPackagePath = FString::Printf(TEXT("%s.%s"), *TypeName, *ClassName);
-			FString LongPackagePath;
-			if (FPackageName::TryConvertShortPackagePathToLongInObjectPath(ShortPackagePath, LongPackagePath))
-				Result = LoadObject<UBlueprintGeneratedClass>(nullptr, *LongPackagePath);
-		}
-
-		if (Result)
-			Index.Add(TypeName) = Result;
 	}
 
 	return Result;
 }
+
+FSoftObjectPath FTsuTypeIndex::FindBlueprintClassPath(const FString& TypeName)
+{
+	const FString ShortPackagePath = FString::Printf(TEXT("%s.%s_C"), *TypeName, *TypeName);
+
+	FString LongPackagePath;
+	if (!FPackageName::TryConvertShortPackagePathToLongInObjectPath(ShortPackagePath, LongPackagePath))
+		return {};
+
+	return FSoftObjectPath{LongPackagePath};
+}
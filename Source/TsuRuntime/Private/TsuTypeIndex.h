@@ -3,14 +3,21 @@
 #include "CoreMinimal.h"
 
 #include "Engine/Blueprint.h"
+#include "UObject/SoftObjectPath.h"
 
+/**
+ * Looks up types by their script name through `FTsuReflectionDatabase`, falling back to finding or loading
+ * Blueprints that haven't been indexed yet.
+ */
 class FTsuTypeIndex
 {
 public:
-	FTsuTypeIndex();
-
+	/** Finds a type by name, loading it synchronously if it's a Blueprint that isn't loaded yet */
 	UField* Find(const FString& TypeName);
 
-private:
-	TMap<FString, UField*> Index;
+	/** Finds a type by name, without loading anything */
+	UField* FindLoaded(const FString& TypeName);
+
+	/** Finds the path of a Blueprint class by the name of its type, without loading it */
+	FSoftObjectPath FindBlueprintClassPath(const FString& TypeName);
 };
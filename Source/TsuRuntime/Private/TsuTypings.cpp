@@ -4,12 +4,18 @@
 #include "TsuPaths.h"
 #include "TsuReflection.h"
 #include "TsuRuntimeLog.h"
+#include "TsuRuntimeSettings.h"
 #include "TsuUtilities.h"
 
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
 #include "Engine/Engine.h"
 #include "HAL/PlatformFilemanager.h"
+#include "Hash/CityHash.h"
 #include "Internationalization/Regex.h"
 #include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/ScopeLock.h"
 #include "UObject/EnumProperty.h"
 #include "UObject/Package.h"
 #include "UObject/TextProperty.h"
@@ -21,6 +27,341 @@
 #define TSU_WRITEF(Format, ...) Output.Append(FString::Printf(TEXT(Format), __VA_ARGS__))
 #define TSU_WRITELNF(Format, ...) TSU_WRITEF(Format "\n", __VA_ARGS__)
 
+namespace TsuTypings_Private
+{
+
+// Bump whenever the typings output changes, to invalidate the typings of native types
+const TCHAR* TypingsVersion = TEXT("1");
+
+// Reading metadata can lazily create the UMetaData of a package, which isn't safe to do off the game thread, so any
+// tooltips are gathered along with the jobs and the worker threads only format them
+struct FTypingsMetaData
+{
+	TMap<const UField*, FString> ToolTips;
+	TArray<FString> EnumToolTips;
+};
+
+struct FTypingsJob
+{
+	UField* Type = nullptr;
+	FString TypeName;
+	FString BundleName;
+	TArray<UField*> References;
+	FTypingsMetaData MetaData;
+	FString Output;
+	uint64 Hash = 0;
+};
+
+uint32 Generation = 0;
+
+// The gathered metadata of the job being generated on this thread, if any
+thread_local const FTypingsMetaData* CurrentMetaData = nullptr;
+
+void GatherMetaData(FTypingsJob& Job)
+{
+	FTypingsMetaData& MetaData = Job.MetaData;
+
+	auto GatherToolTip = [&](UField* Field)
+	{
+		MetaData.ToolTips.Add(Field, Field->GetToolTipText().ToString());
+	};
+
+	GatherToolTip(Job.Type);
+
+	if (auto Enum = Cast<UEnum>(Job.Type))
+	{
+		const int32 NumEnums = FMath::Max(0, Enum->NumEnums() - 1);
+		for (int32 Index = 0; Index < NumEnums; ++Index)
+			MetaData.EnumToolTips.Add(Enum->GetToolTipTextByIndex(Index).ToString());
+	}
+	else if (auto Struct = Cast<UStruct>(Job.Type))
+	{
+		FTsuReflection::VisitProperties([&](UProperty* Property, bool /*bIsReadOnly*/)
+		{
+			GatherToolTip(Property);
+		}, Struct);
+
+		FTsuReflection::VisitExtensionConstants(GatherToolTip, Struct);
+		FTsuReflection::VisitMethods(GatherToolTip, Struct);
+		FTsuReflection::VisitExtensionMethods(GatherToolTip, Struct);
+		FTsuReflection::VisitStaticExtensionMethods(GatherToolTip, Struct);
+
+		if (UFunction* MakeFunction = FTsuReflection::FindMakeFunction(Struct))
+			GatherToolTip(MakeFunction);
+	}
+
+	// Script names of referenced types are read from their metadata as well
+	for (UField* Reference : Job.References)
+		Reference->GetOutermost()->GetMetaData();
+}
+
+FString GetToolTip(UField* Field)
+{
+	if (!CurrentMetaData)
+		return Field->GetToolTipText().ToString();
+
+	const FString* ToolTip = CurrentMetaData->ToolTips.Find(Field);
+	checkSlow(ToolTip);
+	return ToolTip ? *ToolTip : FString();
+}
+
+FString GetToolTipByIndex(UEnum* Enum, int32 Index)
+{
+	if (!CurrentMetaData)
+		return Enum->GetToolTipTextByIndex(Index).ToString();
+
+	const TArray<FString>& ToolTips = CurrentMetaData->EnumToolTips;
+	return ToolTips.IsValidIndex(Index) ? ToolTips[Index] : FString();
+}
+
+uint64 HashTypings(const FString& Output)
+{
+	return CityHash64((const char*)*Output, Output.Len() * sizeof(TCHAR));
+}
+
+bool ShouldBundleTypings()
+{
+	return GetDefault<UTsuRuntimeSettings>()->bBundleTypings;
+}
+
+const TCHAR* GetImportPrefix()
+{
+	// Relative imports aren't allowed inside of `declare module` blocks
+	return ShouldBundleTypings() ? TEXT("UE/") : TEXT("../");
+}
+
+FString GetBundleName(UField* Type)
+{
+	UPackage* Package = Type->GetOutermost();
+	if (!Package->HasAnyPackageFlags(PKG_CompiledIn))
+		return {};
+
+	return FPackageName::GetShortName(Package);
+}
+
+void WriteBundleIndex()
+{
+	TArray<FString> BundleFiles;
+	IFileManager::Get().FindFiles(BundleFiles, *FTsuPaths::TypingsBundlePath(TEXT("*")), true, false);
+	BundleFiles.Sort();
+
+	FString Output;
+	Output += TEXT("// Generated file, any changes will be overwritten\n");
+	Output += TEXT("\n");
+
+	for (const FString& BundleFile : BundleFiles)
+	{
+		if (BundleFile != TEXT("index.d.ts"))
+			Output += FString::Printf(TEXT("/// <reference path=\"%s\" />\n"), *BundleFile);
+	}
+
+	FFileHelper::SaveStringToFile(Output, *FTsuPaths::TypingPath(TEXT("TsuBundles")), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+}
+
+FString GetBundleKey(const FString& TypeName)
+{
+	return TEXT("Bundle:") + TypeName;
+}
+
+FString GetBundleModuleHeader(const FString& TypeName)
+{
+	return FString::Printf(TEXT("\ndeclare module 'UE/%s' {\n"), *TypeName);
+}
+
+void AppendBundleModule(FString& Output, const FString& TypeName, const FString& TypeOutput)
+{
+	Output += GetBundleModuleHeader(TypeName);
+
+	TArray<FString> Lines;
+	TypeOutput.ParseIntoArrayLines(Lines, false);
+
+	for (FString& Line : Lines)
+	{
+		// Everything within the module block is already ambient
+		if (Line.StartsWith(TEXT("declare ")))
+			Line.RemoveAt(0, 8, false);
+
+		if (!Line.StartsWith(TEXT("//")))
+			Output += Line + TEXT("\n");
+	}
+
+	Output += TEXT("}\n");
+}
+
+FString BundleTypings(const TArray<FTypingsJob>& Jobs)
+{
+	FString Output;
+	Output.Reserve(Jobs.Num() * 8 * 1024);
+
+	Output += TEXT("// Generated file, any changes will be overwritten\n");
+
+	for (const FTypingsJob& Job : Jobs)
+		AppendBundleModule(Output, Job.TypeName, Job.Output);
+
+	return Output;
+}
+
+/** Replaces (or adds) the module block of a single type within an existing bundle */
+FString RebundleTypings(const FString& ExistingBundle, const FString& TypeName, const FString& TypeOutput)
+{
+	FString Module;
+	AppendBundleModule(Module, TypeName, TypeOutput);
+
+	if (ExistingBundle.IsEmpty())
+		return TEXT("// Generated file, any changes will be overwritten\n") + Module;
+
+	const int32 ModuleStart = ExistingBundle.Find(GetBundleModuleHeader(TypeName), ESearchCase::CaseSensitive);
+	if (ModuleStart == INDEX_NONE)
+		return ExistingBundle + Module;
+
+	// Lines within the module blocks aren't indented, so the next module header is what marks the end of this one
+	int32 ModuleEnd = ExistingBundle.Find(
+		TEXT("\ndeclare module '"),
+		ESearchCase::CaseSensitive,
+		ESearchDir::FromStart,
+		ModuleStart + 1);
+
+	if (ModuleEnd == INDEX_NONE)
+		ModuleEnd = ExistingBundle.Len();
+
+	return ExistingBundle.Left(ModuleStart) + Module + ExistingBundle.Mid(ModuleEnd);
+}
+
+/**
+ * Keeps track of the hash of the last typings written for each type, so that unchanged typings can be skipped
+ * without having to read back the existing files.
+ */
+class FTypingsManifest
+{
+public:
+	bool IsUpToDate(const FString& TypeName, uint64 Hash)
+	{
+		FScopeLock ScopeLock{&Lock};
+		LoadIfNeeded();
+
+		const uint64* ExistingHash = Hashes.Find(TypeName);
+		return ExistingHash && *ExistingHash == Hash;
+	}
+
+	void Set(const FString& TypeName, uint64 Hash)
+	{
+		FScopeLock ScopeLock{&Lock};
+		LoadIfNeeded();
+
+		Hashes.Add(TypeName, Hash);
+	}
+
+	bool Contains(const FString& TypeName)
+	{
+		FScopeLock ScopeLock{&Lock};
+		LoadIfNeeded();
+
+		return Hashes.Contains(TypeName);
+	}
+
+	bool Remove(const FString& TypeName)
+	{
+		FScopeLock ScopeLock{&Lock};
+		LoadIfNeeded();
+
+		return Hashes.Remove(TypeName) > 0;
+	}
+
+	bool HasBundles()
+	{
+		FScopeLock ScopeLock{&Lock};
+		LoadIfNeeded();
+
+		for (const auto& Entry : Hashes)
+		{
+			if (Entry.Key.StartsWith(TEXT("Bundle:")))
+				return true;
+		}
+
+		return false;
+	}
+
+	void RemoveBundles()
+	{
+		FScopeLock ScopeLock{&Lock};
+		LoadIfNeeded();
+
+		for (auto It = Hashes.CreateIterator(); It; ++It)
+		{
+			if (It.Key().StartsWith(TEXT("Bundle:")))
+				It.RemoveCurrent();
+		}
+	}
+
+	void Save()
+	{
+		FScopeLock ScopeLock{&Lock};
+
+		FString Output;
+		Output.Reserve(Hashes.Num() * 64);
+
+		for (const auto& Entry : Hashes)
+			Output += FString::Printf(TEXT("%016llx %s\n"), Entry.Value, *Entry.Key);
+
+		const FString ManifestPath = FTsuPaths::TypingsManifestPath();
+		if (!FFileHelper::SaveStringToFile(Output, *ManifestPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+			UE_LOG(LogTsuRuntime, Error, TEXT("Failed to save typings manifest"));
+	}
+
+private:
+	void LoadIfNeeded()
+	{
+		if (bIsLoaded)
+			return;
+
+		bIsLoaded = true;
+
+		TArray<FString> Lines;
+		if (!FFileHelper::LoadFileToStringArray(Lines, *FTsuPaths::TypingsManifestPath()))
+			return;
+
+		Hashes.Reserve(Lines.Num());
+
+		for (const FString& Line : Lines)
+		{
+			FString HashString, TypeName;
+			if (Line.Split(TEXT(" "), &HashString, &TypeName))
+				Hashes.Add(MoveTemp(TypeName), FCString::Strtoui64(*HashString, nullptr, 16));
+		}
+	}
+
+	FCriticalSection Lock;
+	TMap<FString, uint64> Hashes;
+	bool bIsLoaded = false;
+};
+
+FTypingsManifest& GetManifest()
+{
+	static FTypingsManifest Manifest;
+	return Manifest;
+}
+
+TFuture<void>& GetPendingWrites()
+{
+	static TFuture<void> PendingWrites;
+	return PendingWrites;
+}
+
+/**
+ * Returns the stamp written by the TSU generator during the UHT step, which only changes when the reflection data of
+ * native types changes, or an empty string if there is none.
+ */
+FString GetNativeTypesStamp()
+{
+	FString Stamp;
+	if (!FFileHelper::LoadFileToString(Stamp, *FTsuPaths::NativeTypesStampPath()))
+		return {};
+
+	return Stamp.TrimStartAndEnd() + TEXT(":") + TypingsVersion + (ShouldBundleTypings() ? TEXT(":bundled") : TEXT(""));
+}
+
+} // namespace TsuTypings_Private
+
 const TCHAR* FTsuTypings::MetaHidden = TEXT("Hidden");
 const TCHAR* FTsuTypings::MetaDisplayName = TEXT("DisplayName");
 const FName FTsuTypings::MetaScriptName = TEXT("ScriptName");
@@ -107,14 +448,185 @@ bool FTsuTypings::IsReservedIdentifier(const FString& Word)
 
 void FTsuTypings::WriteAllTypings()
 {
+	using namespace TsuTypings_Private;
+
+	const double TimeStart = FPlatformTime::Seconds();
+
+	WaitForPendingWrites();
+
 	WriteCoreTypings();
 	WriteGlobalTypings();
 	WriteKeyTypings();
 
+	// Typings for native types only need to be generated when the stamp from UHT has changed since last time
+	const FString NativeTypesStamp = GetNativeTypesStamp();
+
+	bool bIncludeNative = true;
+	if (!NativeTypesStamp.IsEmpty())
+	{
+		FString NativeTypingsStamp;
+		FFileHelper::LoadFileToString(NativeTypingsStamp, *FTsuPaths::NativeTypingsStampPath());
+		bIncludeNative = NativeTypesStamp != NativeTypingsStamp;
+	}
+
+	// Walking the object array and reading metadata has to happen on the game thread, so the types, their references
+	// and their tooltips are gathered up front. The game thread is blocked by the ParallelFor below, so the reflection
+	// data won't change meanwhile.
+
+	const bool bBundleTypings = ShouldBundleTypings();
+
+	TArray<FTypingsJob> Jobs;
+	Jobs.Reserve(10'000);
+
 	FTsuReflection::VisitAllTypes([&](UField* Type, const FTsuTypeSet& References)
 	{
-		WriteTypings(Type, References);
+		FTypingsJob& Job = Jobs.AddDefaulted_GetRef();
+		Job.Type = Type;
+		Job.TypeName = TailorNameOfType(Type);
+		Job.References = SortReferences(References);
+
+		if (bBundleTypings)
+			Job.BundleName = GetBundleName(Type);
+
+		GatherMetaData(Job);
+	}, bIncludeNative);
+
+	ParallelFor(Jobs.Num(), [&](int32 JobIndex)
+	{
+		FTypingsJob& Job = Jobs[JobIndex];
+
+		{
+			TGuardValue<const FTypingsMetaData*> MetaDataGuard(CurrentMetaData, &Job.MetaData);
+			GenerateTypings(Job.Output, Job.Type, Job.References);
+		}
+
+		Job.Hash = HashTypings(Job.Output);
+		Job.MetaData = {};
 	});
+
+	FTypingsManifest& Manifest = GetManifest();
+
+	TArray<FTypingsJob> ChangedJobs;
+	TMap<FString, TArray<FTypingsJob>> Bundles;
+	TSet<FString> ChangedBundles;
+	TArray<FString> StaleTypings;
+
+	for (FTypingsJob& Job : Jobs)
+	{
+		if (Job.BundleName.IsEmpty())
+		{
+			if (!Manifest.IsUpToDate(Job.TypeName, Job.Hash))
+				ChangedJobs.Add(MoveTemp(Job));
+
+			continue;
+		}
+
+		// Any typings previously written as separate files would take precedence over the bundles
+		if (Manifest.Contains(Job.TypeName))
+			StaleTypings.Add(Job.TypeName);
+
+		if (!Manifest.IsUpToDate(GetBundleKey(Job.TypeName), Job.Hash))
+			ChangedBundles.Add(Job.BundleName);
+
+		Bundles.FindOrAdd(Job.BundleName).Add(MoveTemp(Job));
+	}
+
+	// Only bundles with at least one changed type need to be rewritten
+	for (auto It = Bundles.CreateIterator(); It; ++It)
+	{
+		if (!ChangedBundles.Contains(It.Key()))
+			It.RemoveCurrent();
+	}
+
+	const bool bRemoveBundles = !bBundleTypings && bIncludeNative && Manifest.HasBundles();
+
+	UE_LOG(
+		LogTsuRuntime,
+		Log,
+		TEXT("Generated typings for %d types in %.1f ms, %d of which changed, %d bundles changed"),
+		Jobs.Num(),
+		(FPlatformTime::Seconds() - TimeStart) * 1000,
+		ChangedJobs.Num(),
+		Bundles.Num());
+
+	const bool bWriteNativeStamp = bIncludeNative && !NativeTypesStamp.IsEmpty();
+	if (ChangedJobs.Num() == 0 && Bundles.Num() == 0 && StaleTypings.Num() == 0 && !bRemoveBundles && !bWriteNativeStamp)
+		return;
+
+	Generation += 1;
+
+	GetPendingWrites() = Async(EAsyncExecution::ThreadPool, [
+		ChangedJobs = MoveTemp(ChangedJobs),
+		Bundles = MoveTemp(Bundles),
+		StaleTypings = MoveTemp(StaleTypings),
+		bRemoveBundles,
+		bWriteNativeStamp,
+		NativeTypesStamp]
+	{
+		FTypingsManifest& Manifest = GetManifest();
+		IFileManager& FileManager = IFileManager::Get();
+
+		bool bSucceeded = true;
+
+		for (const FString& TypeName : StaleTypings)
+		{
+			FileManager.DeleteDirectory(*FPaths::GetPath(FTsuPaths::TypingPath(*TypeName)), false, true);
+			Manifest.Remove(TypeName);
+		}
+
+		if (bRemoveBundles)
+		{
+			FileManager.DeleteDirectory(*FPaths::GetPath(FTsuPaths::TypingPath(TEXT("TsuBundles"))), false, true);
+			Manifest.RemoveBundles();
+		}
+
+		for (const FTypingsJob& Job : ChangedJobs)
+		{
+			const FString OutputPath = FTsuPaths::TypingPath(*Job.TypeName);
+			if (FFileHelper::SaveStringToFile(Job.Output, *OutputPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+			{
+				Manifest.Set(Job.TypeName, Job.Hash);
+			}
+			else
+			{
+				UE_LOG(LogTsuRuntime, Error, TEXT("[%s] Failed to save typings"), *Job.TypeName);
+				bSucceeded = false;
+			}
+		}
+
+		for (const auto& Bundle : Bundles)
+		{
+			const FString OutputPath = FTsuPaths::TypingsBundlePath(*Bundle.Key);
+			if (FFileHelper::SaveStringToFile(BundleTypings(Bundle.Value), *OutputPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+			{
+				for (const FTypingsJob& Job : Bundle.Value)
+					Manifest.Set(GetBundleKey(Job.TypeName), Job.Hash);
+			}
+			else
+			{
+				UE_LOG(LogTsuRuntime, Error, TEXT("[%s] Failed to save typings bundle"), *Bundle.Key);
+				bSucceeded = false;
+			}
+		}
+
+		if (Bundles.Num() > 0)
+			WriteBundleIndex();
+
+		Manifest.Save();
+
+		if (bWriteNativeStamp && bSucceeded)
+			FFileHelper::SaveStringToFile(NativeTypesStamp, *FTsuPaths::NativeTypingsStampPath());
+	});
+}
+
+void FTsuTypings::WaitForPendingWrites()
+{
+	TFuture<void>& PendingWrites = TsuTypings_Private::GetPendingWrites();
+	if (PendingWrites.IsValid())
+	{
+		PendingWrites.Wait();
+		PendingWrites.Reset();
+	}
 }
 
 void FTsuTypings::WriteCoreTypings()
@@ -173,21 +685,34 @@ void FTsuTypings::WriteGlobalTypings()
 {
 	WriteTypings(UEngine::StaticClass());
 	WriteTypings(UWorld::StaticClass());
+	WriteTypings(StaticEnum<ETickingGroup>());
 
 	FString& Output = ResetPersistentOutputBuffer();
 
 	TSU_WRITELN("// Generated file, any changes will be overwritten");
 	TSU_WRITELN("");
-	TSU_WRITELN("import { TimerHandle } from '../TimerHandle';");
+	TSU_WRITELNF("import { ETickingGroup } from '%sETickingGroup';", GetImportPrefix());
+	TSU_WRITELNF("import { UObject } from '%sUObject';", GetImportPrefix());
+	TSU_WRITELNF("import { TimerHandle } from '%sTimerHandle';", GetImportPrefix());
 	TSU_WRITELN("");
 	TSU_WRITELN("declare global {");
 	TSU_WRITELN("\tfunction require(id: string): any;");
 	TSU_WRITELN("");
+	TSU_WRITELN("\tconst __DEV__: boolean;");
+	TSU_WRITELN("");
 	TSU_WRITELN("\tfunction setTimeout(callback: () => void, delay: number): TimerHandle;");
 	TSU_WRITELN("\tfunction clearTimeout(handle: TimerHandle): void;");
 	TSU_WRITELN("\tfunction setInterval(callback: () => void, interval: number): TimerHandle;");
 	TSU_WRITELN("\tfunction clearInterval(handle: TimerHandle): void;");
 	TSU_WRITELN("");
+	TSU_WRITELN("\tvar tsu: {");
+	TSU_WRITELN("\t\tschedule(task: () => void, priority?: number): void;");
+	TSU_WRITELN("\t\tyieldFrame(): Promise<void>;");
+	TSU_WRITELN("\t\timportAsync<T = unknown>(typeName: string): Promise<T>;");
+	TSU_WRITELN("\t\taddTick<T extends UObject>(object: T, callback: (object: T, deltaTime: number) => void, tickGroup?: ETickingGroup): void;");
+	TSU_WRITELN("\t\tremoveTick(object: UObject): void;");
+	TSU_WRITELN("\t}");
+	TSU_WRITELN("");
 	TSU_WRITELN("\tvar console: {");
 	TSU_WRITELN("\t\tlog(message: any, ...optionalParams: any[]): void;");
 	TSU_WRITELN("\t\tinfo(message: any, ...optionalParams: any[]): void;");
@@ -211,8 +736,8 @@ void FTsuTypings::WriteKeyTypings()
 
 	TSU_WRITELN("// Generated file, any changes will be overwritten");
 	TSU_WRITELN("");
-	TSU_WRITELN("import { DeepReadonly } from '../TsuCore';");
-	TSU_WRITELN("import { Key } from '../Key';");
+	TSU_WRITELNF("import { DeepReadonly } from '%sTsuCore';", GetImportPrefix());
+	TSU_WRITELNF("import { Key } from '%sKey';", GetImportPrefix());
 	TSU_WRITELN("");
 	TSU_WRITELN("declare const EKeys: DeepReadonly<{");
 
@@ -233,29 +758,47 @@ void FTsuTypings::WriteKeyTypings()
 
 bool FTsuTypings::WriteTypings(UField* Type, const FTsuTypeSet& References)
 {
-	//const double TimeStart = FPlatformTime::Seconds();
-
 	FString& Output = ResetPersistentOutputBuffer();
+	GenerateTypings(Output, Type, SortReferences(References));
 
-	TSU_WRITELN("// Generated file, any changes will be overwritten");
-	TSU_WRITELN("");
+	const FString TypeName = TailorNameOfType(Type);
 
-	if (Type->IsA<UStruct>())
+	if (TsuTypings_Private::ShouldBundleTypings())
 	{
-		TSU_WRITELN("import { Delegate, MulticastDelegate, DeepReadonly } from '../TsuCore';");
-		TSU_WRITELN("");
+		const FString BundleName = TsuTypings_Private::GetBundleName(Type);
+		if (!BundleName.IsEmpty())
+			return SaveBundledTypings(BundleName, TypeName, Output);
 	}
 
+	return SaveTypings(TypeName, Output);
+}
+
+TArray<UField*> FTsuTypings::SortReferences(const FTsuTypeSet& References)
+{
 	TArray<UField*> SortedReferences = References.Array();
 	SortedReferences.Sort([](UField& Lhs, UField& Rhs)
 	{
 		return TailorNameOfType(&Lhs) < TailorNameOfType(&Rhs);
 	});
 
+	return SortedReferences;
+}
+
+void FTsuTypings::GenerateTypings(FString& Output, UField* Type, const TArray<UField*>& SortedReferences)
+{
+	TSU_WRITELN("// Generated file, any changes will be overwritten");
+	TSU_WRITELN("");
+
+	if (Type->IsA<UStruct>())
+	{
+		TSU_WRITELNF("import { Delegate, MulticastDelegate, DeepReadonly } from '%sTsuCore';", GetImportPrefix());
+		TSU_WRITELN("");
+	}
+
 	for (UField* ReferencedType : SortedReferences)
 	{
 		const FString TypeName = TailorNameOfType(ReferencedType);
-		TSU_WRITELNF("import { %s } from '../%s';", *TypeName, *TypeName);
+		TSU_WRITELNF("import { %s } from '%s%s';", *TypeName, GetImportPrefix(), *TypeName);
 	}
 
 	if (SortedReferences.Num() > 0)
@@ -265,25 +808,6 @@ bool FTsuTypings::WriteTypings(UField* Type, const FTsuTypeSet& References)
 		WriteEnum(Output, Enum);
 	else if (auto Struct = Cast<UStruct>(Type))
 		WriteObject(Output, Struct);
-
-	//const double TimeEndWork = FPlatformTime::Seconds();
-
-	const FString TypeName = TailorNameOfType(Type);
-	if (!SaveTypings(TypeName, Output))
-		return false;
-
-	//const double TimeEndIo = FPlatformTime::Seconds();
-
-	//UE_LOG(
-	//	LogTsuRuntime,
-	//	Log,
-	//	TEXT("[%s] Generated typings in %.1f ms (%.1f ms work, %.1f ms I/O)"),
-	//	*TypeName,
-	//	(TimeEndIo - TimeStart) * 1000,
-	//	(TimeEndWork - TimeStart) * 1000,
-	//	(TimeEndIo - TimeEndWork) * 1000);
-
-	return true;
 }
 
 void FTsuTypings::WriteTypings(UField* Type)
@@ -315,6 +839,11 @@ bool FTsuTypings::DoTypingsExist(UField* Type)
 	return DoTypingsExist(*TailorNameOfType(Type));
 }
 
+uint32 FTsuTypings::GetGeneration()
+{
+	return TsuTypings_Private::Generation;
+}
+
 bool FTsuTypings::DoTypingsExist(const TCHAR* TypeName)
 {
 	return FPlatformFileManager::Get()
@@ -351,7 +880,7 @@ void FTsuTypings::WriteEnum(FString& Output, UEnum* Enum)
 		if (Index > 0)
 			TSU_WRITELN("");
 
-		WriteToolTip(Output, Enum->GetToolTipTextByIndex(Index).ToString(), true);
+		WriteToolTip(Output, TsuTypings_Private::GetToolTipByIndex(Enum, (int32)Index), true);
 		TSU_WRITELNF("\t%s = %lld,", *Name, Value);
 	}
 
@@ -495,7 +1024,7 @@ void FTsuTypings::WriteObject(FString& Output, UStruct* Struct)
 
 void FTsuTypings::WriteToolTip(FString& Output, UFunction* Function, bool bSkipFirst, bool bIndent)
 {
-	FString ToolTip = Function->GetToolTipText().ToString();
+	FString ToolTip = TsuTypings_Private::GetToolTip(Function);
 
 	// Add any default values to the tooltip
 	FTsuReflection::VisitFunctionParameters([&](UProperty* Parameter)
@@ -517,7 +1046,7 @@ void FTsuTypings::WriteToolTip(FString& Output, UFunction* Function, bool bSkipF
 
 void FTsuTypings::WriteToolTip(FString& Output, UField* Field, bool bIndent)
 {
-	FString Tooltip = Field->GetToolTipText().ToString();
+	FString Tooltip = TsuTypings_Private::GetToolTip(Field);
 
 	auto WriteDelegateTooltip = [&](UFunction* SignatureFunction)
 	{
@@ -712,23 +1241,97 @@ void FTsuTypings::WriteProperty(FString& Output, UProperty* Property, bool bIsRe
 
 bool FTsuTypings::SaveTypings(const FString& TypeName, const FString& Output)
 {
+	using namespace TsuTypings_Private;
+
+	WaitForPendingWrites();
+
+	// Anything written outside of WriteAllTypings updates the manifest entry of the type, if it has one, so that
+	// WriteAllTypings only rewrites it if its typings turn out different
+	FTypingsManifest& Manifest = GetManifest();
+	const bool bInManifest = Manifest.Contains(TypeName);
+
 	const FString OutputPath = FTsuPaths::TypingPath(*TypeName);
 
 	FString ExistingOutput;
 	FFileHelper::LoadFileToString(ExistingOutput, *OutputPath);
 
-	if (Output.Equals(ExistingOutput, ESearchCase::CaseSensitive))
-		return true;
+	if (!Output.Equals(ExistingOutput, ESearchCase::CaseSensitive))
+	{
+		Generation += 1;
+
+		if (!FFileHelper::SaveStringToFile(Output, *OutputPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+		{
+			UE_LOG(LogTsuRuntime, Error, TEXT("[%s] Failed to save typings"), *TypeName);
+
+			if (Manifest.Remove(TypeName))
+				Manifest.Save();
+
+			return false;
+		}
+	}
 
-	if (!FFileHelper::SaveStringToFile(Output, *OutputPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	const uint64 Hash = HashTypings(Output);
+	if (bInManifest && !Manifest.IsUpToDate(TypeName, Hash))
 	{
-		UE_LOG(LogTsuRuntime, Error, TEXT("[%s] Failed to save typings"), *TypeName);
-		return false;
+		Manifest.Set(TypeName, Hash);
+		Manifest.Save();
 	}
 
 	return true;
 }
 
+bool FTsuTypings::SaveBundledTypings(const FString& BundleName, const FString& TypeName, const FString& Output)
+{
+	using namespace TsuTypings_Private;
+
+	WaitForPendingWrites();
+
+	// Same as with SaveTypings, except that any separate typings would also take precedence over the bundle
+	FTypingsManifest& Manifest = GetManifest();
+	bool bManifestChanged = Manifest.Remove(TypeName);
+	if (bManifestChanged)
+		IFileManager::Get().DeleteDirectory(*FPaths::GetPath(FTsuPaths::TypingPath(*TypeName)), false, true);
+
+	const FString OutputPath = FTsuPaths::TypingsBundlePath(*BundleName);
+
+	FString ExistingBundle;
+	const bool bBundleExists = FFileHelper::LoadFileToString(ExistingBundle, *OutputPath);
+
+	const FString BundleKey = GetBundleKey(TypeName);
+
+	const FString Bundle = RebundleTypings(ExistingBundle, TypeName, Output);
+	if (!Bundle.Equals(ExistingBundle, ESearchCase::CaseSensitive))
+	{
+		Generation += 1;
+
+		if (!FFileHelper::SaveStringToFile(Bundle, *OutputPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+		{
+			UE_LOG(LogTsuRuntime, Error, TEXT("[%s] Failed to save typings bundle"), *BundleName);
+
+			if (Manifest.Remove(BundleKey) || bManifestChanged)
+				Manifest.Save();
+
+			return false;
+		}
+
+		if (!bBundleExists)
+			WriteBundleIndex();
+	}
+
+	// The bundle now holds exactly these typings, so WriteAllTypings won't have to rewrite it unless they change
+	const uint64 Hash = HashTypings(Output);
+	if (!Manifest.IsUpToDate(BundleKey, Hash))
+	{
+		Manifest.Set(BundleKey, Hash);
+		bManifestChanged = true;
+	}
+
+	if (bManifestChanged)
+		Manifest.Save();
+
+	return true;
+}
+
 FString FTsuTypings::GetPropertyType(UProperty* Property, bool bIsReadOnly)
 {
 	FString Result;
@@ -923,6 +1526,21 @@ TOptional<FString> FTsuTypings::GetExplicitScriptName(UField* Field)
 		return {};
 }
 
+FString FTsuTypings::GetImplicitScriptName(UField* Type)
+{
+	if (auto Class = Cast<UClass>(Type))
+	{
+		if (Class == UObject::StaticClass())
+			return TEXT("UObject");
+		else if (Class == UFunction::StaticClass())
+			return TEXT("UFunction");
+		else if (auto GeneratedClass = Cast<UBlueprintGeneratedClass>(Class))
+			return GeneratedClass->ClassGeneratedBy->GetName();
+	}
+
+	return Type->GetName();
+}
+
 TOptional<FString> FTsuTypings::GetExplicitScriptMethodName(UFunction* Function)
 {
 	const FString& ScriptName = Function->GetMetaData(MetaScriptMethod);
@@ -1083,7 +1701,8 @@ const FString& FTsuTypings::TailorNameOfType(UField* Type)
 	using FCachedName = TPair<FName, FString>;
 	using FCache = TMap<UField*, FCachedName>;
 
-	static FCache Cache = []
+	// Thread-local, since typings are generated on multiple threads
+	static thread_local FCache Cache = []
 	{
 		FCache Result;
 		Result.Reserve(6'000);
@@ -1095,24 +1714,8 @@ const FString& FTsuTypings::TailorNameOfType(UField* Type)
 	FCachedName& CachedName = Cache.FindOrAdd(Type);
 	if (CachedName.Key != TypeFName)
 	{
-		FString TypeName;
-
-		if (TOptional<FString> ScriptName = GetExplicitScriptName(Type))
-		{
-			TypeName = MoveTemp(ScriptName.GetValue());
-		}
-		else if (auto Class = Cast<UClass>(Type))
-		{
-			if (Class == UObject::StaticClass())
-				TypeName = TEXT("UObject");
-			else if (Class == UFunction::StaticClass())
-				TypeName = TEXT("UFunction");
-			else if (auto GeneratedClass = Cast<UBlueprintGeneratedClass>(Class))
-				TypeName = GeneratedClass->ClassGeneratedBy->GetName();
-		}
-
-		if (TypeName.IsEmpty())
-			TypeName = Type->GetName();
+		TOptional<FString> ScriptName = GetExplicitScriptName(Type);
+		FString TypeName = ScriptName ? MoveTemp(ScriptName.GetValue()) : GetImplicitScriptName(Type);
 
 		CachedName = FCachedName(TypeFName, MoveTemp(TypeName));
 	}
@@ -1150,7 +1753,7 @@ const FString& FTsuTypings::TailorNameOfField(UField* Field)
 	using FCachedName = TPair<FName, FString>;
 	using FCache = TMap<const UField*, FCachedName>;
 
-	static FCache Cache = []
+	static thread_local FCache Cache = []
 	{
 		FCache Result;
 		Result.Reserve(25'000);
@@ -1180,7 +1783,7 @@ const FString& FTsuTypings::TailorNameOfExtension(UFunction* Function)
 	using FCachedName = TPair<FName, FString>;
 	using FCache = TMap<const UFunction*, FCachedName>;
 
-	static FCache Cache = []
+	static thread_local FCache Cache = []
 	{
 		FCache Result;
 		Result.Reserve(1'000);
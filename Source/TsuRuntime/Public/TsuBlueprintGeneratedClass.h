@@ -9,6 +9,12 @@
 
 #include "TsuBlueprintGeneratedClass.generated.h"
 
+#if WITH_EDITOR
+/** Builds the source that a class should be cooked with, returning false to cook the source as it is */
+DECLARE_DELEGATE_RetVal_TwoParams(
+	bool, FTsuBuildCookedSource, const class UTsuBlueprintGeneratedClass* /*Class*/, FString& /*OutSource*/);
+#endif // WITH_EDITOR
+
 UCLASS(ClassGroup = TSU)
 class TSURUNTIME_API UTsuBlueprintGeneratedClass final
 	: public UBlueprintGeneratedClass
@@ -21,21 +27,37 @@ class TSURUNTIME_API UTsuBlueprintGeneratedClass final
 	static const FName MetaTooltip;
 	static const FName MetaDefaultToSelf;
 	static const FName MetaAdvancedDisplay;
+	static const FName MetaLatent;
+	static const FName MetaLatentInfo;
+	static const FName MetaWorldContext;
 
 public:
 	void FinishDestroy() override;
 	void Bind() override;
+	void Serialize(FArchive& Ar) override;
 
 	void ReloadModule();
 
 #if WITH_EDITOR
 	void GatherDependencies(TSet<TWeakObjectPtr<class UBlueprint>>& Dependencies) const;
+
+	/** Bound by the editor, which is what knows how to build the production source */
+	static FTsuBuildCookedSource BuildCookedSource;
 #endif // WITH_EDITOR
 
 	UPROPERTY()
 	FTsuParsedFile Exports;
 
+	/** The exported source, in the buffer that's shared with V8 by any module compiled out of it */
+	TSharedRef<const FString> GetSharedSource();
+
 private:
+	/**
+	 * Whether the exports are valid, which outside of the editor also accounts for the source having been handed over
+	 * to `SharedSource` by a loaded module
+	 */
+	bool HasValidExports() const;
+
 	void RemoveNativeFunction(FName FunctionName);
 	void BindFunction(const FTsuParsedFunction& Export);
 
@@ -44,6 +66,7 @@ private:
 	void UnloadModule();
 
 	static void ExecInvoke(UObject* ExecContext, FFrame& ExecStack, RESULT_DECL);
+	static void ExecInvokeLatent(UObject* ExecContext, FFrame& ExecStack, RESULT_DECL);
 
 	UProperty* NewParameterFromType(
 		UObject* Outer,
@@ -55,4 +78,7 @@ private:
 
 	FString TailoredName;
 	TWeakPtr<FTsuModule> Module;
+
+	/** The source that V8 refers to, which outside of the editor takes over the buffer of the exported source */
+	TSharedPtr<const FString> SharedSource;
 };
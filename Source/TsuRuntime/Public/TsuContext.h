@@ -5,9 +5,13 @@
 #include "../Private/TsuContextCallback.h"
 #include "../Private/TsuInspector.h"
 #include "../Private/TsuModule.h"
+#include "../Private/TsuStringConv.h"
+#include "../Private/TsuTaskQueue.h"
+#include "../Private/TsuTickManager.h"
 #include "../Private/TsuTimer.h"
 #include "../Private/TsuV8Wrapper.h"
 
+#include "Engine/StreamableManager.h"
 #include "UObject/GCObject.h"
 #include "UObject/Stack.h"
 #include "UObject/WeakObjectPtrTemplates.h"
@@ -16,7 +20,11 @@ class TSURUNTIME_API FTsuContext final
 	: public FGCObject
 {
 	friend struct TOptional<FTsuContext>;
+	friend class FTsuLatentAction;
 	friend class FTsuModule;
+	friend class FTsuTaskQueue;
+	friend class FTsuTickManager;
+	friend class FTsuTrampolines;
 	friend struct FTsuWorldContextScope;
 	friend class UTsuDelegateEvent;
 
@@ -24,6 +32,20 @@ class TSURUNTIME_API FTsuContext final
 	using FDelegateKey = TTuple<UObject*, UProperty*>;
 	using FDelegateEventMap = TMap<FWeakObjectPtr, TMap<uint64, UTsuDelegateEvent*>>;
 
+	struct FPendingImport
+	{
+		FString TypeName;
+		FSoftObjectPath ClassPath;
+		v8::Global<v8::Promise::Resolver> Resolver;
+		TSharedPtr<FStreamableHandle> Handle;
+	};
+
+	struct FESModule
+	{
+		v8::Global<v8::Module> Module;
+		uint32 SourceHash = 0;
+	};
+
 	static const FName MetaWorldContext;
 	static const FName NameEventExecute;
 
@@ -42,15 +64,19 @@ public:
 	/** Returns whether the singleton exists or not */
 	static bool Exists();
 
+	/** Forgets what `require` calls have resolved to, which is needed whenever files are added/removed on disk */
+	static void InvalidateResolutions();
+
 	/**
-	 * Evaluates/runs the code of a CommonJS module inside the context
+	 * Evaluates/runs the code of a CommonJS module inside the context. The code is compiled as the body of a function
+	 * taking the module variables as parameters, and is shared with V8 rather than copied into its heap.
 	 * 
 	 * @param Code The source code of the module
 	 * @param Path The absolute path to the source code
 	 * 
 	 * @returns The resulting `module.exports` (maybe)
 	 */
-	v8::MaybeLocal<v8::Value> EvalModule(const TCHAR* Code, const TCHAR* Path);
+	v8::MaybeLocal<v8::Value> EvalModule(const FTsuSharedString& Code, const TCHAR* Path);
 
 	/**
 	 * Evalutes and binds the code of a CommonJS module into the context
@@ -61,7 +87,7 @@ public:
 	 * 
 	 * @returns Whether the module was successfully bound
 	 */
-	bool BindModule(const TCHAR* Binding, const TCHAR* Code, const TCHAR* Path);
+	bool BindModule(const TCHAR* Binding, const FTsuSharedString& Code, const TCHAR* Path);
 
 	/**
 	 * Evaluates and binds the code of a CommonJS module into the context, and then returns 
@@ -73,7 +99,29 @@ public:
 	 * 
 	 * @returns A weak handle to the module
 	 */
-	TWeakPtr<FTsuModule> ClaimModule(const TCHAR* Binding, const TCHAR* Code, const TCHAR* Path);
+	TWeakPtr<FTsuModule> ClaimModule(const TCHAR* Binding, const FTsuSharedString& Code, const TCHAR* Path);
+
+	/**
+	 * Evaluates/runs the code of an ES module inside the context, along with the modules it imports. Modules are
+	 * cached by their path, and are only compiled again if their code has changed.
+	 * 
+	 * @param Code The source code of the module
+	 * @param Path The absolute path to the source code
+	 * 
+	 * @returns The namespace object of the module (maybe)
+	 */
+	v8::MaybeLocal<v8::Value> EvalESModule(const FTsuSharedString& Code, const TCHAR* Path);
+
+	/**
+	 * Evalutes and binds the code of an ES module into the context
+	 * 
+	 * @param Binding The name to bind the module namespace to
+	 * @param Code The source code of the module
+	 * @param Path The absolute path of the source code
+	 * 
+	 * @returns Whether the module was successfully bound
+	 */
+	bool BindESModule(const TCHAR* Binding, const FTsuSharedString& Code, const TCHAR* Path);
 
 private:
 	FTsuContext();
@@ -135,12 +183,49 @@ private:
 	/** Loads and binds the code for `require` */
 	void InitializeRequire();
 
+	/**
+	 * Compiles an ES module and caches it under a given key, or returns the cached module if its code is unchanged.
+	 * 
+	 * @param Code The source code of the module
+	 * @param Key The full path of the module, or the specifier of a generated module
+	 * @param OriginName The name of the module in call stacks
+	 * @returns The compiled module (maybe)
+	 */
+	v8::MaybeLocal<v8::Module> CompileESModule(
+		const FTsuSharedString& Code,
+		const FString& Key,
+		const FString& OriginName);
+
+	/** Finds or compiles the module that a specifier refers to, relative to the module cached under a given key */
+	v8::MaybeLocal<v8::Module> ResolveESModule(const FString& Specifier, const FString& ReferrerKey);
+
+	/** Instantiates and evaluates a module, along with its imports, unless it already has been */
+	bool EvaluateESModule(v8::Local<v8::Module> Module);
+
+	/** Finds the key that a compiled module was cached under */
+	const FString* FindESModuleKey(v8::Local<v8::Module> Module);
+
+	/** Resolves the static imports of a module being instantiated */
+	static v8::MaybeLocal<v8::Module> OnResolveModule(
+		v8::Local<v8::Context> Context,
+		v8::Local<v8::String> Specifier,
+		v8::Local<v8::Module> Referrer);
+
+	/** Resolves `import()` calls, from both ES modules and CommonJS modules */
+	static v8::MaybeLocal<v8::Promise> OnImportModuleDynamically(
+		v8::Local<v8::Context> Context,
+		v8::Local<v8::ScriptOrModule> Referrer,
+		v8::Local<v8::String> Specifier);
+
 	/** Loads, creates and stores the constructor for the array proxy handler */
 	void InitializeArrayProxy();
 
 	/** Loads, creates and stores the constructor for the struct proxy handler */
 	void InitializeStructProxy();
 
+	/** Loads the tick dispatcher and creates the tick manager */
+	void InitializeTickManager();
+
 	/** Finds the constructor for a given type. Creates and caches it if it isn't already. */
 	v8::Local<v8::Function> FindOrAddConstructor(UStruct* Type);
 
@@ -180,6 +265,12 @@ private:
 	/** The native function callback for exported TSU functions */
 	void Invoke(const TCHAR* Namespace, FFrame& Stack, RESULT_DECL);
 
+	/**
+	 * The native function callback for exported async TSU functions, which are exposed as latent functions.
+	 * The returned promise is handed off to a latent action, which resumes execution once it settles.
+	 */
+	void InvokeLatent(const TCHAR* Namespace, FFrame& Stack);
+
 	/**
 	 * Callback for UTsuDelegateEvent when a delegate event is called/broadcast.
 	 * 
@@ -277,6 +368,18 @@ private:
 	/** ... */
 	TSU_CONTEXT_CALLBACK(OnClearTimeout);
 
+	/** ... */
+	TSU_CONTEXT_CALLBACK(OnSchedule);
+
+	/** ... */
+	TSU_CONTEXT_CALLBACK(OnYieldFrame);
+
+	/** ... */
+	TSU_CONTEXT_CALLBACK(OnAddTick);
+
+	/** ... */
+	TSU_CONTEXT_CALLBACK(OnRemoveTick);
+
 	/** ... */
 	TSU_CONTEXT_CALLBACK(OnPathJoin);
 
@@ -292,12 +395,27 @@ private:
 	/** ... */
 	TSU_CONTEXT_CALLBACK(OnFileExists);
 
+	/** ... */
+	TSU_CONTEXT_CALLBACK(OnFindResolution);
+
+	/** ... */
+	TSU_CONTEXT_CALLBACK(OnAddResolution);
+
 	/** ... */
 	TSU_CONTEXT_CALLBACK(OnRequire);
 
 	/** ... */
 	TSU_CONTEXT_CALLBACK(OnImport);
 
+	/** ... */
+	TSU_CONTEXT_CALLBACK(OnGetCommonJSExports);
+
+	/** ... */
+	TSU_CONTEXT_CALLBACK(OnImportAsync);
+
+	/** Resolves the promise of a pending `tsu.importAsync` once its class has been streamed in */
+	void OnImportLoaded(uint64 ImportHandle);
+
 	/** ... */
 	TSU_CONTEXT_CALLBACK(OnGetProperty);
 
@@ -497,6 +615,30 @@ private:
 	/** ... */
 	TArray<FTsuTimer> AliveTimers;
 
+	/** ... */
+	TOptional<FTsuTaskQueue> TaskQueue;
+
+	/** ... */
+	FStreamableManager StreamableManager;
+
+	/** ... */
+	TMap<uint64, FPendingImport> PendingImports;
+
+	/** ... */
+	uint64 NextImportHandle = 1;
+
+	/** ES modules by key, which is the full path for scripts and the specifier for generated modules */
+	TMap<FString, FESModule> ESModules;
+
+	/** Keys of ES modules by their identity hash, for finding out which module an import comes from */
+	TMultiMap<int32, FString> ESModuleKeys;
+
+	/** Exports of the CommonJS packages imported by ES modules, by specifier */
+	TMap<FString, v8::Global<v8::Value>> CommonJSExports;
+
+	/** ... */
+	TOptional<FTsuTickManager> TickManager;
+
 	/** ... */
 	TOptional<FTsuInspector> Inspector;
 };
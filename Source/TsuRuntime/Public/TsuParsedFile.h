@@ -42,6 +42,9 @@ struct TSURUNTIME_API FTsuParsedFunction
 	UPROPERTY()
 	TArray<FTsuParsedType> ReturnTypes;
 
+	UPROPERTY()
+	bool Latent = false;
+
 	UPROPERTY()
 	int32 Line;
 
@@ -63,6 +66,18 @@ struct TSURUNTIME_API FTsuParsedFile
 	UPROPERTY()
 	FString Source;
 
+	/** Hash of the emitted source, which lets the editor skip loading it when it hasn't changed */
+	UPROPERTY()
+	FString SourceHash;
+
+	/** Where the parser wrote the emitted source, which is then loaded into `Source` by the editor */
+	UPROPERTY(Transient)
+	FString SourcePath;
+
+	/** Where the parser wrote the source map, for production builds, where it's kept on the side rather than inlined */
+	UPROPERTY(Transient)
+	FString SourceMapPath;
+
 	UPROPERTY()
 	TArray<FString> Errors;
 
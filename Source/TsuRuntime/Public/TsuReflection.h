@@ -4,11 +4,14 @@
 
 #include "GameFramework/Actor.h"
 #include "Templates/SubclassOf.h"
+#include "UObject/SoftObjectPath.h"
 
 using FTsuTypeSet = TSet<UField*>;
 
 class TSURUNTIME_API FTsuReflection
 {
+	friend class FTsuReflectionDatabase;
+
 	static const FName MetaWorldContext;
 	static const FName MetaNativeMakeFunc;
 	static const FName MetaNativeBreakFunc;
@@ -61,7 +64,7 @@ public:
 	static bool IsInputParameter(UProperty* Param);
 	static bool CanLibraryExtendType(UStruct* Library, UStruct* Type);
 
-	static void VisitAllTypes(const TypeVisitor& Visitor);
+	static void VisitAllTypes(const TypeVisitor& Visitor, bool bIncludeNative = true);
 	static void VisitFunctionLibraries(const LibraryVisitor& Visitor);
 	static void VisitMakeFunctions(const MakeVisitor& Visitor);
 	static void VisitBreakFunctions(const BreakVisitor& Visitor);
@@ -95,4 +98,6 @@ public:
 	static UStruct* FindExtendedType(UFunction* Function);
 
 	static UField* FindTypeByName(const FString& TypeName);
+	static UField* FindLoadedTypeByName(const FString& TypeName);
+	static FSoftObjectPath FindUnloadedTypePath(const FString& TypeName);
 };
@@ -18,10 +18,15 @@ public:
 	static void WriteGlobalTypings();
 	static void WriteKeyTypings();
 	static void WriteAllTypings();
+	static void WaitForPendingWrites();
 	static void WriteTypings(UField* Type);
 	static void WriteDependencyTypings(class UTsuBlueprintGeneratedClass* Class);
 	static bool DoTypingsExist(UField* Type);
 	static bool DoTypingsExist(const TCHAR* TypeName);
+
+	/** Incremented whenever typings are written, which makes anything parsed against the previous typings stale */
+	static uint32 GetGeneration();
+
 	static void WriteEnum(FString& Output, UEnum* Enum);
 	static void WriteObject(FString& Output, UStruct* Type);
 	static void WriteToolTip(FString& Output, UFunction* Function, bool bSkipFirst, bool bIndent);
@@ -34,11 +39,13 @@ public:
 	static void WriteReturns(FString& Output, UFunction* Function, bool bSkipFirst = false);
 	static void WriteProperty(FString& Output, UProperty* Property, bool bIsReadOnly);
 	static bool SaveTypings(const FString& TypeName, const FString& Output);
+	static bool SaveBundledTypings(const FString& BundleName, const FString& TypeName, const FString& Output);
 
 	static FString GetPropertyType(UProperty* Property, bool bIsReadOnly = false);
 	static FString GetPropertyTypeForSuffix(UProperty* Property);
 
 	static TOptional<FString> GetExplicitScriptName(UField* Field);
+	static FString GetImplicitScriptName(UField* Type);
 	static TOptional<FString> GetExplicitScriptMethodName(UFunction* Function);
 
 	static const FString& TailorNameOfType(UField* Type);
@@ -49,6 +56,8 @@ private:
 	static FString& ResetPersistentOutputBuffer();
 	static bool IsReservedIdentifier(const FString& Word);
 	static bool WriteTypings(UField* Type, const FTsuTypeSet& References);
+	static void GenerateTypings(FString& Output, UField* Type, const TArray<UField*>& SortedReferences);
+	static TArray<UField*> SortReferences(const FTsuTypeSet& References);
 	static FString& Deduplicate(FString& Name);
 	static FString& CamelCase(FString& Name);
 	static FString CamelCase(FString&& Name);
@@ -1,3 +1,5 @@
+using System.Collections.Generic;
+using Tools.DotNETCommon;
 using UnrealBuildTool;
 
 public class TsuRuntime : ModuleRules
@@ -26,6 +28,22 @@ public class TsuRuntime : ModuleRules
 				"TsuV8"
 			});
 
+		// The bindings written by the TSU generator include the headers of the modules listed under [TsuGenerator]
+		ConfigHierarchy EngineIni = ConfigCache.ReadHierarchy(
+			ConfigHierarchyType.Engine,
+			DirectoryReference.FromFile(Target.ProjectFile),
+			Target.Platform);
+
+		List<string> GeneratorModules;
+		if (EngineIni.GetArray("TsuGenerator", "Modules", out GeneratorModules))
+		{
+			foreach (string ModuleName in GeneratorModules)
+			{
+				if (!PublicDependencyModuleNames.Contains(ModuleName) && !PrivateDependencyModuleNames.Contains(ModuleName))
+					PrivateDependencyModuleNames.Add(ModuleName);
+			}
+		}
+
 		if (Target.bBuildEditor)
 		{
 			PrivateDependencyModuleNames.AddRange(
@@ -22,6 +22,8 @@ FString FTsuPaths::BinariesDir()
 		TEXT("Binaries"),
 #if PLATFORM_WINDOWS
 		TEXT("Win64/")
+#elif PLATFORM_LINUX
+		TEXT("Linux/")
 #else
 #error Not implemented
 #endif
@@ -50,7 +52,11 @@ FString FTsuPaths::ScriptsSourceDir()
 
 FString FTsuPaths::ParserPath()
 {
+#if PLATFORM_WINDOWS
 	return FPaths::Combine(BinariesDir(), TEXT("TsuParser.exe"));
+#else
+	return FPaths::Combine(BinariesDir(), TEXT("TsuParser"));
+#endif
 }
 
 FString FTsuPaths::BootstrapPath()
@@ -71,3 +77,42 @@ FString FTsuPaths::TypingPath(const TCHAR* TypeName)
 		TypeName,
 		TEXT("index.d.ts"));
 }
+
+FString FTsuPaths::TypingsBundlePath(const TCHAR* ModuleName)
+{
+	return FPaths::Combine(
+		FPaths::ProjectIntermediateDir(),
+		TEXT("Typings"),
+		TEXT("TsuBundles"),
+		FString(ModuleName) + TEXT(".d.ts"));
+}
+
+FString FTsuPaths::TypingsManifestPath()
+{
+	return FPaths::Combine(FPaths::ProjectIntermediateDir(), TEXT("Typings"), TEXT("typings.manifest"));
+}
+
+FString FTsuPaths::NativeTypesStampPath()
+{
+	return FPaths::Combine(FPaths::ProjectIntermediateDir(), TEXT("TsuNativeTypes.stamp"));
+}
+
+FString FTsuPaths::NativeTypingsStampPath()
+{
+	return FPaths::Combine(FPaths::ProjectIntermediateDir(), TEXT("Typings"), TEXT("native.stamp"));
+}
+
+FString FTsuPaths::ReflectionDatabasePath()
+{
+	return FPaths::Combine(FPaths::ProjectIntermediateDir(), TEXT("TsuReflection.db"));
+}
+
+FString FTsuPaths::ParserCacheDir()
+{
+	return FPaths::Combine(FPaths::ProjectIntermediateDir(), TEXT("TsuParser/"));
+}
+
+FString FTsuPaths::SourceMapsDir()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("TsuSourceMaps/"));
+}
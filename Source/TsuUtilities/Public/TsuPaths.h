@@ -14,4 +14,11 @@ struct TSUUTILITIES_API FTsuPaths
 	static FString BootstrapPath();
 	static FString TypingsDir();
 	static FString TypingPath(const TCHAR* TypeName);
+	static FString TypingsBundlePath(const TCHAR* ModuleName);
+	static FString TypingsManifestPath();
+	static FString NativeTypesStampPath();
+	static FString NativeTypingsStampPath();
+	static FString ReflectionDatabasePath();
+	static FString ParserCacheDir();
+	static FString SourceMapsDir();
 };